@@ -25,6 +25,7 @@
 #include "js-parser.h"
 #include "lit-char-helpers.h"
 #include "re-compiler.h"
+#include "vm-scope-cache.h"
 
 #if ENABLED (JERRY_SNAPSHOT_SAVE) || ENABLED (JERRY_SNAPSHOT_EXEC)
 
@@ -976,6 +977,11 @@ jerry_snapshot_result (const uint32_t *snapshot_p, /**< snapshot */
       ecma_raise_common_error (ECMA_ERR_MSG ("Static snapshots cannot be copied into memory"));
       return ecma_create_error_reference_from_context ();
     }
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+    /* Static byte code is never freed, and the buffer of a previous snapshot can be reused. */
+    vm_scope_cache_invalidate ();
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
   }
   else
   {
@@ -48,6 +48,7 @@
 #include "jmem.h"
 #include "js-parser.h"
 #include "re-compiler.h"
+#include "vm-opcode-stats.h"
 
 JERRY_STATIC_ASSERT (sizeof (jerry_value_t) == sizeof (ecma_value_t),
                      size_of_jerry_value_t_must_be_equal_to_size_of_ecma_value_t);
@@ -245,6 +246,9 @@ jerry_cleanup (void)
 #if ENABLED (JERRY_BUILTIN_PROMISE)
   ecma_free_all_enqueued_jobs ();
 #endif /* ENABLED (JERRY_BUILTIN_PROMISE) */
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+  vm_opcode_stats_print ();
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
   ecma_finalize ();
   jerry_make_api_unavailable ();
 
@@ -339,6 +343,30 @@ jerry_gc (jerry_gc_mode_t mode) /**< operational mode */
   ecma_free_unused_memory (JMEM_PRESSURE_HIGH);
 } /* jerry_gc */
 
+/**
+ * Perform a time-limited slice of garbage collection work.
+ *
+ * Note:
+ *      When incremental garbage collection is disabled, a full collection is performed.
+ *
+ * @return true - if no collection cycle is pending after the call
+ *         false - if the collection cycle is still in progress
+ */
+bool
+jerry_gc_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  return ecma_gc_step (budget_us);
+#else /* !ENABLED (JERRY_INCREMENTAL_GC) */
+  JERRY_UNUSED (budget_us);
+
+  ecma_gc_run ();
+  return true;
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+} /* jerry_gc_step */
+
 /**
  * Get heap memory stats.
  *
@@ -373,6 +401,73 @@ jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p) /**< [out] heap memory
 #endif /* ENABLED (JERRY_MEM_STATS) */
 } /* jerry_get_memory_stats */
 
+/**
+ * Get property lookup cache stats.
+ *
+ * @return true - get the lookup cache stats successful
+ *         false - otherwise. Usually it is because the MEM_STATS or the LCACHE feature is not enabled.
+ */
+bool
+jerry_get_lcache_stats (jerry_lcache_stats_t *out_stats_p) /**< [out] property lookup cache stats */
+{
+#if ENABLED (JERRY_LCACHE) && ENABLED (JERRY_MEM_STATS)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  ecma_lcache_stats_t *lcache_stats_p = &JERRY_CONTEXT (lcache_stats);
+
+  *out_stats_p = (jerry_lcache_stats_t)
+  {
+    .version = 1,
+    .rows = ECMA_LCACHE_HASH_ROWS_COUNT,
+    .row_length = ECMA_LCACHE_HASH_ROW_LENGTH,
+    .hit_count = lcache_stats_p->hit_count,
+    .miss_count = lcache_stats_p->miss_count,
+    .eviction_count = lcache_stats_p->eviction_count
+  };
+
+  return true;
+#else /* !ENABLED (JERRY_LCACHE) || !ENABLED (JERRY_MEM_STATS) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_LCACHE) && ENABLED (JERRY_MEM_STATS) */
+} /* jerry_get_lcache_stats */
+
+/**
+ * Get RegExp cache stats.
+ *
+ * @return true - get the RegExp cache stats successful
+ *         false - otherwise. Usually it is because the MEM_STATS or the RegExp feature is not enabled.
+ */
+bool
+jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p) /**< [out] RegExp cache stats */
+{
+#if ENABLED (JERRY_BUILTIN_REGEXP) && ENABLED (JERRY_MEM_STATS)
+  if (out_stats_p == NULL)
+  {
+    return false;
+  }
+
+  re_cache_stats_t *re_cache_stats_p = &JERRY_CONTEXT (re_cache_stats);
+
+  *out_stats_p = (jerry_regexp_cache_stats_t)
+  {
+    .version = 1,
+    .size = RE_CACHE_SIZE,
+    .hit_count = re_cache_stats_p->hit_count,
+    .miss_count = re_cache_stats_p->miss_count,
+    .eviction_count = re_cache_stats_p->eviction_count
+  };
+
+  return true;
+#else /* !ENABLED (JERRY_BUILTIN_REGEXP) || !ENABLED (JERRY_MEM_STATS) */
+  JERRY_UNUSED (out_stats_p);
+  return false;
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) && ENABLED (JERRY_MEM_STATS) */
+} /* jerry_get_regexp_cache_stats */
+
 /**
  * Simple Jerry runner
  *
@@ -2598,6 +2693,11 @@ jerry_set_internal_property (const jerry_value_t obj_val, /**< object value */
 
     value_p->value = ecma_make_object_value (internal_object_p);
     ecma_deref_object (internal_object_p);
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+    /* The internal object is created after the property. */
+    ecma_gc_remember_object (obj_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
   }
   else
   {
@@ -3136,6 +3236,11 @@ jerry_objects_foreach (jerry_objects_foreach_t foreach_p, /**< function pointer
 
   JERRY_ASSERT (foreach_p != NULL);
 
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  /* Objects which are not swept yet are not on the list of alive objects. */
+  ecma_gc_finish_cycle ();
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -3174,6 +3279,11 @@ jerry_objects_foreach_by_native_info (const jerry_object_native_info_t *native_i
 
   ecma_native_pointer_t *native_pointer_p;
 
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  /* Objects which are not swept yet are not on the list of alive objects. */
+  ecma_gc_finish_cycle ();
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
   jmem_cpointer_t iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
 
   while (iter_cp != JMEM_CP_NULL)
@@ -4586,6 +4696,103 @@ jerry_json_stringify (const jerry_value_t input_value) /**< a value to stringify
 #endif /* ENABLED (JERRY_BUILTIN_JSON) */
 } /* jerry_json_stringify */
 
+/**
+ * Create an incremental JSON parser, which receives its input in multiple chunks.
+ *
+ * Note:
+ *      The parser must be freed with jerry_json_parser_finish
+ *
+ * @return pointer to the parser - if success
+ *         NULL - if JSON support is disabled or there is not enough memory
+ */
+jerry_json_parser_t *
+jerry_json_parser_create (void)
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  ecma_json_parser_t *parser_p = jmem_heap_alloc_block_null_on_error (sizeof (ecma_json_parser_t));
+
+  if (parser_p != NULL)
+  {
+    ecma_builtin_json_parser_init (parser_p);
+  }
+
+  return (jerry_json_parser_t *) parser_p;
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  return NULL;
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_create */
+
+/**
+ * Parse the next chunk of a JSON string with an incremental JSON parser.
+ *
+ * The chunk may end anywhere, even inside a token or a multi-byte character. The parser
+ * does not keep a reference to the chunk, so the buffer can be reused after the call.
+ *
+ * Note:
+ *      The returned value must be freed with jerry_release_value.
+ *
+ * @return true - if the input is valid so far
+ *         Error value - if the input is not a valid JSON string
+ */
+jerry_value_t
+jerry_json_parser_feed (jerry_json_parser_t *parser_p, /**< parser created by jerry_json_parser_create */
+                        const jerry_char_t *chunk_p, /**< next chunk of the json string */
+                        jerry_size_t chunk_size) /**< size of the chunk */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  if (parser_p == NULL || (chunk_p == NULL && chunk_size > 0))
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+  }
+
+  return jerry_return (ecma_builtin_json_parser_feed ((ecma_json_parser_t *) parser_p, chunk_p, chunk_size));
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  JERRY_UNUSED (parser_p);
+  JERRY_UNUSED (chunk_p);
+  JERRY_UNUSED (chunk_size);
+
+  return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG ("The JSON has been disabled.")));
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_feed */
+
+/**
+ * Finish the parsing of a JSON string with an incremental JSON parser and free the parser.
+ *
+ * The behaviour is equivalent with the "JSON.parse(string)" JS call, where string
+ * is the concatenation of all chunks passed to jerry_json_parser_feed.
+ *
+ * Note:
+ *      The returned value must be freed with jerry_release_value.
+ *
+ * @return - jerry_value_t containing a JavaScript value.
+ *         - Error value if there was problems during the parse.
+ */
+jerry_value_t
+jerry_json_parser_finish (jerry_json_parser_t *parser_p) /**< parser created by jerry_json_parser_create */
+{
+  jerry_assert_api_available ();
+
+#if ENABLED (JERRY_BUILTIN_JSON)
+  if (parser_p == NULL)
+  {
+    return jerry_throw (ecma_raise_type_error (ECMA_ERR_MSG (wrong_args_msg_p)));
+  }
+
+  ecma_value_t ret_value = ecma_builtin_json_parser_finish ((ecma_json_parser_t *) parser_p, NULL, 0);
+  jmem_heap_free_block (parser_p, sizeof (ecma_json_parser_t));
+
+  return jerry_return (ret_value);
+#else /* !ENABLED (JERRY_BUILTIN_JSON) */
+  JERRY_UNUSED (parser_p);
+
+  return jerry_throw (ecma_raise_syntax_error (ECMA_ERR_MSG ("The JSON has been disabled.")));
+#endif /* ENABLED (JERRY_BUILTIN_JSON) */
+} /* jerry_json_parser_finish */
+
 /**
  * Create a container type specified in jerry_container_type_t.
  * The container can be created with a list of arguments, which will be passed to the container constructor to be
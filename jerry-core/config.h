@@ -209,6 +209,20 @@
 # define JERRY_STACK_LIMIT (0)
 #endif /* !defined (JERRY_STACK_LIMIT) */
 
+/**
+ * Size of the frame stack segments in kilobytes
+ *
+ * The frames of the byte code interpreter are allocated from segments of this size,
+ * which are allocated on the engine heap and reused by the later calls. A frame which
+ * is larger than this size is allocated in its own segment. If set to 0, the frames
+ * are allocated on the native stack.
+ *
+ * Default value: 8
+ */
+#ifndef JERRY_VM_STACK_SEGMENT_SIZE
+# define JERRY_VM_STACK_SEGMENT_SIZE (8)
+#endif /* !defined (JERRY_VM_STACK_SEGMENT_SIZE) */
+
 /**
  * Maximum depth of recursion during GC mark phase
  *
@@ -218,6 +232,42 @@
 # define JERRY_GC_MARK_LIMIT (8)
 #endif /* !defined (JERRY_GC_MARK_LIMIT) */
 
+/**
+ * Enable/Disable incremental garbage collection.
+ *
+ * When enabled, the jerry_gc_step API function performs garbage collection
+ * in time-limited slices which can be interleaved with script execution.
+ * The marks of a cycle are stored in a bitmap (one bit per JMEM_ALIGNMENT
+ * bytes of the heap) which is allocated on the heap when the cycle starts.
+ *
+ * Allowed values:
+ *  0: Disable incremental garbage collection.
+ *  1: Enable incremental garbage collection.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_INCREMENTAL_GC
+# define JERRY_INCREMENTAL_GC 0
+#endif /* !defined (JERRY_INCREMENTAL_GC) */
+
+/**
+ * Enable/Disable generational garbage collection.
+ *
+ * When enabled, the objects allocated since the last collection form a young
+ * generation, and most collections only trace these objects. The young objects
+ * are tracked by a bitmap (one bit per JMEM_ALIGNMENT bytes of the heap) which
+ * is allocated on the heap when the engine is initialized.
+ *
+ * Allowed values:
+ *  0: Disable generational garbage collection.
+ *  1: Enable generational garbage collection.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_GENERATIONAL_GC
+# define JERRY_GENERATIONAL_GC 0
+#endif /* !defined (JERRY_GENERATIONAL_GC) */
+
 /**
  * Enable/Disable property lookup cache.
  *
@@ -231,6 +281,141 @@
 # define JERRY_LCACHE 1
 #endif /* !defined (JERRY_LCACHE) */
 
+/**
+ * Number of rows in the property lookup cache.
+ *
+ * The value must be a power of 2.
+ *
+ * Default value: 128
+ */
+#ifndef JERRY_LCACHE_ROWS_COUNT
+# define JERRY_LCACHE_ROWS_COUNT (128)
+#endif /* !defined (JERRY_LCACHE_ROWS_COUNT) */
+
+/**
+ * Number of entries in a row of the property lookup cache (associativity).
+ *
+ * Allowed values: 1 - 8
+ *
+ * Default value: 2
+ */
+#ifndef JERRY_LCACHE_ROW_LENGTH
+# define JERRY_LCACHE_ROW_LENGTH (2)
+#endif /* !defined (JERRY_LCACHE_ROW_LENGTH) */
+
+/**
+ * Number of compiled patterns in the RegExp cache.
+ *
+ * The value must be a power of 2, and at least 4.
+ *
+ * Default value: 32
+ */
+#ifndef JERRY_REGEXP_CACHE_SIZE
+# define JERRY_REGEXP_CACHE_SIZE (32)
+#endif /* !defined (JERRY_REGEXP_CACHE_SIZE) */
+
+/**
+ * Maximum total size (in bytes) of the compiled patterns which are kept in the RegExp cache by garbage collections.
+ *
+ * The least recently used patterns are freed until the size of the remaining ones is below this limit.
+ * If set to 0, the cache is cleared by every garbage collection.
+ *
+ * Default value: 8192
+ */
+#ifndef JERRY_REGEXP_CACHE_GC_LIMIT
+# define JERRY_REGEXP_CACHE_GC_LIMIT (8192)
+#endif /* !defined (JERRY_REGEXP_CACHE_GC_LIMIT) */
+
+/**
+ * Enable/Disable inline caches of property access sites.
+ *
+ * When enabled, the virtual machine remembers the position of the property
+ * in the property list of the last objects accessed by each property access
+ * site, so objects with the same property layout are handled by a name check
+ * and an indexed load.
+ *
+ * Allowed values:
+ *  0: Disable inline caches.
+ *  1: Enable inline caches.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_INLINE_CACHE
+# define JERRY_INLINE_CACHE 1
+#endif /* !defined (JERRY_INLINE_CACHE) */
+
+/**
+ * Enable/Disable scope caches of identifier access sites.
+ *
+ * When enabled, the virtual machine remembers the number of lexical environments
+ * skipped by each identifier access site and the position of the binding in the
+ * environment where it was found, so captured variables of functions whose scope
+ * chain cannot gain new bindings (e.g. by direct eval) are accessed without
+ * searching the environments by name.
+ *
+ * Allowed values:
+ *  0: Disable scope caches.
+ *  1: Enable scope caches.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_SCOPE_CACHE
+# define JERRY_SCOPE_CACHE 1
+#endif /* !defined (JERRY_SCOPE_CACHE) */
+
+/**
+ * Enable/Disable rope strings.
+ *
+ * When enabled, the concatenation of long strings creates a rope string which
+ * refers to the concatenated parts, and the characters are copied into a single
+ * buffer only when they are accessed. This makes building a long string by
+ * repeated concatenation linear instead of quadratic.
+ *
+ * Allowed values:
+ *  0: Disable rope strings.
+ *  1: Enable rope strings.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_ROPE_STRING
+# define JERRY_ROPE_STRING 1
+#endif /* !defined (JERRY_ROPE_STRING) */
+
+/**
+ * Enable/Disable the string index cache.
+ *
+ * When enabled, the byte offsets of every 32nd code unit of recently indexed
+ * non-ASCII strings are cached, so accessing a character of these strings by
+ * its index (e.g. str[i] or str.charCodeAt (i)) takes constant time instead
+ * of decoding the string from its start.
+ *
+ * Allowed values:
+ *  0: Disable the string index cache.
+ *  1: Enable the string index cache.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_STRING_INDEX_CACHE
+# define JERRY_STRING_INDEX_CACHE 1
+#endif /* !defined (JERRY_STRING_INDEX_CACHE) */
+
+/**
+ * Select the hash function of strings.
+ *
+ * The word-at-a-time hash processes four bytes of a string in each step,
+ * and its final mixing step distributes the result evenly over all bits.
+ * The byte-at-a-time FNV-1a hash has smaller code size.
+ *
+ * Allowed values:
+ *  0: Use the FNV-1a hash.
+ *  1: Use the word-at-a-time hash.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_FAST_STRING_HASH
+# define JERRY_FAST_STRING_HASH 1
+#endif /* !defined (JERRY_FAST_STRING_HASH) */
+
 /**
  * Enable/Disable line-info management inside the engine.
  *
@@ -365,6 +550,24 @@
 # define JERRY_REGEXP_STRICT_MODE 0
 #endif /* !defined (JERRY_REGEXP_STRICT_MODE) */
 
+/**
+ * Enable/Disable the linear time NFA matcher for RegExp objects.
+ *
+ * When enabled, patterns without backreferences and lookahead assertions
+ * are also compiled to an NFA program. When the backtracking matcher takes
+ * too many steps on such a pattern, the match is completed by simulating
+ * the NFA, which takes linear time in the length of the input.
+ *
+ * Allowed values:
+ *  0: Disable the NFA matcher.
+ *  1: Enable the NFA matcher.
+ *
+ * Default value: 1
+ */
+#ifndef JERRY_REGEXP_NFA
+# define JERRY_REGEXP_NFA 1
+#endif /* !defined (JERRY_REGEXP_NFA) */
+
 /**
  * Enable/Disable the snapshot execution functions.
  *
@@ -402,6 +605,25 @@
 # define JERRY_SYSTEM_ALLOCATOR 0
 #endif /* !defined (JERRY_SYSTEM_ALLOCATOR) */
 
+/**
+ * Enable/Disable the segregated free list mode of the internal allocator.
+ *
+ * When enabled, free heap regions are kept in size class bins instead of
+ * a single address ordered list, so allocating and freeing a block takes
+ * constant time regardless of heap fragmentation. The price is a free
+ * block bitmap (one bit per JMEM_ALIGNMENT bytes) which is reserved at
+ * the end of the heap area.
+ *
+ * Allowed values:
+ *  0: Use the address ordered first-fit free list.
+ *  1: Use segregated free lists.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_SEGREGATED_ALLOCATOR
+# define JERRY_SEGREGATED_ALLOCATOR 0
+#endif /* !defined (JERRY_SEGREGATED_ALLOCATOR) */
+
 /**
  * Enables/disables the unicode case conversion in the engine.
  * By default Unicode case conversion is enabled.
@@ -432,6 +654,48 @@
 # define JERRY_VM_EXEC_STOP 0
 #endif /* !defined (JERRY_VM_EXEC_STOP) */
 
+/**
+ * Enable/Disable computed-goto dispatch in the byte code interpreter.
+ *
+ * When enabled, the main loop of the virtual machine jumps to the operand
+ * fetch code and to the opcode handlers through label address tables instead
+ * of switch statements, so each operand fetch variant has its own indirect
+ * branch to the opcode handlers. This relies on the "labels as values"
+ * extension of GCC compatible compilers; other compilers must use the
+ * switch based dispatch.
+ *
+ * Allowed values:
+ *  0: Use switch based dispatch.
+ *  1: Use computed-goto dispatch.
+ *
+ * Default value: 1 for GCC compatible compilers, 0 otherwise
+ */
+#ifndef JERRY_VM_COMPUTED_GOTO
+# if defined (__GNUC__) || defined (__clang__)
+#  define JERRY_VM_COMPUTED_GOTO 1
+# else /* !__GNUC__ && !__clang__ */
+#  define JERRY_VM_COMPUTED_GOTO 0
+# endif /* __GNUC__ || __clang__ */
+#endif /* !defined (JERRY_VM_COMPUTED_GOTO) */
+
+/**
+ * Enable/Disable opcode sequence statistics of the virtual machine.
+ *
+ * When enabled, the virtual machine counts how many times each opcode and each
+ * pair and triple of consecutively executed opcodes are executed, and the most
+ * frequent sequences are printed when the engine is cleaned up. The statistics
+ * are used for selecting the combined opcodes of the byte code.
+ *
+ * Allowed values:
+ *  0: Disable opcode statistics.
+ *  1: Enable opcode statistics.
+ *
+ * Default value: 0
+ */
+#ifndef JERRY_VM_OPCODE_STATS
+# define JERRY_VM_OPCODE_STATS 0
+#endif /* !defined (JERRY_VM_OPCODE_STATS) */
+
 /**
  * Advanced section configurations.
  */
@@ -611,13 +875,58 @@
 #if !defined (JERRY_STACK_LIMIT) || (JERRY_STACK_LIMIT < 0)
 # error "Invalid value for 'JERRY_STACK_LIMIT' macro."
 #endif
+#if !defined (JERRY_VM_STACK_SEGMENT_SIZE) || (JERRY_VM_STACK_SEGMENT_SIZE < 0)
+# error "Invalid value for 'JERRY_VM_STACK_SEGMENT_SIZE' macro."
+#endif
 #if !defined (JERRY_GC_MARK_LIMIT) || (JERRY_GC_MARK_LIMIT < 0)
 # error "Invalid value for 'JERRY_GC_MARK_LIMIT' macro."
 #endif
+#if !defined (JERRY_INCREMENTAL_GC) \
+|| ((JERRY_INCREMENTAL_GC != 0) && (JERRY_INCREMENTAL_GC != 1))
+# error "Invalid value for 'JERRY_INCREMENTAL_GC' macro."
+#endif
+#if !defined (JERRY_GENERATIONAL_GC) \
+|| ((JERRY_GENERATIONAL_GC != 0) && (JERRY_GENERATIONAL_GC != 1))
+# error "Invalid value for 'JERRY_GENERATIONAL_GC' macro."
+#endif
 #if !defined (JERRY_LCACHE) \
 || ((JERRY_LCACHE != 0) && (JERRY_LCACHE != 1))
 # error "Invalid value for 'JERRY_LCACHE' macro."
 #endif
+#if !defined (JERRY_LCACHE_ROWS_COUNT) || (JERRY_LCACHE_ROWS_COUNT <= 0) \
+|| ((JERRY_LCACHE_ROWS_COUNT & (JERRY_LCACHE_ROWS_COUNT - 1)) != 0)
+# error "Invalid value for 'JERRY_LCACHE_ROWS_COUNT' macro."
+#endif
+#if !defined (JERRY_LCACHE_ROW_LENGTH) || (JERRY_LCACHE_ROW_LENGTH < 1) || (JERRY_LCACHE_ROW_LENGTH > 8)
+# error "Invalid value for 'JERRY_LCACHE_ROW_LENGTH' macro."
+#endif
+#if !defined (JERRY_REGEXP_CACHE_SIZE) || (JERRY_REGEXP_CACHE_SIZE < 4) \
+|| ((JERRY_REGEXP_CACHE_SIZE & (JERRY_REGEXP_CACHE_SIZE - 1)) != 0)
+# error "Invalid value for 'JERRY_REGEXP_CACHE_SIZE' macro."
+#endif
+#if !defined (JERRY_REGEXP_CACHE_GC_LIMIT) || (JERRY_REGEXP_CACHE_GC_LIMIT < 0)
+# error "Invalid value for 'JERRY_REGEXP_CACHE_GC_LIMIT' macro."
+#endif
+#if !defined (JERRY_INLINE_CACHE) \
+|| ((JERRY_INLINE_CACHE != 0) && (JERRY_INLINE_CACHE != 1))
+# error "Invalid value for 'JERRY_INLINE_CACHE' macro."
+#endif
+#if !defined (JERRY_SCOPE_CACHE) \
+|| ((JERRY_SCOPE_CACHE != 0) && (JERRY_SCOPE_CACHE != 1))
+# error "Invalid value for 'JERRY_SCOPE_CACHE' macro."
+#endif
+#if !defined (JERRY_ROPE_STRING) \
+|| ((JERRY_ROPE_STRING != 0) && (JERRY_ROPE_STRING != 1))
+# error "Invalid value for 'JERRY_ROPE_STRING' macro."
+#endif
+#if !defined (JERRY_STRING_INDEX_CACHE) \
+|| ((JERRY_STRING_INDEX_CACHE != 0) && (JERRY_STRING_INDEX_CACHE != 1))
+# error "Invalid value for 'JERRY_STRING_INDEX_CACHE' macro."
+#endif
+#if !defined (JERRY_FAST_STRING_HASH) \
+|| ((JERRY_FAST_STRING_HASH != 0) && (JERRY_FAST_STRING_HASH != 1))
+# error "Invalid value for 'JERRY_FAST_STRING_HASH' macro."
+#endif
 #if !defined (JERRY_LINE_INFO) \
 || ((JERRY_LINE_INFO != 0) && (JERRY_LINE_INFO != 1))
 # error "Invalid value for 'JERRY_LINE_INFO' macro."
@@ -658,6 +967,10 @@
 || ((JERRY_REGEXP_STRICT_MODE != 0) && (JERRY_REGEXP_STRICT_MODE != 1))
 # error "Invalid value for 'JERRY_REGEXP_STRICT_MODE' macro."
 #endif
+#if !defined (JERRY_REGEXP_NFA) \
+|| ((JERRY_REGEXP_NFA != 0) && (JERRY_REGEXP_NFA != 1))
+# error "Invalid value for 'JERRY_REGEXP_NFA' macro."
+#endif
 #if !defined (JERRY_SNAPSHOT_EXEC) \
 || ((JERRY_SNAPSHOT_EXEC != 0) && (JERRY_SNAPSHOT_EXEC != 1))
 # error "Invalid value for 'JERRY_SNAPSHOT_EXEC' macro."
@@ -670,6 +983,10 @@
 || ((JERRY_SYSTEM_ALLOCATOR != 0) && (JERRY_SYSTEM_ALLOCATOR != 1))
 # error "Invalid value for 'JERRY_SYSTEM_ALLOCATOR' macro."
 #endif
+#if !defined (JERRY_SEGREGATED_ALLOCATOR) \
+|| ((JERRY_SEGREGATED_ALLOCATOR != 0) && (JERRY_SEGREGATED_ALLOCATOR != 1))
+# error "Invalid value for 'JERRY_SEGREGATED_ALLOCATOR' macro."
+#endif
 #if !defined (JERRY_UNICODE_CASE_CONVERSION) \
 || ((JERRY_UNICODE_CASE_CONVERSION != 0) && (JERRY_UNICODE_CASE_CONVERSION != 1))
 # error "Invalid value for 'JERRY_UNICODE_CASE_CONVERSION' macro."
@@ -682,6 +999,14 @@
 || ((JERRY_VM_EXEC_STOP != 0) && (JERRY_VM_EXEC_STOP != 1))
 # error "Invalid value for 'JERRY_VM_EXEC_STOP' macro."
 #endif
+#if !defined (JERRY_VM_COMPUTED_GOTO) \
+|| ((JERRY_VM_COMPUTED_GOTO != 0) && (JERRY_VM_COMPUTED_GOTO != 1))
+# error "Invalid value for 'JERRY_VM_COMPUTED_GOTO' macro."
+#endif
+#if !defined (JERRY_VM_OPCODE_STATS) \
+|| ((JERRY_VM_OPCODE_STATS != 0) && (JERRY_VM_OPCODE_STATS != 1))
+# error "Invalid value for 'JERRY_VM_OPCODE_STATS' macro."
+#endif
 
 #define ENABLED(FEATURE) ((FEATURE) == 1)
 #define DISABLED(FEATURE) ((FEATURE) != 1)
@@ -697,6 +1022,41 @@
 #  error "Date does not support float32"
 #endif
 
+/**
+ * The segregated free lists are part of the internal allocator.
+ */
+#if ENABLED (JERRY_SYSTEM_ALLOCATOR) && ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+#  error "The segregated allocator cannot be used together with the system allocator"
+#endif
+
+/**
+ * The mark bitmap of the incremental garbage collector covers the heap area.
+ */
+#if ENABLED (JERRY_SYSTEM_ALLOCATOR) && ENABLED (JERRY_INCREMENTAL_GC)
+#  error "Incremental garbage collection cannot be used together with the system allocator"
+#endif
+
+/**
+ * The young object bitmap of the generational garbage collector covers the heap area.
+ */
+#if ENABLED (JERRY_SYSTEM_ALLOCATOR) && ENABLED (JERRY_GENERATIONAL_GC)
+#  error "Generational garbage collection cannot be used together with the system allocator"
+#endif
+
+/**
+ * Computed-goto dispatch uses the "labels as values" extension of GCC compatible compilers.
+ */
+#if ENABLED (JERRY_VM_COMPUTED_GOTO) && !(defined (__GNUC__) || defined (__clang__))
+#  error "Computed-goto dispatch requires a GCC compatible compiler"
+#endif
+
+/**
+ * Opcode statistics are printed with the opcode names of the parser.
+ */
+#if ENABLED (JERRY_VM_OPCODE_STATS) && !ENABLED (JERRY_PARSER)
+#  error "Opcode statistics require the JavaScript parser"
+#endif
+
 /**
  * Wrap container types into a single guard
  */
@@ -707,6 +1067,15 @@
 # define JERRY_BUILTIN_CONTAINER 0
 #endif
 
+/**
+ * Wrap garbage collectors which need a write barrier into a single guard
+ */
+#if ENABLED (JERRY_INCREMENTAL_GC) || ENABLED (JERRY_GENERATIONAL_GC)
+# define JERRY_GC_WRITE_BARRIER 1
+#else
+# define JERRY_GC_WRITE_BARRIER 0
+#endif
+
 /**
  * Resource name related types into a single guard
  */
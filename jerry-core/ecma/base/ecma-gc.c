@@ -24,6 +24,7 @@
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-literal-storage.h"
 #include "ecma-objects.h"
 #include "ecma-property-hashmap.h"
 #include "ecma-proxy-object.h"
@@ -54,7 +55,10 @@
 /*
  * The garbage collector uses the reference counter
  * of object: it increases the counter by one when
- * the object is marked at the first time.
+ * the object is marked at the first time. Objects
+ * which are not marked recursively are pushed onto
+ * a mark stack, so the object graph is traversed in
+ * a single pass regardless of its depth.
  */
 
 /**
@@ -76,12 +80,383 @@ ecma_gc_is_object_visited (ecma_object_t *object_p) /**< object */
  */
 static void ecma_gc_mark (ecma_object_t *object_p);
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+
+/**
+ * Size of a bitmap which has one bit for each JMEM_ALIGNMENT sized unit of the heap area.
+ */
+#define ECMA_GC_HEAP_BITMAP_SIZE \
+  (((JMEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG) + 31) / 32 * sizeof (uint32_t))
+
+/**
+ * Get the index of the bit of an object in a heap bitmap.
+ *
+ * @return bit index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_get_heap_bit_index (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT ((uint8_t *) object_p >= (uint8_t *) JERRY_HEAP_CONTEXT (area)
+                && (uint8_t *) object_p < (uint8_t *) JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_AREA_SIZE);
+
+  return (uint32_t) (((uint8_t *) object_p - (uint8_t *) JERRY_HEAP_CONTEXT (area)) >> JMEM_ALIGNMENT_LOG);
+} /* ecma_gc_get_heap_bit_index */
+
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+
+/*
+ * The incremental collector does not touch the reference counters: the
+ * marks are kept in a bitmap which has one bit for each JMEM_ALIGNMENT
+ * sized unit of the heap area, and gray objects are kept on a worklist
+ * of compressed pointers. Since the reference counters keep their usual
+ * meaning, the mutator can run between the steps of a cycle. Every object
+ * which is referenced during marking (by the reference counter, by a store
+ * into another object or by being allocated) is shaded gray, so no black
+ * object can point to a white one when the worklist becomes empty.
+ */
+
+/**
+ * Initial number of objects in the worklist of the incremental collector.
+ */
+#define ECMA_GC_WORKLIST_MIN_CAPACITY 256
+
+/**
+ * The worklist of the incremental collector is not grown beyond this limit.
+ */
+#define ECMA_GC_WORKLIST_MAX_CAPACITY (1u << 16)
+
+/**
+ * Number of objects processed between two checks of the time budget.
+ */
+#define ECMA_GC_STEP_TIME_CHECK_INTERVAL 64
+
+/**
+ * Check whether the object is marked by the current incremental cycle.
+ *
+ * @return true  - if marked
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_is_object_marked (ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ecma_gc_get_heap_bit_index (object_p);
+
+  return (JERRY_CONTEXT (ecma_gc_mark_bitmap_p)[index >> 5] & (1u << (index & 31))) != 0;
+} /* ecma_gc_is_object_marked */
+
+/**
+ * Shade an object gray: mark it and push it onto the worklist.
+ *
+ * Note:
+ *      this function never allocates memory: when the worklist is full the
+ *      object is only marked, and the marked objects are rescanned later
+ */
+static void
+ecma_gc_shade_object (ecma_object_t *object_p) /**< object */
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK);
+
+  uint32_t index = ecma_gc_get_heap_bit_index (object_p);
+  uint32_t *word_p = JERRY_CONTEXT (ecma_gc_mark_bitmap_p) + (index >> 5);
+  uint32_t bit = 1u << (index & 31);
+
+  if (*word_p & bit)
+  {
+    return;
+  }
+
+  *word_p |= bit;
+
+  if (JERRY_LIKELY (JERRY_CONTEXT (ecma_gc_worklist_size) < JERRY_CONTEXT (ecma_gc_worklist_capacity)))
+  {
+    jmem_cpointer_t *item_p = JERRY_CONTEXT (ecma_gc_worklist_p) + JERRY_CONTEXT (ecma_gc_worklist_size)++;
+    ECMA_SET_NON_NULL_POINTER (*item_p, object_p);
+    return;
+  }
+
+  JERRY_CONTEXT (ecma_gc_worklist_overflow) = true;
+} /* ecma_gc_shade_object */
+
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+
+/*
+ * The generational collector splits the list of objects into two parts: the
+ * objects allocated since the last collection (the young generation) are at
+ * the beginning of the list, followed by the objects which survived at least
+ * one collection (the old generation). A minor collection only traces and
+ * sweeps the young objects: the old objects are considered alive, and the
+ * references from old objects to young objects are found by the remembered
+ * set, which contains the old objects that were modified since the last
+ * collection. The young bit of an old object is set while the object is in
+ * the remembered set. A young object is promoted (its young bit is cleared)
+ * when it is stored without knowing its holder object, so it becomes a root
+ * of the next minor collection.
+ */
+
+/**
+ * Initial number of objects in the remembered set of the generational collector.
+ */
+#define ECMA_GC_REMEMBERED_MIN_CAPACITY 64
+
+/**
+ * Check whether the young bit of an object is set.
+ *
+ * @return true  - if the object is young or it is in the remembered set
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_is_object_young (ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ecma_gc_get_heap_bit_index (object_p);
+
+  return (JERRY_CONTEXT (ecma_gc_young_bitmap_p)[index >> 5] & (1u << (index & 31))) != 0;
+} /* ecma_gc_is_object_young */
+
+/**
+ * Set the young bit of an object.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_set_object_young (ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ecma_gc_get_heap_bit_index (object_p);
+
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p)[index >> 5] |= 1u << (index & 31);
+} /* ecma_gc_set_object_young */
+
+/**
+ * Clear the young bit of an object.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_gc_clear_object_young (ecma_object_t *object_p) /**< object */
+{
+  uint32_t index = ecma_gc_get_heap_bit_index (object_p);
+
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p)[index >> 5] &= ~(1u << (index & 31));
+} /* ecma_gc_clear_object_young */
+
+/**
+ * Add an object to the remembered set of the generational collector.
+ *
+ * Must be called when a reference to an object is stored into the holder
+ * object without increasing the reference counter of the stored object.
+ *
+ * Note:
+ *      this function never reclaims memory: when the remembered set cannot
+ *      grow, the next garbage collection is a full collection
+ */
+void
+ecma_gc_remember_object (ecma_object_t *holder_p) /**< holder object */
+{
+  if (ecma_gc_is_object_young (holder_p))
+  {
+    /* Young objects are traced by minor collections. */
+    return;
+  }
+
+  ecma_gc_set_object_young (holder_p);
+
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_remembered_overflow)))
+  {
+    return;
+  }
+
+  uint32_t size = JERRY_CONTEXT (ecma_gc_remembered_size);
+
+  if (JERRY_UNLIKELY (size == JERRY_CONTEXT (ecma_gc_remembered_capacity)))
+  {
+    uint32_t new_capacity = (size == 0) ? ECMA_GC_REMEMBERED_MIN_CAPACITY : size * 2;
+    jmem_cpointer_t *new_items_p;
+    new_items_p = (jmem_cpointer_t *) jmem_heap_alloc_block_no_gc (new_capacity * sizeof (jmem_cpointer_t));
+
+    if (JERRY_UNLIKELY (new_items_p == NULL))
+    {
+      JERRY_CONTEXT (ecma_gc_remembered_overflow) = true;
+      return;
+    }
+
+    if (size > 0)
+    {
+      memcpy (new_items_p, JERRY_CONTEXT (ecma_gc_remembered_p), size * sizeof (jmem_cpointer_t));
+      jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_remembered_p), size * sizeof (jmem_cpointer_t));
+    }
+
+    JERRY_CONTEXT (ecma_gc_remembered_p) = new_items_p;
+    JERRY_CONTEXT (ecma_gc_remembered_capacity) = new_capacity;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_remembered_p)[size], holder_p);
+  JERRY_CONTEXT (ecma_gc_remembered_size) = size + 1;
+} /* ecma_gc_remember_object */
+
+/**
+ * Release the remembered set of the generational collector.
+ */
+static void
+ecma_gc_free_remembered_set (void)
+{
+  if (JERRY_CONTEXT (ecma_gc_remembered_p) != NULL)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_remembered_p),
+                          JERRY_CONTEXT (ecma_gc_remembered_capacity) * sizeof (jmem_cpointer_t));
+    JERRY_CONTEXT (ecma_gc_remembered_p) = NULL;
+  }
+
+  JERRY_CONTEXT (ecma_gc_remembered_size) = 0;
+  JERRY_CONTEXT (ecma_gc_remembered_capacity) = 0;
+} /* ecma_gc_free_remembered_set */
+
+/**
+ * Initialize the generational collector.
+ */
+void
+ecma_gc_init (void)
+{
+  uint32_t *bitmap_p = (uint32_t *) jmem_heap_alloc_block (ECMA_GC_HEAP_BITMAP_SIZE);
+  memset (bitmap_p, 0, ECMA_GC_HEAP_BITMAP_SIZE);
+
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p) = bitmap_p;
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JMEM_CP_NULL;
+} /* ecma_gc_init */
+
+/**
+ * Finalize the generational collector.
+ */
+void
+ecma_gc_finalize (void)
+{
+  ecma_gc_free_remembered_set ();
+
+  jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_young_bitmap_p), ECMA_GC_HEAP_BITMAP_SIZE);
+  JERRY_CONTEXT (ecma_gc_young_bitmap_p) = NULL;
+} /* ecma_gc_finalize */
+
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+
+/**
+ * Write barrier of the incremental and generational collectors.
+ *
+ * Must be called when a reference to an object is stored into another object
+ * without increasing its reference counter.
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *holder_p, /**< holder object (NULL if it is not known) */
+                       ecma_object_t *object_p) /**< stored object */
+{
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  if (holder_p != NULL)
+  {
+    ecma_gc_remember_object (holder_p);
+  }
+  else
+  {
+    /* The stored object is promoted, since the holder cannot be remembered. */
+    ecma_gc_clear_object_young (object_p);
+  }
+#else /* !ENABLED (JERRY_GENERATIONAL_GC) */
+  JERRY_UNUSED (holder_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK))
+  {
+    ecma_gc_shade_object (object_p);
+  }
+#else /* !ENABLED (JERRY_INCREMENTAL_GC) */
+  JERRY_UNUSED (object_p);
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+} /* ecma_gc_write_barrier */
+
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
+/**
+ * Push a gray object onto the mark stack.
+ *
+ * Note:
+ *      new chunks are allocated without reclaiming memory, since the collector is running
+ *
+ * @return true  - if the object is pushed
+ *         false - if there is not enough memory for a new chunk
+ */
+static bool
+ecma_gc_mark_stack_push (ecma_object_t *object_p) /**< object */
+{
+  ecma_gc_mark_stack_chunk_t *chunk_p = JERRY_CONTEXT (ecma_gc_mark_stack_p);
+  uint32_t index = JERRY_CONTEXT (ecma_gc_mark_stack_index);
+
+  JERRY_ASSERT (chunk_p != NULL);
+
+  if (JERRY_UNLIKELY (index == ECMA_GC_MARK_STACK_CHUNK_SIZE))
+  {
+    ecma_gc_mark_stack_chunk_t *new_chunk_p;
+    new_chunk_p = (ecma_gc_mark_stack_chunk_t *) jmem_heap_alloc_block_no_gc (sizeof (ecma_gc_mark_stack_chunk_t));
+
+    if (JERRY_UNLIKELY (new_chunk_p == NULL))
+    {
+      return false;
+    }
+
+    new_chunk_p->prev_p = chunk_p;
+    chunk_p = new_chunk_p;
+    index = 0;
+
+    JERRY_CONTEXT (ecma_gc_mark_stack_p) = chunk_p;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (chunk_p->items[index], object_p);
+  JERRY_CONTEXT (ecma_gc_mark_stack_index) = index + 1;
+  return true;
+} /* ecma_gc_mark_stack_push */
+
+/**
+ * Mark the objects of the mark stack until it becomes empty.
+ */
+static void
+ecma_gc_mark_stack_drain (void)
+{
+  while (true)
+  {
+    ecma_gc_mark_stack_chunk_t *chunk_p = JERRY_CONTEXT (ecma_gc_mark_stack_p);
+    uint32_t index = JERRY_CONTEXT (ecma_gc_mark_stack_index);
+
+    if (index == 0)
+    {
+      if (chunk_p->prev_p == NULL)
+      {
+        return;
+      }
+
+      JERRY_CONTEXT (ecma_gc_mark_stack_p) = chunk_p->prev_p;
+      JERRY_CONTEXT (ecma_gc_mark_stack_index) = ECMA_GC_MARK_STACK_CHUNK_SIZE;
+      jmem_heap_free_block (chunk_p, sizeof (ecma_gc_mark_stack_chunk_t));
+      continue;
+    }
+
+    index--;
+    JERRY_CONTEXT (ecma_gc_mark_stack_index) = index;
+    ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, chunk_p->items[index]));
+  }
+} /* ecma_gc_mark_stack_drain */
+
 /**
  * Set visited flag of the object.
  */
 static void
 ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
 {
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_shade_object (object_p);
+    return;
+  }
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
   if (object_p->type_flags_refs >= ECMA_OBJECT_NON_VISITED)
   {
 #if (JERRY_GC_MARK_LIMIT != 0)
@@ -92,6 +467,14 @@ ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
       object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
       ecma_gc_mark (object_p);
       JERRY_CONTEXT (ecma_gc_mark_recursion_limit)++;
+      return;
+    }
+#endif /* (JERRY_GC_MARK_LIMIT != 0) */
+
+    if (JERRY_LIKELY (ecma_gc_mark_stack_push (object_p)))
+    {
+      /* Set the reference count of gray object to 0 */
+      object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
     }
     else
     {
@@ -99,10 +482,6 @@ ecma_gc_set_object_visited (ecma_object_t *object_p) /**< object */
       object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & ((ECMA_OBJECT_REF_ONE << 1) - 1));
       JERRY_ASSERT (object_p->type_flags_refs >= ECMA_OBJECT_REF_ONE);
     }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-    /* Set the reference count of gray object to 0 */
-    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
   }
 } /* ecma_gc_set_object_visited */
 
@@ -120,6 +499,18 @@ ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 
   object_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
   ECMA_SET_NON_NULL_POINTER (JERRY_CONTEXT (ecma_gc_objects_cp), object_p);
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  /* Objects allocated during marking are never collected by the current cycle. */
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK))
+  {
+    ecma_gc_shade_object (object_p);
+  }
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_gc_set_object_young (object_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
 } /* ecma_init_gc_info */
 
 /**
@@ -136,6 +527,14 @@ ecma_ref_object (ecma_object_t *object_p) /**< object */
   {
     jerry_fatal (ERR_REF_COUNT_LIMIT);
   }
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  /* The object became a root after the roots of the current cycle were collected. */
+  if (JERRY_UNLIKELY (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK))
+  {
+    ecma_gc_shade_object (object_p);
+  }
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
 } /* ecma_ref_object */
 
 /**
@@ -546,7 +945,13 @@ static void
 ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
 {
   JERRY_ASSERT (object_p != NULL);
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE
+                ? ecma_gc_is_object_visited (object_p)
+                : ecma_gc_is_object_marked (object_p));
+#else /* !ENABLED (JERRY_INCREMENTAL_GC) */
   JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
 
   if (ecma_is_lexical_environment (object_p))
   {
@@ -1113,6 +1518,11 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
     if (ecma_get_lex_env_type (object_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
     {
       ecma_gc_free_properties (object_p);
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+      /* The environments remembered by the scope caches may be reallocated. */
+      JERRY_CONTEXT (vm_scope_cache_epoch)++;
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
     }
 
     ecma_dealloc_object (object_p);
@@ -1461,18 +1871,104 @@ ecma_gc_free_object (ecma_object_t *object_p) /**< object to free */
   ecma_dealloc_extended_object (object_p, ext_object_size);
 } /* ecma_gc_free_object */
 
+#if ENABLED (JERRY_INCREMENTAL_GC)
+
+/**
+ * Release the data structures of the incremental collector.
+ */
+static void
+ecma_gc_free_cycle_data (void)
+{
+  if (JERRY_CONTEXT (ecma_gc_worklist_p) != NULL)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_worklist_p),
+                          JERRY_CONTEXT (ecma_gc_worklist_capacity) * sizeof (jmem_cpointer_t));
+    JERRY_CONTEXT (ecma_gc_worklist_p) = NULL;
+  }
+
+  JERRY_CONTEXT (ecma_gc_worklist_size) = 0;
+  JERRY_CONTEXT (ecma_gc_worklist_capacity) = 0;
+  JERRY_CONTEXT (ecma_gc_worklist_overflow) = false;
+  JERRY_CONTEXT (ecma_gc_rescan_cp) = JMEM_CP_NULL;
+
+  if (JERRY_CONTEXT (ecma_gc_mark_bitmap_p) != NULL)
+  {
+    jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_mark_bitmap_p), ECMA_GC_HEAP_BITMAP_SIZE);
+    JERRY_CONTEXT (ecma_gc_mark_bitmap_p) = NULL;
+  }
+} /* ecma_gc_free_cycle_data */
+
+/**
+ * Abort the pending incremental collection cycle (if any).
+ */
+static void
+ecma_gc_abort_cycle (void)
+{
+  if (JERRY_LIKELY (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE))
+  {
+    return;
+  }
+
+  /* Objects which are not swept yet are moved back to the list of alive objects. */
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_sweep_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
+
+    obj_iter_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+    JERRY_CONTEXT (ecma_gc_objects_cp) = obj_iter_cp;
+
+    obj_iter_cp = obj_next_cp;
+  }
+
+  JERRY_CONTEXT (ecma_gc_sweep_cp) = JMEM_CP_NULL;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+
+  ecma_gc_free_cycle_data ();
+} /* ecma_gc_abort_cycle */
+
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
 /**
  * Run garbage collection, freeing objects that are no longer referenced.
+ *
+ * A minor collection only frees the objects of the young generation.
  */
-void
-ecma_gc_run (void)
+static void
+ecma_gc_collect (bool is_minor) /**< true - if only the young generation is collected */
 {
 #if (JERRY_GC_MARK_LIMIT != 0)
   JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_recursion_limit) == JERRY_GC_MARK_LIMIT);
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
 
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  /* A full collection supersedes the pending incremental cycle. */
+  JERRY_ASSERT (!is_minor || JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+  ecma_gc_abort_cycle ();
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
   JERRY_CONTEXT (ecma_gc_new_objects) = 0;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  JERRY_ASSERT (!is_minor || !JERRY_CONTEXT (ecma_gc_remembered_overflow));
+
+  /* Only the young objects are visited by a minor collection. */
+  const jmem_cpointer_t end_cp = is_minor ? JERRY_CONTEXT (ecma_gc_old_objects_cp) : JMEM_CP_NULL;
+  const jmem_cpointer_t *remembered_p = JERRY_CONTEXT (ecma_gc_remembered_p);
+  const jmem_cpointer_t *remembered_end_p = remembered_p + JERRY_CONTEXT (ecma_gc_remembered_size);
+
+  /* Remembered objects which are part of the young generation become roots. */
+  for (const jmem_cpointer_t *item_p = remembered_p; item_p < remembered_end_p; item_p++)
+  {
+    ecma_gc_clear_object_young (ECMA_GET_NON_NULL_POINTER (ecma_object_t, *item_p));
+  }
+#else /* !ENABLED (JERRY_GENERATIONAL_GC) */
+  JERRY_UNUSED (is_minor);
+  const jmem_cpointer_t end_cp = JMEM_CP_NULL;
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   ecma_object_t black_list_head;
   black_list_head.gc_next_cp = JMEM_CP_NULL;
   ecma_object_t *black_end_p = &black_list_head;
@@ -1485,7 +1981,7 @@ ecma_gc_run (void)
   ecma_object_t *obj_iter_p;
 
   /* Move root objects (i.e. they have global or stack references) to the black list. */
-  while (obj_iter_cp != JMEM_CP_NULL)
+  while (obj_iter_cp != end_cp)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
@@ -1493,7 +1989,13 @@ ecma_gc_run (void)
     JERRY_ASSERT (obj_prev_p == NULL
                   || ECMA_GET_NON_NULL_POINTER (ecma_object_t, obj_prev_p->gc_next_cp) == obj_iter_p);
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+    /* Promoted young objects might be referenced by old objects. */
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE
+        || (is_minor && !ecma_gc_is_object_young (obj_iter_p)))
+#else /* !ENABLED (JERRY_GENERATIONAL_GC) */
     if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
     {
       /* Moving the object to list of marked objects. */
       obj_prev_p->gc_next_cp = obj_next_cp;
@@ -1512,16 +2014,37 @@ ecma_gc_run (void)
 
   black_end_p->gc_next_cp = JMEM_CP_NULL;
 
+  /* The first chunk of the mark stack is reserved on the stack, so marking never fails to make progress. */
+  ecma_gc_mark_stack_chunk_t mark_stack_base;
+  mark_stack_base.prev_p = NULL;
+
+  JERRY_CONTEXT (ecma_gc_mark_stack_p) = &mark_stack_base;
+  JERRY_CONTEXT (ecma_gc_mark_stack_index) = 0;
+
   /* Mark root objects. */
   obj_iter_cp = black_list_head.gc_next_cp;
   while (obj_iter_cp != JMEM_CP_NULL)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     ecma_gc_mark (obj_iter_p);
+    ecma_gc_mark_stack_drain ();
     obj_iter_cp = obj_iter_p->gc_next_cp;
   }
 
-  /* Mark non-root objects. */
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  if (is_minor)
+  {
+    /* Mark the young objects referenced by the remembered old objects. */
+    for (const jmem_cpointer_t *item_p = remembered_p; item_p < remembered_end_p; item_p++)
+    {
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, *item_p));
+      ecma_gc_mark_stack_drain ();
+    }
+  }
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
+  /* Collect the marked non-root objects. Further iterations are only
+   * needed when the mark stack could not grow due to low memory. */
   bool marked_anything_during_current_iteration;
 
   do
@@ -1535,7 +2058,7 @@ ecma_gc_run (void)
     obj_prev_p = &white_gray_list_head;
     obj_iter_cp = obj_prev_p->gc_next_cp;
 
-    while (obj_iter_cp != JMEM_CP_NULL)
+    while (obj_iter_cp != end_cp)
     {
       obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
       const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
@@ -1551,17 +2074,14 @@ ecma_gc_run (void)
         black_end_p->gc_next_cp = obj_iter_cp;
         black_end_p = obj_iter_p;
 
-#if (JERRY_GC_MARK_LIMIT != 0)
         if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
         {
           /* Set the reference count of non-marked gray object to 0 */
           obj_iter_p->type_flags_refs = (uint16_t) (obj_iter_p->type_flags_refs & (ECMA_OBJECT_REF_ONE - 1));
           ecma_gc_mark (obj_iter_p);
+          ecma_gc_mark_stack_drain ();
           marked_anything_during_current_iteration = true;
         }
-#else /* (JERRY_GC_MARK_LIMIT == 0) */
-        marked_anything_during_current_iteration = true;
-#endif /* (JERRY_GC_MARK_LIMIT != 0) */
       }
       else
       {
@@ -1573,13 +2093,30 @@ ecma_gc_run (void)
   }
   while (marked_anything_during_current_iteration);
 
-  black_end_p->gc_next_cp = JMEM_CP_NULL;
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_mark_stack_p) == &mark_stack_base
+                && JERRY_CONTEXT (ecma_gc_mark_stack_index) == 0);
+  JERRY_CONTEXT (ecma_gc_mark_stack_p) = NULL;
+
+  black_end_p->gc_next_cp = end_cp;
   JERRY_CONTEXT (ecma_gc_objects_cp) = black_list_head.gc_next_cp;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  /* Objects might be remembered again by the native free callbacks. */
+  if (is_minor)
+  {
+    JERRY_CONTEXT (ecma_gc_remembered_size) = 0;
+  }
+  else
+  {
+    JERRY_CONTEXT (ecma_gc_remembered_overflow) = false;
+    ecma_gc_free_remembered_set ();
+  }
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   /* Sweep objects that are currently unmarked. */
   obj_iter_cp = white_gray_list_head.gc_next_cp;
 
-  while (obj_iter_cp != JMEM_CP_NULL)
+  while (obj_iter_cp != end_cp)
   {
     obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
     const jmem_cpointer_t obj_next_cp = obj_iter_p->gc_next_cp;
@@ -1590,12 +2127,361 @@ ecma_gc_run (void)
     obj_iter_cp = obj_next_cp;
   }
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  /* Promote the surviving young objects to the old generation. */
+  size_t promoted_objects = 0;
+  obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != end_cp)
+  {
+    obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+    ecma_gc_clear_object_young (obj_iter_p);
+    promoted_objects++;
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  if (is_minor)
+  {
+    JERRY_CONTEXT (ecma_gc_promoted_objects) += promoted_objects;
+  }
+  else
+  {
+    JERRY_CONTEXT (ecma_gc_promoted_objects) = 0;
+  }
+
+  JERRY_CONTEXT (ecma_gc_old_objects_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
 #if ENABLED (JERRY_BUILTIN_REGEXP)
-  /* Free RegExp bytecodes stored in cache */
-  re_cache_gc ();
+  /* Free RegExp bytecodes stored in cache, minor collections keep all of them */
+  if (!is_minor)
+  {
+    re_cache_gc ();
+  }
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+} /* ecma_gc_collect */
+
+/**
+ * Run full garbage collection, freeing objects that are no longer referenced.
+ */
+void
+ecma_gc_run (void)
+{
+  ecma_gc_collect (false);
 } /* ecma_gc_run */
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+
+/**
+ * Check whether the next garbage collection can be a minor collection.
+ *
+ * @return true  - if a minor collection is enough
+ *         false - if a full collection is needed
+ */
+static bool
+ecma_gc_is_minor_collection_allowed (void)
+{
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+  {
+    return false;
+  }
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
+  size_t promoted_objects_fraction = CONFIG_ECMA_GC_PROMOTED_OBJECTS_FRACTION;
+
+  return (!JERRY_CONTEXT (ecma_gc_remembered_overflow)
+          && (JERRY_CONTEXT (ecma_gc_promoted_objects) * promoted_objects_fraction
+              <= JERRY_CONTEXT (ecma_gc_objects_number)));
+} /* ecma_gc_is_minor_collection_allowed */
+
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+
+/**
+ * Start a new incremental collection cycle.
+ *
+ * @return true  - if the cycle is started
+ *         false - if there is not enough memory for the cycle
+ */
+static bool
+ecma_gc_start_cycle (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+
+  uint32_t *bitmap_p = (uint32_t *) jmem_heap_alloc_block_null_on_error (ECMA_GC_HEAP_BITMAP_SIZE);
+
+  if (bitmap_p == NULL)
+  {
+    return false;
+  }
+
+  size_t worklist_size = ECMA_GC_WORKLIST_MIN_CAPACITY * sizeof (jmem_cpointer_t);
+  jmem_cpointer_t *worklist_p = (jmem_cpointer_t *) jmem_heap_alloc_block_null_on_error (worklist_size);
+
+  if (worklist_p == NULL)
+  {
+    jmem_heap_free_block (bitmap_p, ECMA_GC_HEAP_BITMAP_SIZE);
+    return false;
+  }
+
+  /* The allocations above may run a full collection, but they never start a new cycle. */
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+
+  memset (bitmap_p, 0, ECMA_GC_HEAP_BITMAP_SIZE);
+
+  JERRY_CONTEXT (ecma_gc_mark_bitmap_p) = bitmap_p;
+  JERRY_CONTEXT (ecma_gc_worklist_p) = worklist_p;
+  JERRY_CONTEXT (ecma_gc_worklist_size) = 0;
+  JERRY_CONTEXT (ecma_gc_worklist_capacity) = ECMA_GC_WORKLIST_MIN_CAPACITY;
+  JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_MARK;
+  JERRY_CONTEXT (ecma_gc_new_objects) = 0;
+
+  /* Shade the root objects (i.e. they have global or stack references). */
+  jmem_cpointer_t obj_iter_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+  while (obj_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_object_t *obj_iter_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, obj_iter_cp);
+
+    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      ecma_gc_shade_object (obj_iter_p);
+    }
+
+    obj_iter_cp = obj_iter_p->gc_next_cp;
+  }
+
+  return true;
+} /* ecma_gc_start_cycle */
+
+/**
+ * Double the capacity of the worklist after it has overflowed.
+ *
+ * Note:
+ *      the allocation may finish or abort the current cycle
+ */
+static void
+ecma_gc_grow_worklist (void)
+{
+  uint32_t capacity = JERRY_CONTEXT (ecma_gc_worklist_capacity);
+
+  if (capacity >= ECMA_GC_WORKLIST_MAX_CAPACITY)
+  {
+    return;
+  }
+
+  size_t new_size = 2 * capacity * sizeof (jmem_cpointer_t);
+  jmem_cpointer_t *new_worklist_p = (jmem_cpointer_t *) jmem_heap_alloc_block_null_on_error (new_size);
+
+  if (new_worklist_p == NULL)
+  {
+    return;
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_MARK)
+  {
+    jmem_heap_free_block (new_worklist_p, new_size);
+    return;
+  }
+
+  /* The capacity cannot change during the allocation, only the content. */
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_worklist_capacity) == capacity);
+
+  memcpy (new_worklist_p,
+          JERRY_CONTEXT (ecma_gc_worklist_p),
+          JERRY_CONTEXT (ecma_gc_worklist_size) * sizeof (jmem_cpointer_t));
+  jmem_heap_free_block (JERRY_CONTEXT (ecma_gc_worklist_p), capacity * sizeof (jmem_cpointer_t));
+
+  JERRY_CONTEXT (ecma_gc_worklist_p) = new_worklist_p;
+  JERRY_CONTEXT (ecma_gc_worklist_capacity) = 2 * capacity;
+} /* ecma_gc_grow_worklist */
+
+/**
+ * Scan a single gray object of the current cycle.
+ *
+ * @return true  - if an object is scanned
+ *         false - if there are no gray objects left
+ */
+static bool
+ecma_gc_mark_step (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK);
+
+  if (JERRY_CONTEXT (ecma_gc_worklist_size) > 0)
+  {
+    jmem_cpointer_t object_cp = JERRY_CONTEXT (ecma_gc_worklist_p)[--JERRY_CONTEXT (ecma_gc_worklist_size)];
+    ecma_gc_mark (JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, object_cp));
+    return true;
+  }
+
+  if (JERRY_CONTEXT (ecma_gc_rescan_cp) == JMEM_CP_NULL)
+  {
+    if (!JERRY_CONTEXT (ecma_gc_worklist_overflow))
+    {
+      return false;
+    }
+
+    /* Some marked objects might not be scanned: rescan all of them. */
+    JERRY_CONTEXT (ecma_gc_worklist_overflow) = false;
+    JERRY_CONTEXT (ecma_gc_rescan_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+
+    return JERRY_CONTEXT (ecma_gc_rescan_cp) != JMEM_CP_NULL;
+  }
+
+  ecma_object_t *object_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, JERRY_CONTEXT (ecma_gc_rescan_cp));
+  JERRY_CONTEXT (ecma_gc_rescan_cp) = object_p->gc_next_cp;
+
+  if (ecma_gc_is_object_marked (object_p))
+  {
+    ecma_gc_mark (object_p);
+  }
+
+  return true;
+} /* ecma_gc_mark_step */
+
+/**
+ * Sweep a single object of the current cycle.
+ *
+ * @return true  - if an object is swept
+ *         false - if the cycle is completed
+ */
+static bool
+ecma_gc_sweep_step (void)
+{
+  JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_SWEEP);
+
+  jmem_cpointer_t object_cp = JERRY_CONTEXT (ecma_gc_sweep_cp);
+
+  if (object_cp == JMEM_CP_NULL)
+  {
+    JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_IDLE;
+    ecma_gc_free_cycle_data ();
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+    /* The sweeping reordered the list of objects, so the generations are merged by the next collection. */
+    JERRY_CONTEXT (ecma_gc_old_objects_cp) = JMEM_CP_NULL;
+    JERRY_CONTEXT (ecma_gc_remembered_overflow) = true;
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+    /* Free RegExp bytecodes stored in cache */
+    re_cache_gc ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+    return false;
+  }
+
+  ecma_object_t *object_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_object_t, object_cp);
+  JERRY_CONTEXT (ecma_gc_sweep_cp) = object_p->gc_next_cp;
+
+  if (ecma_gc_is_object_marked (object_p))
+  {
+    object_p->gc_next_cp = JERRY_CONTEXT (ecma_gc_objects_cp);
+    JERRY_CONTEXT (ecma_gc_objects_cp) = object_cp;
+    return true;
+  }
+
+  /* Referenced objects are always marked. */
+  JERRY_ASSERT (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
+
+  object_p->type_flags_refs |= ECMA_OBJECT_NON_VISITED;
+  ecma_gc_free_object (object_p);
+  return true;
+} /* ecma_gc_sweep_step */
+
+/**
+ * Perform a single unit of work of the current cycle.
+ *
+ * @return true  - if the cycle is still in progress
+ *         false - otherwise
+ */
+static bool
+ecma_gc_cycle_step (void)
+{
+  switch (JERRY_CONTEXT (ecma_gc_phase))
+  {
+    case ECMA_GC_PHASE_MARK:
+    {
+      if (!ecma_gc_mark_step ())
+      {
+        /* Every reachable object is marked: the rest of the objects are swept. */
+        JERRY_CONTEXT (ecma_gc_sweep_cp) = JERRY_CONTEXT (ecma_gc_objects_cp);
+        JERRY_CONTEXT (ecma_gc_objects_cp) = JMEM_CP_NULL;
+        JERRY_CONTEXT (ecma_gc_phase) = ECMA_GC_PHASE_SWEEP;
+      }
+      return true;
+    }
+    case ECMA_GC_PHASE_SWEEP:
+    {
+      return ecma_gc_sweep_step ();
+    }
+    default:
+    {
+      /* The cycle might be aborted by a full collection triggered by a native free callback. */
+      JERRY_ASSERT (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE);
+      return false;
+    }
+  }
+} /* ecma_gc_cycle_step */
+
+/**
+ * Perform incremental garbage collection work until the time budget is exhausted.
+ *
+ * A new collection cycle is started when no cycle is in progress.
+ *
+ * @return true  - if the collection cycle is completed
+ *         false - if the cycle is still in progress
+ */
+bool
+ecma_gc_step (uint32_t budget_us) /**< time budget in microseconds */
+{
+  if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_IDLE)
+  {
+    if (!ecma_gc_start_cycle ())
+    {
+      ecma_gc_run ();
+      return true;
+    }
+  }
+  else if (JERRY_CONTEXT (ecma_gc_phase) == ECMA_GC_PHASE_MARK
+           && JERRY_CONTEXT (ecma_gc_worklist_overflow))
+  {
+    ecma_gc_grow_worklist ();
+  }
+
+  double deadline = jerry_port_get_current_time () + (double) budget_us / 1000.0;
+  uint32_t work_count = 0;
+
+  while (ecma_gc_cycle_step ())
+  {
+    if (++work_count >= ECMA_GC_STEP_TIME_CHECK_INTERVAL)
+    {
+      if (jerry_port_get_current_time () >= deadline)
+      {
+        return false;
+      }
+
+      work_count = 0;
+    }
+  }
+
+  return true;
+} /* ecma_gc_step */
+
+/**
+ * Complete the pending incremental collection cycle (if any).
+ */
+void
+ecma_gc_finish_cycle (void)
+{
+  while (ecma_gc_cycle_step ())
+  {
+  }
+} /* ecma_gc_finish_cycle */
+
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
 /**
  * Try to free some memory (depending on memory pressure).
  *
@@ -1626,11 +2512,24 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
      * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
      * Otherwise, probability to free sufficient space is considered to be low.
      */
+#if ENABLED (JERRY_INCREMENTAL_GC)
+    if (JERRY_CONTEXT (ecma_gc_phase) != ECMA_GC_PHASE_IDLE)
+    {
+      /* The work already done by the pending cycle is not wasted. */
+      ecma_gc_finish_cycle ();
+      return;
+    }
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
     size_t new_objects_fraction = CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION;
 
     if (JERRY_CONTEXT (ecma_gc_new_objects) * new_objects_fraction > JERRY_CONTEXT (ecma_gc_objects_number))
     {
+#if ENABLED (JERRY_GENERATIONAL_GC)
+      ecma_gc_collect (ecma_gc_is_minor_collection_allowed ());
+#else /* !ENABLED (JERRY_GENERATIONAL_GC) */
       ecma_gc_run ();
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
     }
 
     return;
@@ -1638,6 +2537,14 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
   else if (pressure == JMEM_PRESSURE_HIGH)
   {
     /* Freeing as much memory as we currently can */
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+    ecma_string_index_cache_free ();
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+    re_cache_free ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
     if (JERRY_CONTEXT (status_flags) & ECMA_STATUS_HIGH_PRESSURE_GC)
     {
@@ -1688,6 +2595,9 @@ ecma_free_unused_memory (jmem_pressure_t pressure) /**< current pressure */
     }
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
+    /* Literal hash tables are rebuilt on demand. */
+    ecma_lit_storage_free_hash_tables ();
+
     jmem_pools_collect_empty ();
     return;
   }
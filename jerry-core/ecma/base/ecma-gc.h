@@ -33,6 +33,21 @@ void ecma_gc_free_properties (ecma_object_t *object_p);
 void ecma_gc_run (void);
 void ecma_free_unused_memory (jmem_pressure_t pressure);
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+void ecma_gc_write_barrier (ecma_object_t *holder_p, ecma_object_t *object_p);
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+bool ecma_gc_step (uint32_t budget_us);
+void ecma_gc_finish_cycle (void);
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+void ecma_gc_init (void);
+void ecma_gc_finalize (void);
+void ecma_gc_remember_object (ecma_object_t *holder_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
 /**
  * @}
  * @}
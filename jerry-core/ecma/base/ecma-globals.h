@@ -790,6 +790,34 @@ typedef enum
  */
 #define ECMA_OBJECT_MAX_REF (ECMA_OBJECT_NON_VISITED - ECMA_OBJECT_REF_ONE)
 
+/**
+ * Number of objects stored in a chunk of the garbage collector's mark stack.
+ */
+#define ECMA_GC_MARK_STACK_CHUNK_SIZE 64
+
+/**
+ * Chunk of the mark stack which holds the gray objects waiting to be marked.
+ */
+typedef struct ecma_gc_mark_stack_chunk_t
+{
+  struct ecma_gc_mark_stack_chunk_t *prev_p; /**< previous (full) chunk */
+  jmem_cpointer_t items[ECMA_GC_MARK_STACK_CHUNK_SIZE]; /**< gray objects */
+} ecma_gc_mark_stack_chunk_t;
+
+#if ENABLED (JERRY_INCREMENTAL_GC)
+
+/**
+ * Phases of an incremental garbage collection cycle.
+ */
+typedef enum
+{
+  ECMA_GC_PHASE_IDLE, /**< no collection cycle is in progress */
+  ECMA_GC_PHASE_MARK, /**< reachable objects are being marked */
+  ECMA_GC_PHASE_SWEEP, /**< unmarked objects are being freed */
+} ecma_gc_phase_t;
+
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+
 /**
  * Description of ECMA-object or lexical environment
  * (depending on is_lexical_environment).
@@ -1074,6 +1102,25 @@ typedef struct
  */
 #define ECMA_CONTAINER_PAIR_SIZE 2
 
+/**
+ * Hash index of the internal buffer of a container.
+ *
+ * The header is followed by (mask + 1) buckets. Each bucket contains zero
+ * if it is empty, or the offset of an entry (relative to ECMA_CONTAINER_START)
+ * increased by one. Buckets which refer to deleted entries are skipped by
+ * lookups and reused by insertions.
+ */
+typedef struct
+{
+  uint32_t mask; /**< number of buckets - 1 (the number of buckets is always a power of 2) */
+  uint32_t used; /**< number of non-empty buckets */
+} ecma_container_hash_index_t;
+
+/**
+ * Number of ecma values in the header of the internal buffer.
+ */
+#define ECMA_CONTAINER_HEADER_SIZE 2
+
 /**
  * Size of the internal buffer.
  */
@@ -1086,17 +1133,29 @@ typedef struct
 #define ECMA_CONTAINER_SET_SIZE(container_p, size) \
   (container_p->buffer_p[0] = (ecma_value_t) (size))
 
+/**
+ * Get the hash index of the internal buffer. Result can be NULL.
+ */
+#define ECMA_CONTAINER_GET_HASH_INDEX(container_p) \
+  ECMA_GET_INTERNAL_VALUE_ANY_POINTER (ecma_container_hash_index_t, container_p->buffer_p[1])
+
+/**
+ * Set the hash index of the internal buffer. Pointer can be NULL.
+ */
+#define ECMA_CONTAINER_SET_HASH_INDEX(container_p, index_p) \
+  ECMA_SET_INTERNAL_VALUE_ANY_POINTER (container_p->buffer_p[1], index_p)
+
 /**
  * Number of entries of the internal buffer.
  */
 #define ECMA_CONTAINER_ENTRY_COUNT(collection_p) \
-  (collection_p->item_count - 1)
+  (collection_p->item_count - ECMA_CONTAINER_HEADER_SIZE)
 
 /**
  * Pointer to the first entry of the internal buffer.
  */
 #define ECMA_CONTAINER_START(collection_p) \
-  (collection_p->buffer_p + 1)
+  (collection_p->buffer_p + ECMA_CONTAINER_HEADER_SIZE)
 
 #endif /* ENABLED (JERRY_BUILTIN_CONTAINER) */
 
@@ -1535,8 +1594,10 @@ typedef enum
                                             *   maximum size is 2^16. */
   ECMA_STRING_CONTAINER_MAGIC_STRING_EX, /**< the ecma-string is equal to one of external magic strings */
   ECMA_STRING_CONTAINER_SYMBOL, /**< the ecma-string is a symbol */
+  ECMA_STRING_CONTAINER_ROPE, /**< the ecma-string is a concatenation of two strings,
+                               *   whose characters are copied into a buffer when needed */
 
-  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_SYMBOL /**< maximum value */
+  ECMA_STRING_CONTAINER__MAX = ECMA_STRING_CONTAINER_ROPE /**< maximum value */
 } ecma_string_container_t;
 
 /**
@@ -1629,6 +1690,60 @@ typedef struct
   lit_utf8_size_t length; /**< length of this external string in characters */
 } ecma_long_string_t;
 
+#if ENABLED (JERRY_ROPE_STRING)
+
+/**
+ * Minimum size of a concatenation result which is represented as a rope string
+ */
+#define ECMA_ROPE_STRING_MIN_SIZE 256
+
+/**
+ * Rope string-value descriptor
+ */
+typedef struct
+{
+  ecma_long_string_t header; /**< long string header, string_p is NULL until the rope is flattened */
+  ecma_value_t left; /**< left part of the string (can be an unflattened rope) */
+  ecma_value_t right; /**< right part of the string (never an unflattened rope) */
+} ecma_rope_string_t;
+
+#endif /* ENABLED (JERRY_ROPE_STRING) */
+
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+
+/**
+ * Number of entries in the string index cache (must be a power of 2)
+ */
+#define ECMA_STRING_INDEX_CACHE_SIZE 4
+
+/**
+ * Logarithm of the number of code units between two cached byte offsets
+ */
+#define ECMA_STRING_INDEX_STEP_LOG2 5
+
+/**
+ * Number of code units between two cached byte offsets
+ */
+#define ECMA_STRING_INDEX_STEP (1u << ECMA_STRING_INDEX_STEP_LOG2)
+
+/**
+ * Minimum length of strings whose byte offsets are cached
+ */
+#define ECMA_STRING_INDEX_MIN_LENGTH (2 * ECMA_STRING_INDEX_STEP)
+
+/**
+ * String index cache entry: byte offsets of the code units of a non-ASCII string
+ */
+typedef struct
+{
+  const ecma_string_t *string_p; /**< indexed string, NULL if the entry is unused */
+  lit_utf8_size_t *offsets_p; /**< byte offsets of every ECMA_STRING_INDEX_STEP-th code unit */
+  lit_utf8_size_t count; /**< number of allocated byte offsets */
+  lit_utf8_size_t computed_count; /**< number of computed byte offsets */
+} ecma_string_index_entry_t;
+
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
 /**
  * External UTF8 string-value descriptor
  */
@@ -1786,6 +1901,31 @@ typedef struct
   jmem_cpointer_t values[ECMA_LIT_STORAGE_VALUE_COUNT]; /**< list of values */
 } ecma_lit_storage_item_t;
 
+/**
+ * Literal storage lists which are indexed by a hash table
+ */
+typedef enum
+{
+  ECMA_LIT_STORAGE_STRING, /**< literal string list */
+  ECMA_LIT_STORAGE_NUMBER, /**< literal number list */
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+  ECMA_LIT_STORAGE_BIGINT, /**< literal bigint list */
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+  ECMA_LIT_STORAGE__COUNT /**< number of indexed literal storage lists */
+} ecma_lit_storage_type_t;
+
+/**
+ * Hash table header of a literal storage list
+ *
+ * The header is followed by (mask + 1) compressed pointers, which refer to the values stored in the list.
+ * Empty buckets contain JMEM_CP_NULL.
+ */
+typedef struct
+{
+  uint32_t mask; /**< number of buckets - 1 (the number of buckets is always a power of 2) */
+  uint32_t count; /**< number of values in the table */
+} ecma_lit_hash_table_t;
+
 #if ENABLED (JERRY_LCACHE)
 /**
  * Container of an LCache entry identifier
@@ -1808,15 +1948,39 @@ typedef struct
   ecma_lcache_hash_entry_id_t id;
 } ecma_lcache_hash_entry_t;
 
+/**
+ * Replacement state of a row of LCache's hash table
+ *
+ * Rows are managed by the clock (second chance) algorithm: lookups set the referenced bit of the
+ * entry they hit, and the clock hand skips (and clears) referenced entries when choosing a victim.
+ */
+typedef struct
+{
+  uint8_t hand; /**< index of the next eviction candidate */
+  uint8_t referenced; /**< referenced bit of each entry of the row */
+} ecma_lcache_row_state_t;
+
+#if ENABLED (JERRY_MEM_STATS)
+/**
+ * LCache usage statistics
+ */
+typedef struct
+{
+  size_t hit_count; /**< number of successful lookups */
+  size_t miss_count; /**< number of failed lookups */
+  size_t eviction_count; /**< number of valid entries replaced by insertions */
+} ecma_lcache_stats_t;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 /**
  * Number of rows in LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROWS_COUNT 128
+#define ECMA_LCACHE_HASH_ROWS_COUNT JERRY_LCACHE_ROWS_COUNT
 
 /**
  * Number of entries in a row of LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROW_LENGTH 2
+#define ECMA_LCACHE_HASH_ROW_LENGTH JERRY_LCACHE_ROW_LENGTH
 
 #endif /* ENABLED (JERRY_LCACHE) */
 
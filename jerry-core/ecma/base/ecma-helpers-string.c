@@ -19,6 +19,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "jcontext.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -118,6 +119,209 @@ ecma_string_to_array_index (const lit_utf8_byte_t *string_p, /**< utf-8 string *
   return true;
 } /* ecma_string_to_array_index */
 
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+
+/**
+ * Get the string index cache entry of a string
+ */
+#define ECMA_STRING_INDEX_CACHE_ENTRY(string_p) \
+  (JERRY_CONTEXT (string_index_cache) \
+   + ((((uintptr_t) (string_p)) >> JMEM_ALIGNMENT_LOG) & (ECMA_STRING_INDEX_CACHE_SIZE - 1)))
+
+/**
+ * Free the byte offsets of a string index cache entry
+ */
+static void
+ecma_string_index_cache_free_entry (ecma_string_index_entry_t *entry_p) /**< string index cache entry */
+{
+  if (entry_p->string_p != NULL)
+  {
+    jmem_heap_free_block (entry_p->offsets_p, entry_p->count * sizeof (lit_utf8_size_t));
+    entry_p->string_p = NULL;
+  }
+} /* ecma_string_index_cache_free_entry */
+
+/**
+ * Remove a string from the string index cache
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_string_index_cache_remove (const ecma_string_t *string_p) /**< ecma-string */
+{
+  ecma_string_index_entry_t *entry_p = ECMA_STRING_INDEX_CACHE_ENTRY (string_p);
+
+  if (JERRY_UNLIKELY (entry_p->string_p == string_p))
+  {
+    ecma_string_index_cache_free_entry (entry_p);
+  }
+} /* ecma_string_index_cache_remove */
+
+/**
+ * Free the byte offsets of all strings in the string index cache
+ */
+void
+ecma_string_index_cache_free (void)
+{
+  for (uint32_t i = 0; i < ECMA_STRING_INDEX_CACHE_SIZE; i++)
+  {
+    ecma_string_index_cache_free_entry (JERRY_CONTEXT (string_index_cache) + i);
+  }
+} /* ecma_string_index_cache_free */
+
+/**
+ * Get a code unit of a non-ASCII string using the string index cache
+ *
+ * The byte offsets of every ECMA_STRING_INDEX_STEP-th code unit are computed up to
+ * the accessed code unit, so the following accesses decode less than
+ * ECMA_STRING_INDEX_STEP code units.
+ *
+ * @return code unit at the given index
+ */
+static ecma_char_t JERRY_ATTR_NOINLINE
+ecma_string_index_cache_get_char (const ecma_string_t *string_p, /**< ecma-string */
+                                  const lit_utf8_byte_t *data_p, /**< characters of the string */
+                                  lit_utf8_size_t size, /**< size of the string */
+                                  lit_utf8_size_t length, /**< length of the string */
+                                  lit_utf8_size_t index) /**< index of the code unit */
+{
+  ecma_string_index_entry_t *entry_p = ECMA_STRING_INDEX_CACHE_ENTRY (string_p);
+
+  if (entry_p->string_p != string_p)
+  {
+    lit_utf8_size_t count = ((length - 1) >> ECMA_STRING_INDEX_STEP_LOG2) + 1;
+    size_t offsets_size = count * sizeof (lit_utf8_size_t);
+    lit_utf8_size_t *offsets_p = (lit_utf8_size_t *) jmem_heap_alloc_block_null_on_error (offsets_size);
+
+    if (offsets_p == NULL)
+    {
+      return lit_utf8_string_code_unit_at (data_p, size, index);
+    }
+
+    ecma_string_index_cache_free_entry (entry_p);
+
+    offsets_p[0] = 0;
+    entry_p->string_p = string_p;
+    entry_p->offsets_p = offsets_p;
+    entry_p->count = count;
+    entry_p->computed_count = 1;
+  }
+
+  lit_utf8_size_t *offsets_p = entry_p->offsets_p;
+  lit_utf8_size_t step_index = index >> ECMA_STRING_INDEX_STEP_LOG2;
+  const lit_utf8_byte_t *current_p;
+
+  JERRY_ASSERT (step_index < entry_p->count);
+
+  if (step_index >= entry_p->computed_count)
+  {
+    lit_utf8_size_t computed_count = entry_p->computed_count;
+    current_p = data_p + offsets_p[computed_count - 1];
+
+    do
+    {
+      for (uint32_t i = 0; i < ECMA_STRING_INDEX_STEP; i++)
+      {
+        current_p += lit_get_unicode_char_size_by_utf8_first_byte (*current_p);
+      }
+
+      JERRY_ASSERT (current_p < data_p + size);
+      offsets_p[computed_count++] = (lit_utf8_size_t) (current_p - data_p);
+    }
+    while (computed_count <= step_index);
+
+    entry_p->computed_count = computed_count;
+  }
+  else
+  {
+    current_p = data_p + offsets_p[step_index];
+  }
+
+  for (lit_utf8_size_t skip = index & (ECMA_STRING_INDEX_STEP - 1); skip > 0; skip--)
+  {
+    current_p += lit_get_unicode_char_size_by_utf8_first_byte (*current_p);
+  }
+
+  ecma_char_t code_unit;
+  lit_read_code_unit_from_utf8 (current_p, &code_unit);
+  return code_unit;
+} /* ecma_string_index_cache_get_char */
+
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
+#if ENABLED (JERRY_ROPE_STRING)
+
+/**
+ * Checks whether the string is a rope whose characters are not copied into a buffer yet
+ *
+ * @return true - if the string is an unflattened rope,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_is_unflattened_rope (const ecma_string_t *string_p) /**< ecma-string */
+{
+  return (!ECMA_IS_DIRECT_STRING (string_p)
+          && ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE
+          && ((ecma_rope_string_t *) string_p)->header.string_p == NULL);
+} /* ecma_string_is_unflattened_rope */
+
+/**
+ * Copy the characters of an unflattened rope into a single buffer and release its parts
+ */
+static void JERRY_ATTR_NOINLINE
+ecma_rope_string_copy_chars (ecma_rope_string_t *rope_p) /**< rope string */
+{
+  lit_utf8_size_t size = rope_p->header.size;
+  lit_utf8_byte_t *buffer_p = (lit_utf8_byte_t *) ecma_alloc_string_buffer (size);
+  lit_utf8_byte_t *end_p = buffer_p + size;
+  ecma_string_t *part_p = (ecma_string_t *) rope_p;
+
+  /* The right parts are never unflattened ropes, so the parts are
+   * copied backwards while the chain of left parts is traversed. */
+  do
+  {
+    ecma_rope_string_t *part_rope_p = (ecma_rope_string_t *) part_p;
+    ecma_string_t *right_p = ecma_get_string_from_value (part_rope_p->right);
+    lit_utf8_size_t right_size = ecma_string_get_size (right_p);
+
+    end_p -= right_size;
+    JERRY_ASSERT (end_p > buffer_p);
+
+    lit_utf8_size_t copied_size = ecma_string_copy_to_cesu8_buffer (right_p, end_p, right_size);
+    JERRY_ASSERT (copied_size == right_size);
+    JERRY_UNUSED (copied_size);
+
+    part_p = ecma_get_string_from_value (part_rope_p->left);
+  }
+  while (ecma_string_is_unflattened_rope (part_p));
+
+  lit_utf8_size_t left_size = (lit_utf8_size_t) (end_p - buffer_p);
+  lit_utf8_size_t copied_size = ecma_string_copy_to_cesu8_buffer (part_p, buffer_p, left_size);
+  JERRY_ASSERT (copied_size == left_size);
+  JERRY_UNUSED (copied_size);
+
+  ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->left));
+  ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->right));
+
+  rope_p->header.string_p = buffer_p;
+} /* ecma_rope_string_copy_chars */
+
+/**
+ * Flatten a rope string: its characters are available in a single buffer after the call
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+ecma_rope_string_flatten (const ecma_string_t *string_p) /**< rope string */
+{
+  JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE);
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+  if (JERRY_UNLIKELY (rope_p->header.string_p == NULL))
+  {
+    ecma_rope_string_copy_chars (rope_p);
+  }
+} /* ecma_rope_string_flatten */
+
+#endif /* ENABLED (JERRY_ROPE_STRING) */
+
 /**
  * Returns the characters and size of a string.
  *
@@ -159,6 +363,13 @@ ecma_string_get_chars_fast (const ecma_string_t *string_p, /**< ecma-string */
       *size_p = ((ecma_short_string_t *) string_p)->size;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+#if ENABLED (JERRY_ROPE_STRING)
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_flatten (string_p);
+      /* FALLTHRU */
+    }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -776,6 +987,139 @@ ecma_append_chars_to_string (ecma_string_t *string1_p, /**< base ecma-string */
   return (ecma_string_t *) string_desc_p;
 } /* ecma_append_chars_to_string */
 
+#if ENABLED (JERRY_ROPE_STRING)
+
+/**
+ * Quick check whether the concatenation of two strings can be long enough to be represented by a rope
+ *
+ * Note:
+ *   the check is done before the size of string1_p is computed, since most concatenations are short
+ *
+ * @return true - if the concatenation can be a rope string,
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_string_may_concat_to_rope (const ecma_string_t *string1_p, /**< first ecma-string */
+                                lit_utf8_size_t cesu8_string2_size) /**< byte size of the second string */
+{
+  if (cesu8_string2_size >= ECMA_ROPE_STRING_MIN_SIZE)
+  {
+    return true;
+  }
+
+  if (ECMA_IS_DIRECT_STRING (string1_p))
+  {
+    /* Only external magic strings can be long direct strings. */
+    return (ECMA_GET_DIRECT_STRING_TYPE (string1_p) == ECMA_DIRECT_STRING_MAGIC
+            && ECMA_GET_DIRECT_STRING_VALUE (string1_p) >= LIT_MAGIC_STRING__COUNT);
+  }
+
+  switch (ECMA_STRING_GET_CONTAINER (string1_p))
+  {
+    case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
+    {
+      return ((ecma_short_string_t *) string1_p)->size + cesu8_string2_size >= ECMA_ROPE_STRING_MIN_SIZE;
+    }
+    case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
+    {
+      return ECMA_ASCII_STRING_GET_SIZE (string1_p) + cesu8_string2_size >= ECMA_ROPE_STRING_MIN_SIZE;
+    }
+    case ECMA_STRING_CONTAINER_UINT32_IN_DESC:
+    {
+      return false;
+    }
+    default:
+    {
+      return true;
+    }
+  }
+} /* ecma_string_may_concat_to_rope */
+
+/**
+ * Concatenate ecma-strings into a rope string
+ *
+ * Note:
+ *   The string1_p argument is freed when a rope string is created.
+ *
+ * @return rope string - if the concatenation can be represented by a rope
+ *         NULL - otherwise
+ */
+static ecma_string_t * JERRY_ATTR_NOINLINE
+ecma_concat_ecma_strings_to_rope (ecma_string_t *string1_p, /**< first ecma-string */
+                                  ecma_string_t *string2_p, /**< second ecma-string */
+                                  const lit_utf8_byte_t *cesu8_string2_p, /**< characters of string2_p */
+                                  lit_utf8_size_t cesu8_string2_size, /**< byte size of cesu8_string2_p */
+                                  lit_utf8_size_t cesu8_string2_length) /**< character length of cesu8_string2_p */
+{
+  lit_utf8_size_t string1_size = ecma_string_get_size (string1_p);
+  lit_utf8_size_t new_size = string1_size + cesu8_string2_size;
+
+  JERRY_ASSERT (new_size >= ECMA_ROPE_STRING_MIN_SIZE);
+
+  /* Magic strings are shorter than the minimum size of ropes, but external magic strings can be longer.
+   * The overflow of the size is reported by ecma_append_chars_to_string. */
+  if (new_size < string1_size
+      || (lit_get_magic_string_ex_count () > 0
+          && new_size <= lit_get_magic_string_ex_size (lit_get_magic_string_ex_count () - 1)))
+  {
+    return NULL;
+  }
+
+  lit_string_hash_t hash_start;
+
+  if (ECMA_IS_DIRECT_STRING (string1_p)
+      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
+      || ECMA_STRING_GET_CONTAINER (string1_p) == ECMA_STRING_CONTAINER_MAGIC_STRING_EX)
+  {
+    ECMA_STRING_TO_UTF8_STRING (string1_p, string1_chars_p, string1_chars_size);
+    hash_start = lit_utf8_string_calc_hash (string1_chars_p, string1_chars_size);
+    ECMA_FINALIZE_UTF8_STRING (string1_chars_p, string1_chars_size);
+  }
+  else
+  {
+    hash_start = string1_p->u.hash;
+  }
+
+  ecma_rope_string_t *rope_p = (ecma_rope_string_t *) ecma_alloc_string_buffer (sizeof (ecma_rope_string_t));
+
+  rope_p->header.header.refs_and_container = ECMA_STRING_CONTAINER_ROPE | ECMA_STRING_REF_ONE;
+  rope_p->header.header.u.hash = lit_utf8_string_hash_combine (hash_start, cesu8_string2_p, cesu8_string2_size);
+  rope_p->header.string_p = NULL;
+  rope_p->header.size = new_size;
+  rope_p->header.length = ecma_string_get_length (string1_p) + cesu8_string2_length;
+
+  if (ecma_string_is_unflattened_rope (string1_p))
+  {
+    ecma_rope_string_t *rope1_p = (ecma_rope_string_t *) string1_p;
+    ecma_string_t *right_p = ecma_get_string_from_value (rope1_p->right);
+
+    /* Short strings are appended to the right part of the rope, so the chain of ropes grows by large steps. */
+    if (ecma_string_get_size (right_p) + cesu8_string2_size < ECMA_ROPE_STRING_MIN_SIZE)
+    {
+      ecma_string_t *left_p = ecma_get_string_from_value (rope1_p->left);
+
+      ecma_ref_ecma_string (left_p);
+      ecma_ref_ecma_string (right_p);
+      ecma_deref_ecma_string (string1_p);
+
+      rope_p->left = ecma_make_string_value (left_p);
+      rope_p->right = ecma_make_string_value (ecma_append_chars_to_string (right_p,
+                                                                           cesu8_string2_p,
+                                                                           cesu8_string2_size,
+                                                                           cesu8_string2_length));
+      return (ecma_string_t *) rope_p;
+    }
+  }
+
+  ecma_ref_ecma_string (string2_p);
+
+  rope_p->left = ecma_make_string_value (string1_p);
+  rope_p->right = ecma_make_string_value (string2_p);
+  return (ecma_string_t *) rope_p;
+} /* ecma_concat_ecma_strings_to_rope */
+
+#endif /* ENABLED (JERRY_ROPE_STRING) */
+
 /**
  * Concatenate ecma-strings
  *
@@ -813,14 +1157,30 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
                                                                   &flags);
 
   JERRY_ASSERT (cesu8_string2_p != NULL);
+  JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
+
+#if ENABLED (JERRY_ROPE_STRING)
+  /* The characters of string2_p are already available, so the right part of a rope is never an unflattened rope. */
+  if (ecma_string_may_concat_to_rope (string1_p, cesu8_string2_size))
+  {
+    ecma_string_t *rope_p = ecma_concat_ecma_strings_to_rope (string1_p,
+                                                              string2_p,
+                                                              cesu8_string2_p,
+                                                              cesu8_string2_size,
+                                                              cesu8_string2_length);
+
+    if (rope_p != NULL)
+    {
+      return rope_p;
+    }
+  }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
 
   ecma_string_t *result_p = ecma_append_chars_to_string (string1_p,
                                                          cesu8_string2_p,
                                                          cesu8_string2_size,
                                                          cesu8_string2_length);
 
-  JERRY_ASSERT (!(flags & ECMA_STRING_FLAG_MUST_BE_FREED));
-
   return result_p;
 } /* ecma_concat_ecma_strings */
 
@@ -891,6 +1251,46 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
   ecma_destroy_ecma_string (string_p);
 } /* ecma_deref_ecma_string */
 
+#if ENABLED (JERRY_ROPE_STRING)
+
+/**
+ * Deallocate a rope string
+ *
+ * Note:
+ *   the chain of unflattened left parts is freed iteratively, since it can be very long
+ */
+static void
+ecma_destroy_rope_string (ecma_string_t *string_p) /**< rope string */
+{
+  while (true)
+  {
+    ecma_rope_string_t *rope_p = (ecma_rope_string_t *) string_p;
+
+    if (rope_p->header.string_p != NULL)
+    {
+      ecma_dealloc_string_buffer ((ecma_string_t *) rope_p->header.string_p, rope_p->header.size);
+      ecma_dealloc_string_buffer (string_p, sizeof (ecma_rope_string_t));
+      return;
+    }
+
+    ecma_string_t *left_p = ecma_get_string_from_value (rope_p->left);
+
+    ecma_deref_ecma_string (ecma_get_string_from_value (rope_p->right));
+    ecma_dealloc_string_buffer (string_p, sizeof (ecma_rope_string_t));
+
+    if (!ecma_string_is_unflattened_rope (left_p) || !ECMA_STRING_IS_REF_EQUALS_TO_ONE (left_p))
+    {
+      ecma_deref_ecma_string (left_p);
+      return;
+    }
+
+    left_p->refs_and_container -= ECMA_STRING_REF_ONE;
+    string_p = left_p;
+  }
+} /* ecma_destroy_rope_string */
+
+#endif /* ENABLED (JERRY_ROPE_STRING) */
+
 /**
  * Deallocate an ecma-string
  */
@@ -901,6 +1301,10 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
   JERRY_ASSERT (!ECMA_IS_DIRECT_STRING (string_p));
   JERRY_ASSERT ((string_p->refs_and_container < ECMA_STRING_REF_ONE) || ECMA_STRING_IS_STATIC (string_p));
 
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+  ecma_string_index_cache_remove (string_p);
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
   switch (ECMA_STRING_GET_CONTAINER (string_p))
   {
     case ECMA_STRING_CONTAINER_HEAP_UTF8_STRING:
@@ -942,6 +1346,13 @@ ecma_destroy_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       return;
     }
 #endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_ROPE_STRING)
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_destroy_rope_string (string_p);
+      return;
+    }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
     default:
     {
       JERRY_ASSERT (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC
@@ -1494,6 +1905,13 @@ ecma_string_get_chars (const ecma_string_t *string_p, /**< ecma-string */
         result_p = ECMA_SHORT_STRING_GET_BUFFER (short_string_p);
         break;
       }
+#if ENABLED (JERRY_ROPE_STRING)
+      case ECMA_STRING_CONTAINER_ROPE:
+      {
+        ecma_rope_string_flatten (string_p);
+        /* FALLTHRU */
+      }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
       case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
       {
         ecma_long_string_t *long_string_desc_p = (ecma_long_string_t *) string_p;
@@ -1749,6 +2167,13 @@ ecma_compare_get_string_chars (const ecma_string_t *string_p, /**< ecma-string *
       size_and_length_p[1] = short_string_p->length;
       return ECMA_SHORT_STRING_GET_BUFFER (string_p);
     }
+#if ENABLED (JERRY_ROPE_STRING)
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_flatten (string_p);
+      /* FALLTHRU */
+    }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -2051,7 +2476,8 @@ ecma_string_get_length (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->length;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     return ((ecma_long_string_t *) string_p)->length;
   }
@@ -2101,7 +2527,8 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_length_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
     lit_utf8_size_t size = long_string_p->size;
@@ -2111,6 +2538,13 @@ ecma_string_get_utf8_length (const ecma_string_t *string_p) /**< ecma-string */
       return size;
     }
 
+#if ENABLED (JERRY_ROPE_STRING)
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      ecma_rope_string_flatten (string_p);
+    }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
+
     return lit_get_utf8_length_of_cesu8_string (long_string_p->string_p, size);
   }
 
@@ -2150,7 +2584,8 @@ ecma_string_get_size (const ecma_string_t *string_p) /**< ecma-string */
     return ((ecma_short_string_t *) string_p)->size;
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     return ((ecma_long_string_t *) string_p)->size;
   }
@@ -2198,7 +2633,8 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
     return lit_get_utf8_size_of_cesu8_string (ECMA_SHORT_STRING_GET_BUFFER (string_p), size);
   }
 
-  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING)
+  if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING
+      || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
   {
     ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
 
@@ -2207,6 +2643,13 @@ ecma_string_get_utf8_size (const ecma_string_t *string_p) /**< ecma-string */
       return long_string_p->size;
     }
 
+#if ENABLED (JERRY_ROPE_STRING)
+    if (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_ROPE)
+    {
+      ecma_rope_string_flatten (string_p);
+    }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
+
     return lit_get_utf8_size_of_cesu8_string (long_string_p->string_p, long_string_p->size);
   }
 
@@ -2297,8 +2740,22 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+      if (index >= ECMA_STRING_INDEX_STEP && short_string_p->length >= ECMA_STRING_INDEX_MIN_LENGTH)
+      {
+        return ecma_string_index_cache_get_char (string_p, data_p, size, short_string_p->length, index);
+      }
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
       return lit_utf8_string_code_unit_at (data_p, size, index);
     }
+#if ENABLED (JERRY_ROPE_STRING)
+    case ECMA_STRING_CONTAINER_ROPE:
+    {
+      ecma_rope_string_flatten (string_p);
+      /* FALLTHRU */
+    }
+#endif /* ENABLED (JERRY_ROPE_STRING) */
     case ECMA_STRING_CONTAINER_LONG_OR_EXTERNAL_STRING:
     {
       ecma_long_string_t *long_string_p = (ecma_long_string_t *) string_p;
@@ -2310,6 +2767,13 @@ ecma_string_get_char_at_pos (const ecma_string_t *string_p, /**< ecma-string */
         return (ecma_char_t) data_p[index];
       }
 
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+      if (index >= ECMA_STRING_INDEX_STEP && long_string_p->length >= ECMA_STRING_INDEX_MIN_LENGTH)
+      {
+        return ecma_string_index_cache_get_char (string_p, data_p, size, long_string_p->length, index);
+      }
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
       return lit_utf8_string_code_unit_at (data_p, size, index);
     }
     case ECMA_STRING_CONTAINER_HEAP_ASCII_STRING:
@@ -954,9 +954,41 @@ ecma_copy_value_if_not_object (ecma_value_t value) /**< value description */
     return ecma_copy_value (value);
   }
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+  /* Object references copied this way are stored into other objects. */
+  ecma_gc_write_barrier (NULL, ecma_get_object_from_value (value));
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
   return value;
 } /* ecma_copy_value_if_not_object */
 
+/**
+ * Copy the ecma value if not an object, which is stored into the given holder object
+ *
+ * Note:
+ *      unlike ecma_copy_value_if_not_object, the write barrier
+ *      of the garbage collector also gets the holder object
+ *
+ * @return copy of the given value
+ */
+inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
+ecma_copy_value_if_not_object_into (ecma_object_t *holder_p, /**< holder object */
+                                    ecma_value_t value) /**< value description */
+{
+  if (!ecma_is_value_object (value))
+  {
+    return ecma_copy_value (value);
+  }
+
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+  ecma_gc_write_barrier (holder_p, ecma_get_object_from_value (value));
+#else /* !ENABLED (JERRY_GC_WRITE_BARRIER) */
+  JERRY_UNUSED (holder_p);
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
+  return value;
+} /* ecma_copy_value_if_not_object_into */
+
 /**
  * Increase reference counter of a value if it is an object.
  */
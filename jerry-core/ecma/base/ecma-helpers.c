@@ -25,6 +25,7 @@
 #include "byte-code.h"
 #include "re-compiler.h"
 #include "ecma-builtins.h"
+#include "vm-scope-cache.h"
 
 #if ENABLED (JERRY_DEBUGGER)
 #include "debugger.h"
@@ -530,7 +531,15 @@ ecma_create_named_data_property (ecma_object_t *object_p, /**< object */
   ecma_property_value_t value;
   value.value = ECMA_VALUE_UNDEFINED;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_property_value_t *prop_value_p = ecma_create_property (object_p, name_p, type_and_flags, value, out_prop_p);
+
+  /* The value of the new property is stored by the caller without a write barrier. */
+  ecma_gc_remember_object (object_p);
+  return prop_value_p;
+#else /* !ENABLED (JERRY_GENERATIONAL_GC) */
   return ecma_create_property (object_p, name_p, type_and_flags, value, out_prop_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
 } /* ecma_create_named_data_property */
 
 /**
@@ -555,6 +564,18 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
 
   uint8_t type_and_flags = ECMA_PROPERTY_TYPE_NAMEDACCESSOR | prop_attributes;
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+  if (get_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, get_p);
+  }
+
+  if (set_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, set_p);
+  }
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
   ecma_property_value_t value;
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
@@ -963,6 +984,15 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
 {
   ecma_assert_object_contains_the_property (obj_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDDATA);
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+  if (ecma_is_value_object (value))
+  {
+    ecma_free_value_if_not_object (prop_value_p->value);
+    prop_value_p->value = ecma_copy_value_if_not_object_into (obj_p, value);
+    return;
+  }
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
   ecma_value_assign_value (&prop_value_p->value, value);
 } /* ecma_named_data_property_assign_value */
 
@@ -991,6 +1021,13 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+  if (getter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, getter_p);
+  }
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
   getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
@@ -1011,6 +1048,13 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
 {
   ecma_assert_object_contains_the_property (object_p, prop_value_p, ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
+#if ENABLED (JERRY_GC_WRITE_BARRIER)
+  if (setter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, setter_p);
+  }
+#endif /* ENABLED (JERRY_GC_WRITE_BARRIER) */
+
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   ecma_getter_setter_pointers_t *getter_setter_pair_p;
   getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
@@ -1480,6 +1524,14 @@ ecma_bytecode_deref (ecma_compiled_code_t *bytecode_p) /**< byte code pointer */
     }
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if ENABLED (JERRY_SCOPE_CACHE)
+    if (bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+    {
+      /* A byte code allocated later at the same address may have a different scope chain. */
+      vm_scope_cache_invalidate ();
+    }
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
 #if ENABLED (JERRY_MEM_STATS)
     jmem_stats_free_byte_code_bytes (((size_t) bytecode_p->size) << JMEM_ALIGNMENT_LOG);
 #endif /* ENABLED (JERRY_MEM_STATS) */
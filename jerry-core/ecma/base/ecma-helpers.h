@@ -299,6 +299,7 @@ ecma_value_t JERRY_ATTR_CONST ecma_invert_boolean_value (ecma_value_t value);
 ecma_value_t ecma_copy_value (ecma_value_t value);
 ecma_value_t ecma_fast_copy_value (ecma_value_t value);
 ecma_value_t ecma_copy_value_if_not_object (ecma_value_t value);
+ecma_value_t ecma_copy_value_if_not_object_into (ecma_object_t *holder_p, ecma_value_t value);
 void ecma_ref_if_object (ecma_value_t value);
 void ecma_deref_if_object (ecma_value_t value);
 ecma_value_t ecma_update_float_number (ecma_value_t float_value, ecma_number_t new_number);
@@ -392,6 +393,9 @@ lit_utf8_size_t ecma_string_get_utf8_length (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_size (const ecma_string_t *string_p);
 lit_utf8_size_t ecma_string_get_utf8_size (const ecma_string_t *string_p);
 ecma_char_t ecma_string_get_char_at_pos (const ecma_string_t *string_p, lit_utf8_size_t index);
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+void ecma_string_index_cache_free (void);
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
 
 lit_magic_string_id_t ecma_get_string_magic (const ecma_string_t *string_p);
 
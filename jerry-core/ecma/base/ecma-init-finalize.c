@@ -17,9 +17,11 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-lcache.h"
 #include "ecma-lex-env.h"
 #include "ecma-literal-storage.h"
 #include "jmem.h"
+#include "re-compiler.h"
 #include "jcontext.h"
 
 /** \addtogroup ecma ECMA
@@ -44,6 +46,10 @@ ecma_init (void)
   JERRY_CONTEXT (ecma_gc_mark_recursion_limit) = JERRY_GC_MARK_LIMIT;
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_gc_init ();
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   ecma_init_global_environment ();
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
@@ -89,7 +95,30 @@ ecma_finalize (void)
     }
   }
   while (JERRY_CONTEXT (ecma_gc_new_objects) != 0);
+
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  re_cache_free ();
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_gc_finalize ();
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   ecma_finalize_lit_storage ();
+
+#if ENABLED (JERRY_LCACHE) && ENABLED (JERRY_MEM_STATS)
+  if (JERRY_CONTEXT (jerry_init_flags) & ECMA_INIT_MEM_STATS)
+  {
+    ecma_lcache_stats_print ();
+  }
+#endif /* ENABLED (JERRY_LCACHE) && ENABLED (JERRY_MEM_STATS) */
+
+#if ENABLED (JERRY_BUILTIN_REGEXP) && ENABLED (JERRY_MEM_STATS)
+  if (JERRY_CONTEXT (jerry_init_flags) & ECMA_INIT_MEM_STATS)
+  {
+    re_cache_stats_print ();
+  }
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) && ENABLED (JERRY_MEM_STATS) */
 } /* ecma_finalize */
 
 /**
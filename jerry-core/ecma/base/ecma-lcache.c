@@ -83,6 +83,8 @@ ecma_lcache_row_index (jmem_cpointer_t object_cp, /**< compressed pointer to obj
 
 /**
  * Insert an entry into LCache
+ *
+ * When the row is full, the victim entry is chosen by the clock algorithm.
  */
 void
 ecma_lcache_insert (const ecma_object_t *object_p, /**< object */
@@ -100,36 +102,46 @@ ecma_lcache_insert (const ecma_object_t *object_p, /**< object */
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
   size_t row_index = ecma_lcache_row_index (object_cp, name_cp);
-  ecma_lcache_hash_entry_t *entry_p = JERRY_CONTEXT (lcache) [row_index];
-  ecma_lcache_hash_entry_t *entry_end_p = entry_p + ECMA_LCACHE_HASH_ROW_LENGTH;
+  ecma_lcache_hash_entry_t *row_p = JERRY_CONTEXT (lcache) [row_index];
+  ecma_lcache_row_state_t *row_state_p = JERRY_CONTEXT (lcache_row_state) + row_index;
+  uint32_t entry_index = 0;
 
   do
   {
-    if (entry_p->id == 0)
+    if (row_p[entry_index].id == 0)
     {
       goto insert;
     }
 
-    entry_p++;
+    entry_index++;
   }
-  while (entry_p < entry_end_p);
+  while (entry_index < ECMA_LCACHE_HASH_ROW_LENGTH);
 
-  /* Invalidate the last entry. */
-  ecma_lcache_invalidate_entry (--entry_p);
+  /* Advance the clock hand to the first entry which was not referenced since the
+   * hand passed it last time. The loop terminates after at most one full turn. */
+  entry_index = row_state_p->hand;
 
-  /* Shift other entries towards the end. */
-  for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH - 1; i++)
+  while (row_state_p->referenced & (1u << entry_index))
   {
-    entry_p->id = entry_p[-1].id;
-    entry_p->prop_p = entry_p[-1].prop_p;
-    entry_p--;
+    row_state_p->referenced = (uint8_t) (row_state_p->referenced & ~(1u << entry_index));
+    entry_index = (entry_index + 1) % ECMA_LCACHE_HASH_ROW_LENGTH;
   }
 
+  row_state_p->hand = (uint8_t) ((entry_index + 1) % ECMA_LCACHE_HASH_ROW_LENGTH);
+
+  ecma_lcache_invalidate_entry (row_p + entry_index);
+
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (lcache_stats).eviction_count++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 insert:
-  entry_p->prop_p = prop_p;
-  entry_p->id = ECMA_LCACHE_CREATE_ID (object_cp, name_cp);
+  row_state_p->referenced = (uint8_t) (row_state_p->referenced & ~(1u << entry_index));
+
+  row_p[entry_index].prop_p = prop_p;
+  row_p[entry_index].id = ECMA_LCACHE_CREATE_ID (object_cp, name_cp);
 
-  ecma_set_property_lcached (entry_p->prop_p, true);
+  ecma_set_property_lcached (prop_p, true);
 } /* ecma_lcache_insert */
 
 /**
@@ -163,21 +175,33 @@ ecma_lcache_lookup (const ecma_object_t *object_p, /**< object */
 
   size_t row_index = ecma_lcache_row_index (object_cp, prop_name_cp);
 
-  ecma_lcache_hash_entry_t *entry_p = JERRY_CONTEXT (lcache) [row_index];
-  ecma_lcache_hash_entry_t *entry_end_p = entry_p + ECMA_LCACHE_HASH_ROW_LENGTH;
+  ecma_lcache_hash_entry_t *row_p = JERRY_CONTEXT (lcache) [row_index];
   ecma_lcache_hash_entry_id_t id = ECMA_LCACHE_CREATE_ID (object_cp, prop_name_cp);
+  uint32_t entry_index = 0;
 
   do
   {
+    ecma_lcache_hash_entry_t *entry_p = row_p + entry_index;
+
     if (entry_p->id == id && JERRY_LIKELY (ECMA_PROPERTY_GET_NAME_TYPE (*entry_p->prop_p) == prop_name_type))
     {
       JERRY_ASSERT (entry_p->prop_p != NULL && ecma_is_property_lcached (entry_p->prop_p));
+
+      ecma_lcache_row_state_t *row_state_p = JERRY_CONTEXT (lcache_row_state) + row_index;
+      row_state_p->referenced = (uint8_t) (row_state_p->referenced | (1u << entry_index));
+
+#if ENABLED (JERRY_MEM_STATS)
+      JERRY_CONTEXT (lcache_stats).hit_count++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
       return entry_p->prop_p;
     }
-    entry_p++;
+    entry_index++;
   }
-  while (entry_p < entry_end_p);
+  while (entry_index < ECMA_LCACHE_HASH_ROW_LENGTH);
 
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (lcache_stats).miss_count++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
   return NULL;
 } /* ecma_lcache_lookup */
 
@@ -217,6 +241,28 @@ ecma_lcache_invalidate (const ecma_object_t *object_p, /**< object */
   }
 } /* ecma_lcache_invalidate */
 
+#if ENABLED (JERRY_MEM_STATS)
+/**
+ * Print LCache usage statistics
+ */
+void
+ecma_lcache_stats_print (void)
+{
+  ecma_lcache_stats_t *lcache_stats_p = &JERRY_CONTEXT (lcache_stats);
+
+  JERRY_DEBUG_MSG ("Property lookup cache stats:\n"
+                   "  Rows = %u, Row length = %u\n"
+                   "  Hits = %zu\n"
+                   "  Misses = %zu\n"
+                   "  Evictions = %zu\n",
+                   (unsigned int) ECMA_LCACHE_HASH_ROWS_COUNT,
+                   (unsigned int) ECMA_LCACHE_HASH_ROW_LENGTH,
+                   lcache_stats_p->hit_count,
+                   lcache_stats_p->miss_count,
+                   lcache_stats_p->eviction_count);
+} /* ecma_lcache_stats_print */
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 #endif /* ENABLED (JERRY_LCACHE) */
 
 /**
@@ -28,6 +28,10 @@ void ecma_lcache_insert (const ecma_object_t *object_p, const jmem_cpointer_t na
 ecma_property_t *ecma_lcache_lookup (const ecma_object_t *object_p, const ecma_string_t *prop_name_p);
 void ecma_lcache_invalidate (const ecma_object_t *object_p, const jmem_cpointer_t name_cp, ecma_property_t *prop_p);
 
+#if ENABLED (JERRY_MEM_STATS)
+void ecma_lcache_stats_print (void);
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 #endif /* ENABLED (JERRY_LCACHE) */
 
 /**
@@ -143,242 +143,483 @@ ecma_free_bigint_list (jmem_cpointer_t bigint_list_cp) /**< bigint list */
 #endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
 
 /**
- * Finalize literal storage
+ * Minimum number of values in a literal list before a hash table is built for it.
+ * Shorter lists are searched linearly.
  */
-void
-ecma_finalize_lit_storage (void)
+#define ECMA_LIT_HASH_TABLE_THRESHOLD 16
+
+/**
+ * Minimum number of buckets in a literal hash table.
+ */
+#define ECMA_LIT_HASH_TABLE_MIN_SIZE 32
+
+/**
+ * Get the buckets of a literal hash table.
+ */
+#define ECMA_LIT_HASH_TABLE_GET_BUCKETS(table_p) \
+  ((jmem_cpointer_t *) (((ecma_lit_hash_table_t *) (table_p)) + 1))
+
+/**
+ * Get the allocated size of a literal hash table.
+ */
+#define ECMA_LIT_HASH_TABLE_GET_SIZE(table_p) \
+  (sizeof (ecma_lit_hash_table_t) + (((size_t) (table_p)->mask + 1) * sizeof (jmem_cpointer_t)))
+
+/**
+ * Get the first item of a literal storage list.
+ *
+ * @return pointer to the compressed pointer of the first list item
+ */
+static jmem_cpointer_t *
+ecma_lit_storage_get_list (ecma_lit_storage_type_t type) /**< literal storage type */
 {
-#if ENABLED (JERRY_ESNEXT)
-  ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
-#endif /* ENABLED (JERRY_ESNEXT) */
-  ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
-  ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
+  switch (type)
+  {
+    case ECMA_LIT_STORAGE_STRING:
+    {
+      return &JERRY_CONTEXT (string_list_first_cp);
+    }
 #if ENABLED (JERRY_BUILTIN_BIGINT)
-  ecma_free_bigint_list (JERRY_CONTEXT (bigint_list_first_cp));
+    case ECMA_LIT_STORAGE_BIGINT:
+    {
+      return &JERRY_CONTEXT (bigint_list_first_cp);
+    }
 #endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
-} /* ecma_finalize_lit_storage */
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_LIT_STORAGE_NUMBER);
+      return &JERRY_CONTEXT (number_list_first_cp);
+    }
+  }
+} /* ecma_lit_storage_get_list */
 
 /**
- * Find or create a literal string.
+ * Create an ecma value from a compressed pointer stored in a literal storage list.
  *
- * @return ecma_string_t compressed pointer
+ * @return ecma value
  */
-ecma_value_t
-ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
-                                    lit_utf8_size_t size) /**< size of the string */
+static ecma_value_t
+ecma_lit_storage_get_value (ecma_lit_storage_type_t type, /**< literal storage type */
+                            jmem_cpointer_t value_cp) /**< compressed pointer to the value */
 {
-  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
-
-  if (ECMA_IS_DIRECT_STRING (string_p))
+  switch (type)
   {
-    return ecma_make_string_value (string_p);
+    case ECMA_LIT_STORAGE_STRING:
+    {
+      return ecma_make_string_value (JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, value_cp));
+    }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+    case ECMA_LIT_STORAGE_BIGINT:
+    {
+      ecma_extended_primitive_t *bigint_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_extended_primitive_t, value_cp);
+      return ecma_make_extended_primitive_value (bigint_p, ECMA_TYPE_BIGINT);
+    }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_LIT_STORAGE_NUMBER);
+      return ecma_make_float_value (JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, value_cp));
+    }
   }
+} /* ecma_lit_storage_get_value */
 
-  jmem_cpointer_t string_list_cp = JERRY_CONTEXT (string_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
-
-  while (string_list_cp != JMEM_CP_NULL)
+/**
+ * Calculate the hash of a literal value.
+ *
+ * @return hash value
+ */
+static lit_string_hash_t
+ecma_lit_storage_hash (ecma_lit_storage_type_t type, /**< literal storage type */
+                       ecma_value_t value) /**< literal value */
+{
+  switch (type)
   {
-    ecma_lit_storage_item_t *string_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, string_list_cp);
-
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    case ECMA_LIT_STORAGE_STRING:
     {
-      if (string_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = string_list_p->values + i;
-        }
-      }
-      else
-      {
-        ecma_string_t *value_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t,
-                                                               string_list_p->values[i]);
-
-        if (ecma_compare_ecma_strings (string_p, value_p))
-        {
-          /* Return with string if found in the list. */
-          ecma_deref_ecma_string (string_p);
-          return ecma_make_string_value (value_p);
-        }
-      }
+      return ecma_string_hash (ecma_get_string_from_value (value));
     }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+    case ECMA_LIT_STORAGE_BIGINT:
+    {
+      ecma_extended_primitive_t *bigint_p = ecma_get_extended_primitive_from_value (value);
 
-    string_list_cp = string_list_p->next_cp;
+      return lit_utf8_string_hash_combine ((lit_string_hash_t) bigint_p->u.bigint_sign_and_size,
+                                           (const lit_utf8_byte_t *) ECMA_BIGINT_GET_DIGITS (bigint_p, 0),
+                                           ECMA_BIGINT_GET_SIZE (bigint_p));
+    }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_LIT_STORAGE_NUMBER);
+      return lit_utf8_string_calc_hash ((const lit_utf8_byte_t *) ecma_get_pointer_from_float_value (value),
+                                        sizeof (ecma_number_t));
+    }
   }
+} /* ecma_lit_storage_hash */
 
-  ECMA_SET_STRING_AS_STATIC (string_p);
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
-
-  if (empty_cpointer_p != NULL)
+/**
+ * Compare a literal value to a value stored in a literal storage list.
+ *
+ * @return true if the values are equal, false otherwise
+ */
+static bool
+ecma_lit_storage_is_equal (ecma_lit_storage_type_t type, /**< literal storage type */
+                           ecma_value_t value, /**< literal value */
+                           jmem_cpointer_t value_cp) /**< compressed pointer to the stored value */
+{
+  switch (type)
   {
-    *empty_cpointer_p = result;
-    return ecma_make_string_value (string_p);
+    case ECMA_LIT_STORAGE_STRING:
+    {
+      return ecma_compare_ecma_non_direct_strings (ecma_get_string_from_value (value),
+                                                   JMEM_CP_GET_NON_NULL_POINTER (ecma_string_t, value_cp));
+    }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+    case ECMA_LIT_STORAGE_BIGINT:
+    {
+      return ecma_bigint_is_equal_to_bigint (value, ecma_lit_storage_get_value (type, value_cp));
+    }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_LIT_STORAGE_NUMBER);
+      return ecma_get_float_from_value (value) == *JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t, value_cp);
+    }
   }
+} /* ecma_lit_storage_is_equal */
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+/**
+ * Insert a compressed pointer into a literal hash table. The table must have a free bucket.
+ */
+static void
+ecma_lit_hash_table_insert (ecma_lit_hash_table_t *table_p, /**< hash table */
+                            lit_string_hash_t hash, /**< hash of the value */
+                            jmem_cpointer_t value_cp) /**< compressed pointer to the value */
+{
+  jmem_cpointer_t *buckets_p = ECMA_LIT_HASH_TABLE_GET_BUCKETS (table_p);
+  uint32_t mask = table_p->mask;
+  uint32_t index = hash & mask;
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  JERRY_ASSERT (table_p->count < mask);
+
+  while (buckets_p[index] != JMEM_CP_NULL)
   {
-    new_item_p->values[i] = JMEM_CP_NULL;
+    index = (index + 1) & mask;
   }
 
-  new_item_p->next_cp = JERRY_CONTEXT (string_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (string_list_first_cp), new_item_p);
+  buckets_p[index] = value_cp;
+  table_p->count++;
+} /* ecma_lit_hash_table_insert */
 
-  return ecma_make_string_value (string_p);
-} /* ecma_find_or_create_literal_string */
+/**
+ * Free the hash table of a literal storage list.
+ */
+static void
+ecma_lit_hash_table_free (ecma_lit_storage_type_t type) /**< literal storage type */
+{
+  ecma_lit_hash_table_t *table_p = JERRY_CONTEXT (lit_hash_table_p)[type];
+
+  if (table_p != NULL)
+  {
+    JERRY_CONTEXT (lit_hash_table_p)[type] = NULL;
+    jmem_heap_free_block (table_p, ECMA_LIT_HASH_TABLE_GET_SIZE (table_p));
+  }
+} /* ecma_lit_hash_table_free */
 
 /**
- * Find or create a literal number.
+ * (Re)build the hash table of a literal storage list from the values of the list.
  *
- * @return ecma value
+ * Note:
+ *      the table is not created if there is not enough memory, in which case
+ *      the list is searched linearly until the next rebuild attempt
  */
-ecma_value_t
-ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be searched */
+static void
+ecma_lit_hash_table_rebuild (ecma_lit_storage_type_t type, /**< literal storage type */
+                             uint32_t count) /**< number of values in the list */
 {
-  ecma_value_t num = ecma_make_number_value (number_arg);
+  /* Free the old table first to reduce peak memory consumption. */
+  ecma_lit_hash_table_free (type);
 
-  if (ecma_is_value_integer_number (num))
+  uint32_t bucket_count = ECMA_LIT_HASH_TABLE_MIN_SIZE;
+
+  /* The load factor of the new table is at most 50%. */
+  while (bucket_count < count * 2)
   {
-    return num;
+    bucket_count <<= 1;
   }
 
-  JERRY_ASSERT (ecma_is_value_float_number (num));
+  size_t size = sizeof (ecma_lit_hash_table_t) + bucket_count * sizeof (jmem_cpointer_t);
+  ecma_lit_hash_table_t *table_p = (ecma_lit_hash_table_t *) jmem_heap_alloc_block_null_on_error (size);
 
-  jmem_cpointer_t number_list_cp = JERRY_CONTEXT (number_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+  if (table_p == NULL)
+  {
+    return;
+  }
 
-  while (number_list_cp != JMEM_CP_NULL)
+  table_p->mask = bucket_count - 1;
+  table_p->count = 0;
+  memset (ECMA_LIT_HASH_TABLE_GET_BUCKETS (table_p), 0, bucket_count * sizeof (jmem_cpointer_t));
+
+  jmem_cpointer_t list_cp = *ecma_lit_storage_get_list (type);
+
+  while (list_cp != JMEM_CP_NULL)
   {
-    ecma_lit_storage_item_t *number_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t,
-                                                                           number_list_cp);
+    ecma_lit_storage_item_t *list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, list_cp);
 
     for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
     {
-      if (number_list_p->values[i] == JMEM_CP_NULL)
-      {
-        if (empty_cpointer_p == NULL)
-        {
-          empty_cpointer_p = number_list_p->values + i;
-        }
-      }
-      else
-      {
-        ecma_number_t *number_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_number_t,
-                                                                number_list_p->values[i]);
+      jmem_cpointer_t value_cp = list_p->values[i];
 
-        if (*number_p == number_arg)
-        {
-          ecma_free_value (num);
-          return ecma_make_float_value (number_p);
-        }
+      if (value_cp != JMEM_CP_NULL)
+      {
+        lit_string_hash_t hash = ecma_lit_storage_hash (type, ecma_lit_storage_get_value (type, value_cp));
+        ecma_lit_hash_table_insert (table_p, hash, value_cp);
       }
     }
 
-    number_list_cp = number_list_p->next_cp;
-  }
-
-  jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_pointer_from_float_value (num));
-
-  if (empty_cpointer_p != NULL)
-  {
-    *empty_cpointer_p = result;
-    return num;
+    list_cp = list_p->next_cp;
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+  JERRY_ASSERT (table_p->count == count);
+  JERRY_CONTEXT (lit_hash_table_p)[type] = table_p;
+} /* ecma_lit_hash_table_rebuild */
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+/**
+ * Free the hash tables of the literal storage lists.
+ *
+ * Note:
+ *      the literals are kept in the lists, so the tables are rebuilt on demand
+ */
+void
+ecma_lit_storage_free_hash_tables (void)
+{
+  for (uint32_t type = 0; type < ECMA_LIT_STORAGE__COUNT; type++)
   {
-    new_item_p->values[i] = JMEM_CP_NULL;
+    ecma_lit_hash_table_free ((ecma_lit_storage_type_t) type);
   }
+} /* ecma_lit_storage_free_hash_tables */
 
-  new_item_p->next_cp = JERRY_CONTEXT (number_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (number_list_first_cp), new_item_p);
-
-  return num;
-} /* ecma_find_or_create_literal_number */
+/**
+ * Finalize literal storage
+ */
+void
+ecma_finalize_lit_storage (void)
+{
+  ecma_lit_storage_free_hash_tables ();
 
+#if ENABLED (JERRY_ESNEXT)
+  ecma_free_symbol_list (JERRY_CONTEXT (symbol_list_first_cp));
+#endif /* ENABLED (JERRY_ESNEXT) */
+  ecma_free_string_list (JERRY_CONTEXT (string_list_first_cp));
+  ecma_free_number_list (JERRY_CONTEXT (number_list_first_cp));
 #if ENABLED (JERRY_BUILTIN_BIGINT)
+  ecma_free_bigint_list (JERRY_CONTEXT (bigint_list_first_cp));
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+} /* ecma_finalize_lit_storage */
 
 /**
- * Find or create a literal BigInt.
+ * Find or insert a literal value into a literal storage list.
  *
- * @return BigInt value
+ * Note:
+ *      if the value is found in the list, the passed value is freed
+ *
+ * @return the value stored in the list
  */
-ecma_value_t
-ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searched */
+static ecma_value_t
+ecma_find_or_insert_literal (ecma_lit_storage_type_t type, /**< literal storage type */
+                             ecma_value_t value) /**< literal value */
 {
-  JERRY_ASSERT (ecma_is_value_bigint (bigint));
+  ecma_lit_hash_table_t *table_p = JERRY_CONTEXT (lit_hash_table_p)[type];
+  lit_string_hash_t hash = 0;
+  uint32_t count = 0;
 
-  if (bigint == ECMA_BIGINT_ZERO)
+  if (table_p != NULL)
   {
-    return bigint;
-  }
+    jmem_cpointer_t *buckets_p = ECMA_LIT_HASH_TABLE_GET_BUCKETS (table_p);
+    uint32_t mask = table_p->mask;
 
-  jmem_cpointer_t bigint_list_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  jmem_cpointer_t *empty_cpointer_p = NULL;
+    hash = ecma_lit_storage_hash (type, value);
 
-  while (bigint_list_cp != JMEM_CP_NULL)
+    for (uint32_t index = hash & mask; buckets_p[index] != JMEM_CP_NULL; index = (index + 1) & mask)
+    {
+      if (ecma_lit_storage_is_equal (type, value, buckets_p[index]))
+      {
+        ecma_free_value (value);
+        return ecma_lit_storage_get_value (type, buckets_p[index]);
+      }
+    }
+
+    count = table_p->count;
+  }
+  else
   {
-    ecma_lit_storage_item_t *bigint_list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t,
-                                                                           bigint_list_cp);
+    jmem_cpointer_t list_cp = *ecma_lit_storage_get_list (type);
 
-    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    while (list_cp != JMEM_CP_NULL)
     {
-      if (bigint_list_p->values[i] == JMEM_CP_NULL)
+      ecma_lit_storage_item_t *list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, list_cp);
+
+      for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
       {
-        if (empty_cpointer_p == NULL)
+        if (list_p->values[i] != JMEM_CP_NULL)
         {
-          empty_cpointer_p = bigint_list_p->values + i;
-        }
-      }
-      else
-      {
-        ecma_extended_primitive_t *other_bigint_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_extended_primitive_t,
-                                                                                  bigint_list_p->values[i]);
-        ecma_value_t other_bigint = ecma_make_extended_primitive_value (other_bigint_p, ECMA_TYPE_BIGINT);
+          if (ecma_lit_storage_is_equal (type, value, list_p->values[i]))
+          {
+            ecma_free_value (value);
+            return ecma_lit_storage_get_value (type, list_p->values[i]);
+          }
 
-        if (ecma_bigint_is_equal_to_bigint (bigint, other_bigint))
-        {
-          ecma_free_value (bigint);
-          return other_bigint;
+          count++;
         }
       }
-    }
 
-    bigint_list_cp = bigint_list_p->next_cp;
+      list_cp = list_p->next_cp;
+    }
   }
 
   jmem_cpointer_t result;
-  JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_extended_primitive_from_value (bigint));
+
+  switch (type)
+  {
+    case ECMA_LIT_STORAGE_STRING:
+    {
+      ecma_string_t *string_p = ecma_get_string_from_value (value);
+      ECMA_SET_STRING_AS_STATIC (string_p);
+      JMEM_CP_SET_NON_NULL_POINTER (result, string_p);
+      break;
+    }
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+    case ECMA_LIT_STORAGE_BIGINT:
+    {
+      JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_extended_primitive_from_value (value));
+      break;
+    }
+#endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_LIT_STORAGE_NUMBER);
+      JMEM_CP_SET_NON_NULL_POINTER (result, ecma_get_pointer_from_float_value (value));
+      break;
+    }
+  }
+
+  /* Values are never removed from the lists, so only the first item may have free slots. */
+  jmem_cpointer_t *list_first_cp_p = ecma_lit_storage_get_list (type);
+  jmem_cpointer_t *empty_cpointer_p = NULL;
+
+  if (*list_first_cp_p != JMEM_CP_NULL)
+  {
+    ecma_lit_storage_item_t *list_p = JMEM_CP_GET_NON_NULL_POINTER (ecma_lit_storage_item_t, *list_first_cp_p);
+
+    for (int i = 0; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      if (list_p->values[i] == JMEM_CP_NULL)
+      {
+        empty_cpointer_p = list_p->values + i;
+        break;
+      }
+    }
+  }
 
   if (empty_cpointer_p != NULL)
   {
     *empty_cpointer_p = result;
-    return bigint;
+  }
+  else
+  {
+    ecma_lit_storage_item_t *new_item_p;
+    new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+
+    new_item_p->values[0] = result;
+    for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+    {
+      new_item_p->values[i] = JMEM_CP_NULL;
+    }
+
+    new_item_p->next_cp = *list_first_cp_p;
+    JMEM_CP_SET_NON_NULL_POINTER (*list_first_cp_p, new_item_p);
+  }
+
+  count++;
+
+  /* The allocation above may free the hash tables when the memory pressure is high. */
+  table_p = JERRY_CONTEXT (lit_hash_table_p)[type];
+
+  if (table_p != NULL)
+  {
+    if (count <= table_p->mask - (table_p->mask >> 2))
+    {
+      ecma_lit_hash_table_insert (table_p, hash, result);
+      return value;
+    }
+  }
+  else if (count < ECMA_LIT_HASH_TABLE_THRESHOLD || (count & (count - 1)) != 0)
+  {
+    /* Creating the table is only retried when the size of the list is doubled. */
+    return value;
+  }
+
+  ecma_lit_hash_table_rebuild (type, count);
+  return value;
+} /* ecma_find_or_insert_literal */
+
+/**
+ * Find or create a literal string.
+ *
+ * @return ecma_string_t compressed pointer
+ */
+ecma_value_t
+ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, /**< string to be searched */
+                                    lit_utf8_size_t size) /**< size of the string */
+{
+  ecma_string_t *string_p = ecma_new_ecma_string_from_utf8 (chars_p, size);
+
+  if (ECMA_IS_DIRECT_STRING (string_p))
+  {
+    return ecma_make_string_value (string_p);
   }
 
-  ecma_lit_storage_item_t *new_item_p;
-  new_item_p = (ecma_lit_storage_item_t *) jmem_pools_alloc (sizeof (ecma_lit_storage_item_t));
+  return ecma_find_or_insert_literal (ECMA_LIT_STORAGE_STRING, ecma_make_string_value (string_p));
+} /* ecma_find_or_create_literal_string */
+
+/**
+ * Find or create a literal number.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_find_or_create_literal_number (ecma_number_t number_arg) /**< number to be searched */
+{
+  ecma_value_t num = ecma_make_number_value (number_arg);
 
-  new_item_p->values[0] = result;
-  for (int i = 1; i < ECMA_LIT_STORAGE_VALUE_COUNT; i++)
+  if (ecma_is_value_integer_number (num))
   {
-    new_item_p->values[i] = JMEM_CP_NULL;
+    return num;
   }
 
-  new_item_p->next_cp = JERRY_CONTEXT (bigint_list_first_cp);
-  JMEM_CP_SET_NON_NULL_POINTER (JERRY_CONTEXT (bigint_list_first_cp), new_item_p);
+  JERRY_ASSERT (ecma_is_value_float_number (num));
+
+  return ecma_find_or_insert_literal (ECMA_LIT_STORAGE_NUMBER, num);
+} /* ecma_find_or_create_literal_number */
+
+#if ENABLED (JERRY_BUILTIN_BIGINT)
+
+/**
+ * Find or create a literal BigInt.
+ *
+ * @return BigInt value
+ */
+ecma_value_t
+ecma_find_or_create_literal_bigint (ecma_value_t bigint) /**< bigint to be searched */
+{
+  JERRY_ASSERT (ecma_is_value_bigint (bigint));
+
+  if (bigint == ECMA_BIGINT_ZERO)
+  {
+    return bigint;
+  }
 
-  return bigint;
+  return ecma_find_or_insert_literal (ECMA_LIT_STORAGE_BIGINT, bigint);
 } /* ecma_find_or_create_literal_bigint */
 
 #endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
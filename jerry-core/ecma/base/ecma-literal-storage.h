@@ -39,6 +39,7 @@ typedef struct
 #endif /* ENABLED (JERRY_SNAPSHOT_SAVE) */
 
 void ecma_finalize_lit_storage (void);
+void ecma_lit_storage_free_hash_tables (void);
 
 ecma_value_t ecma_find_or_create_literal_string (const lit_utf8_byte_t *chars_p, lit_utf8_size_t size);
 ecma_value_t ecma_find_or_create_literal_number (ecma_number_t number_arg);
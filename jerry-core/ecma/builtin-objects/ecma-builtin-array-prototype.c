@@ -464,7 +464,7 @@ ecma_builtin_array_prototype_object_push (const ecma_value_t *argument_list_p, /
 
     for (uint32_t index = 0; index < arguments_number; index++)
     {
-      buffer_p[index] = ecma_copy_value_if_not_object (argument_list_p[index]);
+      buffer_p[index] = ecma_copy_value_if_not_object_into (obj_p, argument_list_p[index]);
     }
 
     ext_obj_p->u.array.u.hole_count -= ECMA_FAST_ARRAY_HOLE_ONE * arguments_number;
@@ -922,7 +922,7 @@ ecma_builtin_array_prototype_object_slice (ecma_value_t arg1, /**< start */
 #if ENABLED (JERRY_ESNEXT)
         ecma_free_value_if_not_object (to_buffer_p[n]);
 #endif /* ENABLED (JERRY_ESNEXT) */
-        to_buffer_p[n] = ecma_copy_value_if_not_object (from_buffer_p[k]);
+        to_buffer_p[n] = ecma_copy_value_if_not_object_into (new_array_p, from_buffer_p[k]);
       }
 
       ext_to_obj_p->u.array.u.hole_count &= ECMA_FAST_ARRAY_HOLE_ONE - 1;
@@ -1564,7 +1564,7 @@ ecma_builtin_array_prototype_object_unshift (const ecma_value_t args[], /**< arg
 
       while (index < args_number)
       {
-        buffer_p[index] = ecma_copy_value_if_not_object (args[index]);
+        buffer_p[index] = ecma_copy_value_if_not_object_into (obj_p, args[index]);
         index++;
       }
 
@@ -2343,7 +2343,7 @@ ecma_builtin_array_prototype_fill (ecma_value_t value, /**< value */
       while (k < final)
       {
         ecma_free_value_if_not_object (buffer_p[k]);
-        buffer_p[k] = ecma_copy_value_if_not_object (value);
+        buffer_p[k] = ecma_copy_value_if_not_object_into (obj_p, value);
         k++;
       }
 
@@ -2536,7 +2536,7 @@ ecma_builtin_array_prototype_object_copy_within (const ecma_value_t args[], /**<
 
         for (; count > 0; count--)
         {
-          ecma_value_t copy_value = ecma_copy_value_if_not_object (buffer_p[start]);
+          ecma_value_t copy_value = ecma_copy_value_if_not_object_into (obj_p, buffer_p[start]);
 
           ecma_free_value_if_not_object (buffer_p[target]);
 
@@ -182,6 +182,11 @@ ecma_builtin_generator_prototype_object_do (vm_executable_object_t *generator_ob
         }
 
         generator_object_p->frame_ctx.stack_top_p++;
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+        ecma_gc_remember_object ((ecma_object_t *) generator_object_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
         arg = ECMA_VALUE_UNDEFINED;
         continue;
       }
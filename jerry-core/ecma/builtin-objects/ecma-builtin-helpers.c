@@ -675,75 +675,60 @@ ecma_builtin_helper_string_find_index (ecma_string_t *original_str_p, /**< index
     }
     else
     {
-      /* create utf8 string from original string and advance to position */
       ECMA_STRING_TO_UTF8_STRING (original_str_p, original_str_utf8_p, original_str_size);
+      ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
 
-      lit_utf8_size_t index = start_pos;
+      /* The code unit indices are mapped to byte offsets only once, the search compares bytes. */
+      bool is_ascii = (original_str_size == original_len);
+      lit_utf8_size_t start_offset = start_pos;
 
-      const lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p;
-      for (lit_utf8_size_t idx = 0; idx < index; idx++)
+      if (!is_ascii)
       {
-        lit_utf8_incr (&original_str_curr_p);
+        const lit_utf8_byte_t *original_str_curr_p = original_str_utf8_p;
+
+        for (lit_utf8_size_t idx = 0; idx < start_pos; idx++)
+        {
+          lit_utf8_incr (&original_str_curr_p);
+        }
+
+        start_offset = (lit_utf8_size_t) (original_str_curr_p - original_str_utf8_p);
       }
 
-      /* create utf8 string from search string */
-      ECMA_STRING_TO_UTF8_STRING (search_str_p, search_str_utf8_p, search_str_size);
+      const lit_utf8_byte_t *match_p;
+
+      if (first_index)
+      {
+        match_p = lit_utf8_string_find (original_str_utf8_p + start_offset,
+                                        original_str_size - start_offset,
+                                        search_str_utf8_p,
+                                        search_str_size);
+      }
+      else
+      {
+        /* The match must start at or before the start position. */
+        lit_utf8_size_t end_offset = JERRY_MIN (start_offset + search_str_size, original_str_size);
 
-      const lit_utf8_byte_t *search_str_curr_p = search_str_utf8_p;
+        match_p = lit_utf8_string_find_last (original_str_utf8_p, end_offset, search_str_utf8_p, search_str_size);
+      }
 
-      /* iterate original string and try to match at each position */
-      bool searching = true;
-      ecma_char_t first_char = lit_cesu8_read_next (&search_str_curr_p);
-      while (searching)
+      if (match_p != NULL)
       {
-        /* match as long as possible */
-        lit_utf8_size_t match_len = 0;
-        const lit_utf8_byte_t *stored_original_str_curr_p = original_str_curr_p;
+        lit_utf8_size_t match_offset = (lit_utf8_size_t) (match_p - original_str_utf8_p);
 
-        if (match_len < search_len &&
-            index + match_len < original_len &&
-            lit_cesu8_read_next (&original_str_curr_p) == first_char)
-        {
-          const lit_utf8_byte_t *nested_search_str_curr_p = search_str_curr_p;
-          match_len++;
+        match_found = true;
 
-          while (match_len < search_len &&
-                 index + match_len < original_len &&
-                 lit_cesu8_read_next (&original_str_curr_p) == lit_cesu8_read_next (&nested_search_str_curr_p))
-          {
-            match_len++;
-          }
+        if (is_ascii)
+        {
+          *ret_index_p = match_offset;
         }
-
-        /* check for match */
-        if (match_len == search_len)
+        else if (first_index)
         {
-          match_found = true;
-          *ret_index_p = index;
-
-          break;
+          *ret_index_p = start_pos + lit_utf8_string_length (original_str_utf8_p + start_offset,
+                                                             match_offset - start_offset);
         }
         else
         {
-          /* inc/dec index and update iterators and search condition */
-          original_str_curr_p = stored_original_str_curr_p;
-
-          if (first_index)
-          {
-            if ((searching = (index <= original_len - search_len)))
-            {
-              lit_utf8_incr (&original_str_curr_p);
-              index++;
-            }
-          }
-          else
-          {
-            if ((searching = (index > 0)))
-            {
-              lit_utf8_decr (&original_str_curr_p);
-              index--;
-            }
-          }
+          *ret_index_p = lit_utf8_string_length (original_str_utf8_p, match_offset);
         }
       }
 
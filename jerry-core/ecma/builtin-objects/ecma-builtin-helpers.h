@@ -212,6 +212,33 @@ typedef struct
   ecma_stringbuilder_t result_builder;
 } ecma_json_stringify_context_t;
 
+/**
+ * Number of entries in the property name cache of the JSON parser (must be a power of 2)
+ */
+#define ECMA_JSON_PARSER_KEY_CACHE_SIZE 16
+
+/**
+ * State of a JSON parser, which may receive its input in multiple chunks
+ */
+typedef struct
+{
+  ecma_collection_t *stack_p; /**< objects and arrays under construction, each object is
+                               *   followed by the name of the property whose value is parsed */
+  ecma_value_t result; /**< parsed value */
+  ecma_stringbuilder_t pending_token; /**< characters of the token which is not finished
+                                       *   at the end of the previous input chunk */
+  uint8_t state; /**< expected token */
+  uint8_t pending_type; /**< type of the pending token */
+  ecma_string_t *key_cache[ECMA_JSON_PARSER_KEY_CACHE_SIZE]; /**< recently created property names */
+} ecma_json_parser_t;
+
+void ecma_builtin_json_parser_init (ecma_json_parser_t *parser_p);
+ecma_value_t ecma_builtin_json_parser_feed (ecma_json_parser_t *parser_p,
+                                            const lit_utf8_byte_t *data_p,
+                                            lit_utf8_size_t data_size);
+ecma_value_t ecma_builtin_json_parser_finish (ecma_json_parser_t *parser_p,
+                                              const lit_utf8_byte_t *data_p,
+                                              lit_utf8_size_t data_size);
 ecma_value_t ecma_builtin_json_parse_buffer (const lit_utf8_byte_t * str_start_p,
                                              lit_utf8_size_t string_size);
 ecma_value_t ecma_builtin_json_stringify_no_opts (const ecma_value_t value);
@@ -93,17 +93,122 @@ typedef struct
   } u;
 } ecma_json_token_t;
 
+/**
+ * JSON parser state
+ *
+ * Note:
+ *      strings are only parsed in the states before ECMA_JSON_PARSER_COLON,
+ *      and they are property names from ECMA_JSON_PARSER_FIRST_KEY
+ */
+typedef enum
+{
+  ECMA_JSON_PARSER_VALUE, /**< a value is expected */
+  ECMA_JSON_PARSER_FIRST_ELEMENT, /**< a value or the end of an empty array is expected */
+  ECMA_JSON_PARSER_FIRST_KEY, /**< a property name or the end of an empty object is expected */
+  ECMA_JSON_PARSER_KEY, /**< a property name is expected */
+  ECMA_JSON_PARSER_COLON, /**< a colon after a property name is expected */
+  ECMA_JSON_PARSER_SEPARATOR, /**< a comma or the end of the current object or array is expected */
+  ECMA_JSON_PARSER_END, /**< the end of the input is expected */
+  ECMA_JSON_PARSER_ERROR, /**< a syntax error is found */
+} ecma_json_parser_state_t;
+
+/**
+ * Type of the token which is not finished at the end of an input chunk
+ */
+typedef enum
+{
+  ECMA_JSON_PENDING_NONE, /**< there is no unfinished token */
+  ECMA_JSON_PENDING_STRING, /**< unfinished string */
+  ECMA_JSON_PENDING_STRING_ESCAPE, /**< unfinished string, which ends with a backslash */
+  ECMA_JSON_PENDING_WORD, /**< unfinished number or literal */
+} ecma_json_pending_type_t;
+
+/**
+ * Create a string from a character sequence without escape sequences.
+ *
+ * Property names are looked up in the property name cache of the parser first,
+ * so the objects created from the same JSON document share their property name strings.
+ *
+ * @return ecma string
+ */
+static ecma_string_t *
+ecma_builtin_json_create_string (const lit_utf8_byte_t *start_p, /**< start of the characters */
+                                 const lit_utf8_byte_t *end_p, /**< end of the characters */
+                                 ecma_string_t **key_cache_p) /**< property name cache of the parser,
+                                                               *   NULL if the string is not a property name */
+{
+  const lit_utf8_size_t size = (lit_utf8_size_t) (end_p - start_p);
+
+  if (key_cache_p == NULL)
+  {
+    return ecma_new_ecma_string_from_utf8 (start_p, size);
+  }
+
+  const lit_string_hash_t hash = lit_utf8_string_calc_hash (start_p, size);
+  ecma_string_t **entry_p = key_cache_p + (hash & (ECMA_JSON_PARSER_KEY_CACHE_SIZE - 1));
+  ecma_string_t *string_p = *entry_p;
+
+  if (string_p != NULL
+      && string_p->u.hash == hash
+      && ecma_string_get_size (string_p) == size)
+  {
+    ECMA_STRING_TO_UTF8_STRING (string_p, cached_start_p, cached_size);
+    bool is_equal = memcmp (cached_start_p, start_p, cached_size) == 0;
+    ECMA_FINALIZE_UTF8_STRING (cached_start_p, cached_size);
+
+    if (is_equal)
+    {
+      ecma_ref_ecma_string (string_p);
+      return string_p;
+    }
+  }
+
+  string_p = ecma_new_ecma_string_from_utf8 (start_p, size);
+
+  /* Magic strings and array indices are not allocated, and their hash is not computed from their characters. */
+  if (!ECMA_IS_DIRECT_STRING (string_p)
+      && (ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_ASCII_STRING
+          || ECMA_STRING_GET_CONTAINER (string_p) == ECMA_STRING_CONTAINER_HEAP_UTF8_STRING))
+  {
+    if (*entry_p != NULL)
+    {
+      ecma_deref_ecma_string (*entry_p);
+    }
+
+    ecma_ref_ecma_string (string_p);
+    *entry_p = string_p;
+  }
+
+  return string_p;
+} /* ecma_builtin_json_create_string */
+
 /**
  * Parse and extract string token.
  */
 static void
-ecma_builtin_json_parse_string (ecma_json_token_t *token_p) /**< token argument */
+ecma_builtin_json_parse_string (ecma_json_token_t *token_p, /**< token argument */
+                                ecma_string_t **key_cache_p) /**< property name cache of the parser,
+                                                              *   NULL if the string is not a property name */
 {
   const lit_utf8_byte_t *current_p = token_p->current_p;
   const lit_utf8_byte_t *end_p = token_p->end_p;
 
+  /* Strings without escape sequences are created directly from the input. */
+  while (current_p < end_p && *current_p > 0x1f && *current_p != LIT_CHAR_BACKSLASH)
+  {
+    if (*current_p == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      token_p->u.string_p = ecma_builtin_json_create_string (token_p->current_p, current_p, key_cache_p);
+      token_p->current_p = current_p + 1;
+      token_p->type = TOKEN_STRING;
+      return;
+    }
+
+    current_p++;
+  }
+
   ecma_stringbuilder_t result_builder = ecma_stringbuilder_create ();
-  const lit_utf8_byte_t *unappended_p = current_p;
+  const lit_utf8_byte_t *unappended_p = token_p->current_p;
 
   while (true)
   {
@@ -300,7 +405,7 @@ ecma_builtin_json_parse_number (ecma_json_token_t *token_p) /**< token argument
  */
 static void
 ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p, /**< token argument */
-                                    bool parse_string) /**< strings are allowed to parse */
+                                    ecma_json_parser_t *parser_p) /**< parser state */
 {
   const lit_utf8_byte_t *current_p = token_p->current_p;
   const lit_utf8_byte_t *end_p = token_p->end_p;
@@ -361,10 +466,12 @@ ecma_builtin_json_parse_next_token (ecma_json_token_t *token_p, /**< token argum
     }
     case LIT_CHAR_DOUBLE_QUOTE:
     {
-      if (parse_string)
+      if (parser_p->state <= ECMA_JSON_PARSER_KEY)
       {
         token_p->current_p = current_p + 1;
-        ecma_builtin_json_parse_string (token_p);
+        ecma_builtin_json_parse_string (token_p,
+                                        (parser_p->state >= ECMA_JSON_PARSER_FIRST_KEY ? parser_p->key_cache
+                                                                                        : NULL));
       }
       return;
     }
@@ -448,158 +555,491 @@ ecma_builtin_json_define_value_property (ecma_object_t *obj_p, /**< this object
 } /* ecma_builtin_json_define_value_property */
 
 /**
- * Parse next value.
- *
- * The function fills the fields of the ecma_json_token_t
- * argument and advances the string pointer.
+ * Add a parsed value to the object or array on the top of the parser stack,
+ * or store it as the result when the stack is empty.
+ */
+static void
+ecma_builtin_json_parser_add_value (ecma_json_parser_t *parser_p, /**< parser state */
+                                    ecma_value_t value) /**< parsed value, its reference is taken over */
+{
+  ecma_collection_t *stack_p = parser_p->stack_p;
+
+  if (stack_p == NULL || stack_p->item_count == 0)
+  {
+    parser_p->result = value;
+    parser_p->state = ECMA_JSON_PARSER_END;
+    return;
+  }
+
+  ecma_value_t top_value = stack_p->buffer_p[stack_p->item_count - 1];
+
+  if (ecma_is_value_string (top_value))
+  {
+    ecma_string_t *name_p = ecma_get_string_from_value (top_value);
+    stack_p->item_count--;
+
+    ecma_object_t *object_p = ecma_get_object_from_value (stack_p->buffer_p[stack_p->item_count - 1]);
+    ecma_builtin_json_define_value_property (object_p, name_p, value);
+    ecma_deref_ecma_string (name_p);
+  }
+  else
+  {
+    ecma_object_t *array_p = ecma_get_object_from_value (top_value);
+    ecma_value_t completion = ecma_builtin_helper_def_prop_by_index (array_p,
+                                                                     ecma_array_get_length (array_p),
+                                                                     value,
+                                                                     ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
+    JERRY_ASSERT (ecma_is_value_true (completion));
+  }
+
+  ecma_free_value (value);
+  parser_p->state = ECMA_JSON_PARSER_SEPARATOR;
+} /* ecma_builtin_json_parser_add_value */
+
+/**
+ * Push a new object or array onto the parser stack.
+ */
+static void
+ecma_builtin_json_parser_push (ecma_json_parser_t *parser_p, /**< parser state */
+                               ecma_object_t *object_p, /**< new object or array */
+                               ecma_json_parser_state_t state) /**< next parser state */
+{
+  if (parser_p->stack_p == NULL)
+  {
+    parser_p->stack_p = ecma_new_collection ();
+  }
+
+  ecma_collection_push_back (parser_p->stack_p, ecma_make_object_value (object_p));
+  parser_p->state = (uint8_t) state;
+} /* ecma_builtin_json_parser_push */
+
+/**
+ * Finish the object or array on the top of the parser stack.
+ */
+static void
+ecma_builtin_json_parser_pop (ecma_json_parser_t *parser_p) /**< parser state */
+{
+  ecma_collection_t *stack_p = parser_p->stack_p;
+
+  JERRY_ASSERT (stack_p != NULL && stack_p->item_count > 0);
+
+  stack_p->item_count--;
+  ecma_builtin_json_parser_add_value (parser_p, stack_p->buffer_p[stack_p->item_count]);
+} /* ecma_builtin_json_parser_pop */
+
+/**
+ * Process the next token of the input.
  *
- * @return ecma_value with the property value
+ * @return true - if the token is valid in the current parser state
+ *         false - otherwise
  */
-static ecma_value_t
-ecma_builtin_json_parse_value (ecma_json_token_t *token_p) /**< token argument */
+static bool
+ecma_builtin_json_parser_process_token (ecma_json_parser_t *parser_p, /**< parser state */
+                                        ecma_json_token_t *token_p) /**< token argument */
 {
-  switch (token_p->type)
+  switch (parser_p->state)
   {
-    case TOKEN_NUMBER:
+    case ECMA_JSON_PARSER_FIRST_ELEMENT:
     {
-      return ecma_make_number_value (token_p->u.number);
+      if (token_p->type == TOKEN_RIGHT_SQUARE)
+      {
+        ecma_builtin_json_parser_pop (parser_p);
+        return true;
+      }
+      /* FALLTHRU */
     }
-    case TOKEN_STRING:
+    case ECMA_JSON_PARSER_VALUE:
     {
-      return ecma_make_string_value (token_p->u.string_p);
+      switch (token_p->type)
+      {
+        case TOKEN_NUMBER:
+        {
+          ecma_builtin_json_parser_add_value (parser_p, ecma_make_number_value (token_p->u.number));
+          return true;
+        }
+        case TOKEN_STRING:
+        {
+          ecma_builtin_json_parser_add_value (parser_p, ecma_make_string_value (token_p->u.string_p));
+          return true;
+        }
+        case TOKEN_NULL:
+        {
+          ecma_builtin_json_parser_add_value (parser_p, ECMA_VALUE_NULL);
+          return true;
+        }
+        case TOKEN_TRUE:
+        {
+          ecma_builtin_json_parser_add_value (parser_p, ECMA_VALUE_TRUE);
+          return true;
+        }
+        case TOKEN_FALSE:
+        {
+          ecma_builtin_json_parser_add_value (parser_p, ECMA_VALUE_FALSE);
+          return true;
+        }
+        case TOKEN_LEFT_BRACE:
+        {
+          ecma_builtin_json_parser_push (parser_p, ecma_op_create_object_object_noarg (), ECMA_JSON_PARSER_FIRST_KEY);
+          return true;
+        }
+        case TOKEN_LEFT_SQUARE:
+        {
+          ecma_value_t array_construction = ecma_op_create_array_object (NULL, 0, false);
+          JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (array_construction));
+
+          ecma_builtin_json_parser_push (parser_p,
+                                         ecma_get_object_from_value (array_construction),
+                                         ECMA_JSON_PARSER_FIRST_ELEMENT);
+          return true;
+        }
+        default:
+        {
+          return false;
+        }
+      }
     }
-    case TOKEN_NULL:
+    case ECMA_JSON_PARSER_FIRST_KEY:
     {
-      return ECMA_VALUE_NULL;
+      if (token_p->type == TOKEN_RIGHT_BRACE)
+      {
+        ecma_builtin_json_parser_pop (parser_p);
+        return true;
+      }
+      /* FALLTHRU */
     }
-    case TOKEN_TRUE:
+    case ECMA_JSON_PARSER_KEY:
     {
-      return ECMA_VALUE_TRUE;
+      if (token_p->type != TOKEN_STRING)
+      {
+        return false;
+      }
+
+      ecma_collection_push_back (parser_p->stack_p, ecma_make_string_value (token_p->u.string_p));
+      parser_p->state = ECMA_JSON_PARSER_COLON;
+      return true;
     }
-    case TOKEN_FALSE:
+    case ECMA_JSON_PARSER_COLON:
     {
-      return ECMA_VALUE_FALSE;
+      if (token_p->type != TOKEN_COLON)
+      {
+        return false;
+      }
+
+      parser_p->state = ECMA_JSON_PARSER_VALUE;
+      return true;
     }
-    case TOKEN_LEFT_BRACE:
+    case ECMA_JSON_PARSER_SEPARATOR:
     {
-      ecma_object_t *object_p = ecma_op_create_object_object_noarg ();
+      ecma_collection_t *stack_p = parser_p->stack_p;
+      ecma_object_t *object_p = ecma_get_object_from_value (stack_p->buffer_p[stack_p->item_count - 1]);
+      bool is_array = ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_ARRAY;
 
-      ecma_builtin_json_parse_next_token (token_p, true);
-
-      if (token_p->type == TOKEN_RIGHT_BRACE)
+      if (token_p->type == TOKEN_COMMA)
       {
-        return ecma_make_object_value (object_p);
+        parser_p->state = is_array ? ECMA_JSON_PARSER_VALUE : ECMA_JSON_PARSER_KEY;
+        return true;
       }
 
-      while (true)
+      if (token_p->type != (is_array ? TOKEN_RIGHT_SQUARE : TOKEN_RIGHT_BRACE))
       {
-        if (token_p->type != TOKEN_STRING)
-        {
-          break;
-        }
+        return false;
+      }
 
-        ecma_string_t *name_p = token_p->u.string_p;
+      ecma_builtin_json_parser_pop (parser_p);
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+} /* ecma_builtin_json_parser_process_token */
 
-        ecma_builtin_json_parse_next_token (token_p, false);
-        if (token_p->type != TOKEN_COLON)
-        {
-          ecma_deref_ecma_string (name_p);
-          break;
-        }
+/**
+ * Checks whether the character can be part of a number or a literal token.
+ *
+ * @return true - if the character can be part of a number or a literal
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+ecma_builtin_json_is_word_char (lit_utf8_byte_t c) /**< character */
+{
+  return (lit_char_is_decimal_digit (c)
+          || (c >= LIT_CHAR_LOWERCASE_A && c <= LIT_CHAR_LOWERCASE_Z)
+          || c == LIT_CHAR_UPPERCASE_E
+          || c == LIT_CHAR_PLUS
+          || c == LIT_CHAR_MINUS
+          || c == LIT_CHAR_DOT);
+} /* ecma_builtin_json_is_word_char */
 
-        ecma_builtin_json_parse_next_token (token_p, true);
-        ecma_value_t value = ecma_builtin_json_parse_value (token_p);
+/**
+ * Find the end of a token, which may continue in the next input chunk.
+ *
+ * @return pointer after the last character of the token - if the token ends before end_p
+ *         NULL - otherwise, and the pending type is updated to continue the search in the next chunk
+ */
+static const lit_utf8_byte_t *
+ecma_builtin_json_find_token_end (uint8_t *pending_type_p, /**< [in, out] type of the token */
+                                  const lit_utf8_byte_t *current_p, /**< current position */
+                                  const lit_utf8_byte_t *end_p) /**< end of the input chunk */
+{
+  if (*pending_type_p == ECMA_JSON_PENDING_WORD)
+  {
+    while (current_p < end_p && ecma_builtin_json_is_word_char (*current_p))
+    {
+      current_p++;
+    }
 
-        if (ecma_is_value_empty (value))
-        {
-          ecma_deref_ecma_string (name_p);
-          break;
-        }
+    return (current_p < end_p) ? current_p : NULL;
+  }
 
-        ecma_builtin_json_define_value_property (object_p, name_p, value);
-        ecma_deref_ecma_string (name_p);
-        ecma_free_value (value);
+  bool is_escape = (*pending_type_p == ECMA_JSON_PENDING_STRING_ESCAPE);
 
-        ecma_builtin_json_parse_next_token (token_p, false);
-        if (token_p->type == TOKEN_RIGHT_BRACE)
-        {
-          return ecma_make_object_value (object_p);
-        }
+  while (current_p < end_p)
+  {
+    if (is_escape)
+    {
+      is_escape = false;
+    }
+    else if (*current_p == LIT_CHAR_DOUBLE_QUOTE)
+    {
+      return current_p + 1;
+    }
+    else if (*current_p == LIT_CHAR_BACKSLASH)
+    {
+      is_escape = true;
+    }
 
-        if (token_p->type != TOKEN_COMMA)
-        {
-          break;
-        }
+    current_p++;
+  }
+
+  *pending_type_p = (uint8_t) (is_escape ? ECMA_JSON_PENDING_STRING_ESCAPE : ECMA_JSON_PENDING_STRING);
+  return NULL;
+} /* ecma_builtin_json_find_token_end */
+
+/**
+ * Parse the next chunk of the input.
+ *
+ * Tokens which are not finished at the end of a chunk are copied into the pending token
+ * buffer of the parser, and they are parsed when the rest of them is received.
+ *
+ * @return true - if the input is valid so far
+ *         false - otherwise
+ */
+static bool
+ecma_builtin_json_parser_process (ecma_json_parser_t *parser_p, /**< parser state */
+                                  const lit_utf8_byte_t *data_p, /**< input chunk */
+                                  lit_utf8_size_t data_size, /**< size of the input chunk */
+                                  bool is_final) /**< true - if no more input follows */
+{
+  const lit_utf8_byte_t *current_p = data_p;
+  const lit_utf8_byte_t *end_p = data_p + data_size;
+  ecma_json_token_t token;
+
+  if (parser_p->pending_type != ECMA_JSON_PENDING_NONE)
+  {
+    const lit_utf8_byte_t *token_end_p = ecma_builtin_json_find_token_end (&parser_p->pending_type,
+                                                                           current_p,
+                                                                           end_p);
+
+    if (token_end_p == NULL)
+    {
+      if (data_size > 0)
+      {
+        ecma_stringbuilder_append_raw (&parser_p->pending_token, current_p, data_size);
+      }
 
-        ecma_builtin_json_parse_next_token (token_p, true);
+      if (!is_final)
+      {
+        return true;
       }
 
-      /*
-       * Parse error occured.
-       */
-      ecma_deref_object (object_p);
-      return ECMA_VALUE_EMPTY;
+      token_end_p = end_p;
     }
-    case TOKEN_LEFT_SQUARE:
+    else
     {
-      uint32_t length = 0;
+      ecma_stringbuilder_append_raw (&parser_p->pending_token,
+                                     current_p,
+                                     (lit_utf8_size_t) (token_end_p - current_p));
+    }
 
-      ecma_value_t array_construction = ecma_op_create_array_object (NULL, 0, false);
-      JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (array_construction));
+    current_p = token_end_p;
 
-      ecma_object_t *array_p = ecma_get_object_from_value (array_construction);
+    token.current_p = ecma_stringbuilder_get_data (&parser_p->pending_token);
+    token.end_p = token.current_p + ecma_stringbuilder_get_size (&parser_p->pending_token);
 
-      ecma_builtin_json_parse_next_token (token_p, true);
+    ecma_builtin_json_parse_next_token (&token, parser_p);
+    bool is_valid = ecma_builtin_json_parser_process_token (parser_p, &token) && token.current_p == token.end_p;
 
-      if (token_p->type == TOKEN_RIGHT_SQUARE)
+    ecma_stringbuilder_destroy (&parser_p->pending_token);
+    parser_p->pending_type = ECMA_JSON_PENDING_NONE;
+
+    if (!is_valid)
+    {
+      return false;
+    }
+  }
+
+  while (true)
+  {
+    while (current_p < end_p
+           && (*current_p == LIT_CHAR_SP
+               || *current_p == LIT_CHAR_CR
+               || *current_p == LIT_CHAR_LF
+               || *current_p == LIT_CHAR_TAB))
+    {
+      current_p++;
+    }
+
+    if (current_p == end_p)
+    {
+      break;
+    }
+
+    if (!is_final)
+    {
+      uint8_t pending_type = ECMA_JSON_PENDING_NONE;
+      const lit_utf8_byte_t *token_start_p = current_p;
+
+      if (*current_p == LIT_CHAR_DOUBLE_QUOTE)
+      {
+        pending_type = ECMA_JSON_PENDING_STRING;
+        token_start_p++;
+      }
+      else if (ecma_builtin_json_is_word_char (*current_p))
       {
-        return ecma_make_object_value (array_p);
+        pending_type = ECMA_JSON_PENDING_WORD;
       }
 
-      while (true)
+      if (pending_type != ECMA_JSON_PENDING_NONE
+          && ecma_builtin_json_find_token_end (&pending_type, token_start_p, end_p) == NULL)
       {
-        ecma_value_t value = ecma_builtin_json_parse_value (token_p);
+        parser_p->pending_type = pending_type;
+        parser_p->pending_token = ecma_stringbuilder_create_raw (current_p, (lit_utf8_size_t) (end_p - current_p));
+        return true;
+      }
+    }
 
-        if (ecma_is_value_empty (value))
-        {
-          JERRY_ASSERT (token_p->type != TOKEN_STRING);
-          break;
-        }
+    token.current_p = current_p;
+    token.end_p = end_p;
 
-        ecma_value_t completion;
-        completion = ecma_builtin_helper_def_prop_by_index (array_p,
-                                                            length,
-                                                            value,
-                                                            ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
-        JERRY_ASSERT (ecma_is_value_true (completion));
-        ecma_free_value (value);
+    ecma_builtin_json_parse_next_token (&token, parser_p);
+
+    if (!ecma_builtin_json_parser_process_token (parser_p, &token))
+    {
+      return false;
+    }
 
-        ecma_builtin_json_parse_next_token (token_p, false);
+    current_p = token.current_p;
+  }
 
-        if (token_p->type == TOKEN_RIGHT_SQUARE)
-        {
-          return ecma_make_object_value (array_p);
-        }
+  return !is_final || parser_p->state == ECMA_JSON_PARSER_END;
+} /* ecma_builtin_json_parser_process */
 
-        if (token_p->type != TOKEN_COMMA)
-        {
-          JERRY_ASSERT (token_p->type != TOKEN_STRING);
-          break;
-        }
+/**
+ * Free all resources of the parser and put it into the error state.
+ */
+static void
+ecma_builtin_json_parser_free (ecma_json_parser_t *parser_p) /**< parser state */
+{
+  if (parser_p->stack_p != NULL)
+  {
+    ecma_collection_free (parser_p->stack_p);
+    parser_p->stack_p = NULL;
+  }
 
-        ecma_builtin_json_parse_next_token (token_p, true);
-        length++;
-      }
+  ecma_free_value (parser_p->result);
+  parser_p->result = ECMA_VALUE_EMPTY;
 
-      ecma_deref_object (array_p);
-      return ECMA_VALUE_EMPTY;
-    }
-    default:
+  if (parser_p->pending_type != ECMA_JSON_PENDING_NONE)
+  {
+    ecma_stringbuilder_destroy (&parser_p->pending_token);
+    parser_p->pending_type = ECMA_JSON_PENDING_NONE;
+  }
+
+  for (uint32_t i = 0; i < ECMA_JSON_PARSER_KEY_CACHE_SIZE; i++)
+  {
+    if (parser_p->key_cache[i] != NULL)
     {
-      return ECMA_VALUE_EMPTY;
+      ecma_deref_ecma_string (parser_p->key_cache[i]);
+      parser_p->key_cache[i] = NULL;
     }
   }
-} /* ecma_builtin_json_parse_value */
+
+  parser_p->state = ECMA_JSON_PARSER_ERROR;
+} /* ecma_builtin_json_parser_free */
+
+/**
+ * Initialize a JSON parser, which receives its input in one or more chunks.
+ */
+void
+ecma_builtin_json_parser_init (ecma_json_parser_t *parser_p) /**< [out] parser state */
+{
+  parser_p->stack_p = NULL;
+  parser_p->result = ECMA_VALUE_EMPTY;
+  parser_p->state = ECMA_JSON_PARSER_VALUE;
+  parser_p->pending_type = ECMA_JSON_PENDING_NONE;
+
+  for (uint32_t i = 0; i < ECMA_JSON_PARSER_KEY_CACHE_SIZE; i++)
+  {
+    parser_p->key_cache[i] = NULL;
+  }
+} /* ecma_builtin_json_parser_init */
+
+/**
+ * Parse the next chunk of the JSON input.
+ *
+ * Note:
+ *      a chunk may end anywhere, even inside a token or a multi-byte character
+ *
+ * @return ECMA_VALUE_TRUE - if the input is valid so far
+ *         error - otherwise, and all resources of the parser are freed
+ */
+ecma_value_t
+ecma_builtin_json_parser_feed (ecma_json_parser_t *parser_p, /**< parser state */
+                               const lit_utf8_byte_t *data_p, /**< input chunk */
+                               lit_utf8_size_t data_size) /**< size of the input chunk */
+{
+  if (parser_p->state != ECMA_JSON_PARSER_ERROR
+      && ecma_builtin_json_parser_process (parser_p, data_p, data_size, false))
+  {
+    return ECMA_VALUE_TRUE;
+  }
+
+  ecma_builtin_json_parser_free (parser_p);
+  return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid JSON format."));
+} /* ecma_builtin_json_parser_feed */
+
+/**
+ * Parse the last chunk of the JSON input and free all resources of the parser.
+ *
+ * @return ecma value - the parsed value
+ *         error - if the input is not a valid JSON text
+ *         Returned value must be freed with ecma_free_value.
+ */
+ecma_value_t
+ecma_builtin_json_parser_finish (ecma_json_parser_t *parser_p, /**< parser state */
+                                 const lit_utf8_byte_t *data_p, /**< last input chunk */
+                                 lit_utf8_size_t data_size) /**< size of the last input chunk */
+{
+  ecma_value_t result = ECMA_VALUE_EMPTY;
+
+  if (parser_p->state != ECMA_JSON_PARSER_ERROR
+      && ecma_builtin_json_parser_process (parser_p, data_p, data_size, true))
+  {
+    result = parser_p->result;
+    parser_p->result = ECMA_VALUE_EMPTY;
+  }
+
+  ecma_builtin_json_parser_free (parser_p);
+
+  if (ecma_is_value_empty (result))
+  {
+    return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid JSON format."));
+  }
+
+  return result;
+} /* ecma_builtin_json_parser_finish */
 
 /**
  * Abstract operation InternalizeJSONProperty
@@ -764,25 +1204,10 @@ ecma_value_t
 ecma_builtin_json_parse_buffer (const lit_utf8_byte_t * str_start_p, /**< String to parse */
                                 lit_utf8_size_t string_size) /**< size of the string */
 {
-  ecma_json_token_t token;
-  token.current_p = str_start_p;
-  token.end_p = str_start_p + string_size;
+  ecma_json_parser_t parser;
+  ecma_builtin_json_parser_init (&parser);
 
-  ecma_builtin_json_parse_next_token (&token, true);
-  ecma_value_t result = ecma_builtin_json_parse_value (&token);
-
-  if (!ecma_is_value_empty (result))
-  {
-    ecma_builtin_json_parse_next_token (&token, false);
-    if (token.type == TOKEN_END)
-    {
-      return result;
-    }
-
-    ecma_free_value (result);
-  }
-
-  return ecma_raise_syntax_error (ECMA_ERR_MSG ("Invalid JSON format."));
+  return ecma_builtin_json_parser_finish (&parser, str_start_p, string_size);
 } /*ecma_builtin_json_parse_buffer*/
 
 /**
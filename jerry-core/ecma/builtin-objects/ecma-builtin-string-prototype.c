@@ -475,68 +475,64 @@ ecma_builtin_string_prototype_object_replace (ecma_value_t this_value, /**< this
   {
     replace_ctx.matched_size = search_size;
     const lit_utf8_byte_t *const input_end_p = replace_ctx.string_p + replace_ctx.string_size;
-    const lit_utf8_byte_t *const loop_end_p = input_end_p - search_size;
+    const lit_utf8_byte_t *curr_p = lit_utf8_string_find (replace_ctx.string_p,
+                                                          replace_ctx.string_size,
+                                                          search_buf_p,
+                                                          search_size);
 
-    lit_utf8_size_t pos = 0;
-    for (const lit_utf8_byte_t *curr_p = replace_ctx.string_p;
-         curr_p <= loop_end_p;
-         lit_utf8_incr (&curr_p), pos++)
+    if (curr_p != NULL)
     {
-      if (!memcmp (curr_p, search_buf_p, search_size))
+      const lit_utf8_size_t byte_offset = (lit_utf8_size_t) (curr_p - replace_ctx.string_p);
+      replace_ctx.builder = ecma_stringbuilder_create_raw (replace_ctx.string_p, byte_offset);
+
+      if (replace_ctx.replace_str_p == NULL)
       {
-        const lit_utf8_size_t byte_offset = (lit_utf8_size_t) (curr_p - replace_ctx.string_p);
-        replace_ctx.builder = ecma_stringbuilder_create_raw (replace_ctx.string_p, byte_offset);
+        ecma_object_t *function_p = ecma_get_object_from_value (replace_value);
 
-        if (replace_ctx.replace_str_p == NULL)
+        ecma_value_t args[] =
         {
-          ecma_object_t *function_p = ecma_get_object_from_value (replace_value);
-
-          ecma_value_t args[] =
-          {
-            ecma_make_string_value (search_str_p),
-            ecma_make_uint32_value (pos),
-            ecma_make_string_value (input_str_p)
-          };
-
-          result = ecma_op_function_call (function_p,
-                                          ECMA_VALUE_UNDEFINED,
-                                          args,
-                                          3);
-
-          if (ECMA_IS_VALUE_ERROR (result))
-          {
-            ecma_stringbuilder_destroy (&replace_ctx.builder);
-            goto cleanup_replace;
-          }
-
-          ecma_string_t *const result_str_p = ecma_op_to_string (result);
-          ecma_free_value (result);
-
-          if (result_str_p == NULL)
-          {
-            ecma_stringbuilder_destroy (&replace_ctx.builder);
-            result = ECMA_VALUE_ERROR;
-            goto cleanup_replace;
-          }
-
-          ecma_stringbuilder_append (&replace_ctx.builder, result_str_p);
-          ecma_deref_ecma_string (result_str_p);
-        }
-        else
+          ecma_make_string_value (search_str_p),
+          ecma_make_uint32_value (lit_utf8_string_length (replace_ctx.string_p, byte_offset)),
+          ecma_make_string_value (input_str_p)
+        };
+
+        result = ecma_op_function_call (function_p,
+                                        ECMA_VALUE_UNDEFINED,
+                                        args,
+                                        3);
+
+        if (ECMA_IS_VALUE_ERROR (result))
         {
-          replace_ctx.matched_p = curr_p;
-          replace_ctx.match_byte_pos = byte_offset;
+          ecma_stringbuilder_destroy (&replace_ctx.builder);
+          goto cleanup_replace;
+        }
 
-          ecma_builtin_replace_substitute (&replace_ctx);
+        ecma_string_t *const result_str_p = ecma_op_to_string (result);
+        ecma_free_value (result);
+
+        if (result_str_p == NULL)
+        {
+          ecma_stringbuilder_destroy (&replace_ctx.builder);
+          result = ECMA_VALUE_ERROR;
+          goto cleanup_replace;
         }
 
-        const lit_utf8_byte_t *const match_end_p = curr_p + search_size;
-        ecma_stringbuilder_append_raw (&replace_ctx.builder,
-                                       match_end_p,
-                                       (lit_utf8_size_t) (input_end_p - match_end_p));
-        result_string_p = ecma_stringbuilder_finalize (&replace_ctx.builder);
-        break;
+        ecma_stringbuilder_append (&replace_ctx.builder, result_str_p);
+        ecma_deref_ecma_string (result_str_p);
       }
+      else
+      {
+        replace_ctx.matched_p = curr_p;
+        replace_ctx.match_byte_pos = byte_offset;
+
+        ecma_builtin_replace_substitute (&replace_ctx);
+      }
+
+      const lit_utf8_byte_t *const match_end_p = curr_p + search_size;
+      ecma_stringbuilder_append_raw (&replace_ctx.builder,
+                                     match_end_p,
+                                     (lit_utf8_size_t) (input_end_p - match_end_p));
+      result_string_p = ecma_stringbuilder_finalize (&replace_ctx.builder);
     }
   }
 
@@ -859,6 +855,20 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_value, /**< this a
 
   while (current_p < compare_end_p)
   {
+    if (separator_size > 0)
+    {
+      /* Continue at the next occurrence of the separator. */
+      current_p = lit_utf8_string_find (current_p,
+                                        (lit_utf8_size_t) (string_end_p - current_p),
+                                        separator_buffer_p,
+                                        separator_size);
+
+      if (current_p == NULL)
+      {
+        break;
+      }
+    }
+
     if (!memcmp (current_p, separator_buffer_p, separator_size)
         && (last_str_begin_p != current_p + separator_size))
     {
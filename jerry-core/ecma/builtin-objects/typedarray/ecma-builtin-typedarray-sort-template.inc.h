@@ -0,0 +1,238 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * In-place introsort of unsigned integer keys stored in a TypedArray buffer.
+ *
+ * The keys are read and written with memcpy, so the buffer does not need to be aligned.
+ */
+
+#if ENABLED (JERRY_BUILTIN_TYPEDARRAY)
+
+#ifndef TYPEDARRAY_SORT_KEY_TYPE
+# error "Please define TYPEDARRAY_SORT_KEY_TYPE"
+#endif /* !TYPEDARRAY_SORT_KEY_TYPE */
+
+#ifndef TYPEDARRAY_SORT_KEY_NAME
+# error "Please define TYPEDARRAY_SORT_KEY_NAME"
+#endif /* !TYPEDARRAY_SORT_KEY_NAME */
+
+#define TYPEDARRAY_SORT_PASTE__(x, y) x ## y
+#define TYPEDARRAY_SORT_PASTE_(x, y) TYPEDARRAY_SORT_PASTE__ (x, y)
+#define TYPEDARRAY_SORT_ROUTINE(name) TYPEDARRAY_SORT_PASTE_ (name, TYPEDARRAY_SORT_KEY_NAME)
+
+/**
+ * Read the key at the given index.
+ *
+ * @return key
+ */
+static inline TYPEDARRAY_SORT_KEY_TYPE JERRY_ATTR_ALWAYS_INLINE
+TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (const lit_utf8_byte_t *buffer_p, /**< buffer of the keys */
+                                                      uint32_t index) /**< index of the key */
+{
+  TYPEDARRAY_SORT_KEY_TYPE key;
+  memcpy (&key, buffer_p + (size_t) index * sizeof (TYPEDARRAY_SORT_KEY_TYPE), sizeof (TYPEDARRAY_SORT_KEY_TYPE));
+  return key;
+} /* ecma_typedarray_sort_load_ */
+
+/**
+ * Write the key at the given index.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (lit_utf8_byte_t *buffer_p, /**< buffer of the keys */
+                                                       uint32_t index, /**< index of the key */
+                                                       TYPEDARRAY_SORT_KEY_TYPE key) /**< key */
+{
+  memcpy (buffer_p + (size_t) index * sizeof (TYPEDARRAY_SORT_KEY_TYPE), &key, sizeof (TYPEDARRAY_SORT_KEY_TYPE));
+} /* ecma_typedarray_sort_store_ */
+
+/**
+ * Swap the keys at the given indices.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_swap_) (lit_utf8_byte_t *buffer_p, /**< buffer of the keys */
+                                                      uint32_t index1, /**< index of the first key */
+                                                      uint32_t index2) /**< index of the second key */
+{
+  TYPEDARRAY_SORT_KEY_TYPE key1 = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, index1);
+  TYPEDARRAY_SORT_KEY_TYPE key2 = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, index2);
+
+  TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (buffer_p, index1, key2);
+  TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (buffer_p, index2, key1);
+} /* ecma_typedarray_sort_swap_ */
+
+/**
+ * Move the key at the given index down in a max-heap.
+ */
+static void
+TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_sift_down_) (lit_utf8_byte_t *buffer_p, /**< buffer of the keys */
+                                                           uint32_t index, /**< index of the key */
+                                                           uint32_t length) /**< number of keys in the heap */
+{
+  TYPEDARRAY_SORT_KEY_TYPE key = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, index);
+
+  while (index < length / 2)
+  {
+    uint32_t child_index = 2 * index + 1;
+    TYPEDARRAY_SORT_KEY_TYPE child_key = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, child_index);
+
+    if (child_index + 1 < length)
+    {
+      TYPEDARRAY_SORT_KEY_TYPE right_key = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p,
+                                                                                                 child_index + 1);
+
+      if (child_key < right_key)
+      {
+        child_index++;
+        child_key = right_key;
+      }
+    }
+
+    if (child_key <= key)
+    {
+      break;
+    }
+
+    TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (buffer_p, index, child_key);
+    index = child_index;
+  }
+
+  TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (buffer_p, index, key);
+} /* ecma_typedarray_sort_sift_down_ */
+
+/**
+ * Sort the keys in ascending order.
+ *
+ * Quicksort is used until the recursion depth limit is reached, then the sort
+ * continues with heapsort. Short ranges are finished with insertion sort.
+ */
+static void
+TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_keys_) (lit_utf8_byte_t *buffer_p, /**< buffer of the keys */
+                                                      uint32_t length, /**< number of keys */
+                                                      uint32_t depth_limit) /**< recursion depth limit */
+{
+  while (length > ECMA_TYPEDARRAY_SORT_INSERTION_LIMIT)
+  {
+    if (depth_limit == 0)
+    {
+      for (uint32_t i = length / 2; i > 0; i--)
+      {
+        TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_sift_down_) (buffer_p, i - 1, length);
+      }
+
+      for (uint32_t i = length - 1; i > 0; i--)
+      {
+        TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_swap_) (buffer_p, 0, i);
+        TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_sift_down_) (buffer_p, 0, i);
+      }
+      return;
+    }
+
+    depth_limit--;
+
+    /* The median of the first, middle and last keys is the pivot. Ordering the three
+     * keys guarantees that neither side of the partition is empty. */
+    uint32_t middle = length / 2;
+
+    if (TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, middle)
+        < TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, 0))
+    {
+      TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_swap_) (buffer_p, 0, middle);
+    }
+
+    if (TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, length - 1)
+        < TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, middle))
+    {
+      TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_swap_) (buffer_p, middle, length - 1);
+
+      if (TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, middle)
+          < TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, 0))
+      {
+        TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_swap_) (buffer_p, 0, middle);
+      }
+    }
+
+    TYPEDARRAY_SORT_KEY_TYPE pivot = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, middle);
+    uint32_t left = 0;
+    uint32_t right = length - 1;
+
+    while (true)
+    {
+      while (TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, left) < pivot)
+      {
+        left++;
+      }
+
+      while (pivot < TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, right))
+      {
+        right--;
+      }
+
+      if (left >= right)
+      {
+        break;
+      }
+
+      TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_swap_) (buffer_p, left, right);
+      left++;
+      right--;
+    }
+
+    /* Recurse into the shorter side, and continue with the longer one. */
+    uint32_t left_length = right + 1;
+    lit_utf8_byte_t *right_buffer_p = buffer_p + (size_t) left_length * sizeof (TYPEDARRAY_SORT_KEY_TYPE);
+
+    if (left_length < length - left_length)
+    {
+      TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_keys_) (buffer_p, left_length, depth_limit);
+      buffer_p = right_buffer_p;
+      length -= left_length;
+    }
+    else
+    {
+      TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_keys_) (right_buffer_p, length - left_length, depth_limit);
+      length = left_length;
+    }
+  }
+
+  for (uint32_t i = 1; i < length; i++)
+  {
+    TYPEDARRAY_SORT_KEY_TYPE key = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, i);
+    uint32_t j = i;
+
+    while (j > 0)
+    {
+      TYPEDARRAY_SORT_KEY_TYPE prev_key = TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_load_) (buffer_p, j - 1);
+
+      if (prev_key <= key)
+      {
+        break;
+      }
+
+      TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (buffer_p, j, prev_key);
+      j--;
+    }
+
+    TYPEDARRAY_SORT_ROUTINE (ecma_typedarray_sort_store_) (buffer_p, j, key);
+  }
+} /* ecma_typedarray_sort_keys_ */
+
+#undef TYPEDARRAY_SORT_ROUTINE
+#undef TYPEDARRAY_SORT_PASTE_
+#undef TYPEDARRAY_SORT_PASTE__
+#undef TYPEDARRAY_SORT_KEY_NAME
+#undef TYPEDARRAY_SORT_KEY_TYPE
+
+#endif /* ENABLED (JERRY_BUILTIN_TYPEDARRAY) */
@@ -258,7 +258,7 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
       ecma_free_value_if_not_object (values_p[index]);
     }
 
-    values_p[index] = ecma_copy_value_if_not_object (value);
+    values_p[index] = ecma_copy_value_if_not_object_into (object_p, value);
 
     return true;
   }
@@ -296,7 +296,7 @@ ecma_fast_array_set_property (ecma_object_t *object_p, /**< fast access mode arr
     ext_obj_p->u.array.u.hole_count -= ECMA_FAST_ARRAY_HOLE_ONE;
   }
 
-  values_p[index] = ecma_copy_value_if_not_object (value);
+  values_p[index] = ecma_copy_value_if_not_object_into (object_p, value);
 
   return true;
 } /* ecma_fast_array_set_property */
@@ -632,7 +632,7 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
        index++)
   {
     JERRY_ASSERT (!ecma_is_value_array_hole (array_items_p[index]));
-    values_p[index] = ecma_copy_value_if_not_object (array_items_p[index]);
+    values_p[index] = ecma_copy_value_if_not_object_into (object_p, array_items_p[index]);
   }
 
   ext_obj_p->u.array.u.hole_count -= ECMA_FAST_ARRAY_HOLE_ONE * array_items_count;
@@ -61,6 +61,11 @@ ecma_async_generator_enqueue (vm_executable_object_t *async_generator_object_p,
   JERRY_CONTEXT (current_new_target) = old_new_target_p;
   task_p->promise = result;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  /* The task is referenced by the async generator. */
+  ecma_gc_remember_object ((ecma_object_t *) async_generator_object_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   ecma_value_t head = async_generator_object_p->extended_object.u.class_prop.u.head;
 
   if (ECMA_IS_INTERNAL_VALUE_NULL (head))
@@ -513,6 +518,9 @@ ecma_await_continue (vm_executable_object_t *executable_object_p, /**< executabl
         ecma_deref_if_object (result);
         stack_top_p[-1] |= VM_CONTEXT_CLOSE_ITERATOR;
         stack_top_p[-2] = result;
+#if ENABLED (JERRY_GENERATIONAL_GC)
+        ecma_gc_remember_object ((ecma_object_t *) executable_object_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
         ECMA_EXECUTABLE_OBJECT_RESUME_EXEC (executable_object_p);
         return ECMA_VALUE_EMPTY;
       }
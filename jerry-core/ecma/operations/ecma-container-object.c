@@ -41,6 +41,7 @@
  * Note:
  *   The first element of the collection tracks the size of the buffer.
  *   ECMA_VALUE_EMPTY values are not calculated into the size.
+ *   The second element refers to the hash index of the buffer.
  *
  * @return pointer to the internal buffer
  */
@@ -48,11 +49,178 @@ static inline ecma_collection_t *
 ecma_op_create_internal_buffer (void)
 {
   ecma_collection_t *collection_p = ecma_new_collection ();
-  ecma_collection_push_back (collection_p, (ecma_value_t) 0);
+  ecma_value_t header[ECMA_CONTAINER_HEADER_SIZE] = { (ecma_value_t) 0, (ecma_value_t) 0 };
+  ecma_collection_append (collection_p, header, ECMA_CONTAINER_HEADER_SIZE);
+  ECMA_CONTAINER_SET_HASH_INDEX (collection_p, NULL);
 
   return collection_p;
 } /* ecma_op_create_internal_buffer */
 
+/**
+ * Minimum number of entries in a container before a hash index is built for it.
+ * Smaller containers are searched linearly.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_THRESHOLD 8
+
+/**
+ * Minimum number of buckets in a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_MIN_SIZE 16
+
+/**
+ * Get the buckets of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_GET_BUCKETS(index_p) \
+  ((uint32_t *) (((ecma_container_hash_index_t *) (index_p)) + 1))
+
+/**
+ * Get the allocated size of a hash index.
+ */
+#define ECMA_CONTAINER_HASH_INDEX_GET_SIZE(index_p) \
+  (sizeof (ecma_container_hash_index_t) + (((size_t) (index_p)->mask + 1) * sizeof (uint32_t)))
+
+/**
+ * Calculate the hash of a key. Keys which are equal according to
+ * the SameValueZero algorithm have the same hash.
+ *
+ * @return hash value
+ */
+static uint32_t
+ecma_op_container_hash (ecma_value_t key_arg) /**< key argument */
+{
+  uint32_t hash;
+
+  if (ecma_is_value_integer_number (key_arg))
+  {
+    hash = (uint32_t) ecma_get_integer_from_value (key_arg);
+  }
+  else if (ecma_is_value_float_number (key_arg))
+  {
+    ecma_number_t number = ecma_get_float_from_value (key_arg);
+
+    if (ecma_number_is_nan (number))
+    {
+      hash = 0;
+    }
+    else if (number >= INT32_MIN && number <= INT32_MAX && number == (ecma_number_t) (int32_t) number)
+    {
+      /* Integral values must have the same hash as integer values, this also covers negative zero. */
+      hash = (uint32_t) (int32_t) number;
+    }
+    else
+    {
+      hash = lit_utf8_string_calc_hash ((const lit_utf8_byte_t *) &number, sizeof (ecma_number_t));
+    }
+  }
+  else if (ecma_is_value_string (key_arg))
+  {
+    hash = ecma_string_hash (ecma_get_string_from_value (key_arg));
+  }
+  else
+  {
+    /* Other values are compared by identity. */
+    hash = (uint32_t) key_arg;
+  }
+
+  /* Mix the bits, since the buckets are selected by the lowest bits of the hash. */
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  return hash;
+} /* ecma_op_container_hash */
+
+/**
+ * Free the hash index of the internal buffer.
+ */
+static void
+ecma_op_container_hash_index_free (ecma_collection_t *container_p) /**< internal container pointer */
+{
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+
+  if (index_p != NULL)
+  {
+    jmem_heap_free_block (index_p, ECMA_CONTAINER_HASH_INDEX_GET_SIZE (index_p));
+    ECMA_CONTAINER_SET_HASH_INDEX (container_p, NULL);
+  }
+} /* ecma_op_container_hash_index_free */
+
+/**
+ * Insert an entry into a hash index. The index must have a free bucket.
+ */
+static void
+ecma_op_container_hash_index_insert (ecma_container_hash_index_t *index_p, /**< hash index */
+                                     ecma_value_t *start_p, /**< first entry of the internal buffer */
+                                     uint32_t hash, /**< hash of the key */
+                                     uint32_t offset) /**< offset of the entry */
+{
+  uint32_t *buckets_p = ECMA_CONTAINER_HASH_INDEX_GET_BUCKETS (index_p);
+  uint32_t mask = index_p->mask;
+  uint32_t bucket = hash & mask;
+
+  /* Buckets of deleted entries are reused. */
+  while (buckets_p[bucket] != 0 && !ecma_is_value_empty (start_p[buckets_p[bucket] - 1]))
+  {
+    bucket = (bucket + 1) & mask;
+  }
+
+  if (buckets_p[bucket] == 0)
+  {
+    JERRY_ASSERT (index_p->used < mask);
+    index_p->used++;
+  }
+
+  buckets_p[bucket] = offset + 1;
+} /* ecma_op_container_hash_index_insert */
+
+/**
+ * (Re)build the hash index of the internal buffer from its live entries.
+ *
+ * Note:
+ *      the index is not created if there is not enough memory, in which case
+ *      the entries are searched linearly
+ */
+static void
+ecma_op_container_hash_index_rebuild (ecma_collection_t *container_p, /**< internal container pointer */
+                                      uint8_t entry_size) /**< size of the entries */
+{
+  /* Free the old index first to reduce peak memory consumption. */
+  ecma_op_container_hash_index_free (container_p);
+
+  uint32_t bucket_count = ECMA_CONTAINER_HASH_INDEX_MIN_SIZE;
+
+  /* The load factor of the new index is at most 50%. */
+  while (bucket_count < ECMA_CONTAINER_GET_SIZE (container_p) * 2)
+  {
+    bucket_count <<= 1;
+  }
+
+  size_t size = sizeof (ecma_container_hash_index_t) + bucket_count * sizeof (uint32_t);
+  ecma_container_hash_index_t *index_p;
+  index_p = (ecma_container_hash_index_t *) jmem_heap_alloc_block_null_on_error (size);
+
+  if (index_p == NULL)
+  {
+    return;
+  }
+
+  index_p->mask = bucket_count - 1;
+  index_p->used = 0;
+  memset (ECMA_CONTAINER_HASH_INDEX_GET_BUCKETS (index_p), 0, bucket_count * sizeof (uint32_t));
+
+  uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  for (uint32_t i = 0; i < entry_count; i += entry_size)
+  {
+    if (!ecma_is_value_empty (start_p[i]))
+    {
+      ecma_op_container_hash_index_insert (index_p, start_p, ecma_op_container_hash (start_p[i]), i);
+    }
+  }
+
+  ECMA_CONTAINER_SET_HASH_INDEX (container_p, index_p);
+} /* ecma_op_container_hash_index_rebuild */
+
 /**
  * Append values to the internal buffer.
  */
@@ -64,6 +232,8 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
 {
   JERRY_ASSERT (container_p != NULL);
 
+  uint32_t offset = ECMA_CONTAINER_ENTRY_COUNT (container_p);
+
   if (lit_id == LIT_MAGIC_STRING_WEAKMAP_UL || lit_id == LIT_MAGIC_STRING_MAP_UL)
   {
     ecma_value_t values[] = { ecma_copy_value_if_not_object (key_arg), ecma_copy_value_if_not_object (value_arg) };
@@ -74,7 +244,29 @@ ecma_op_internal_buffer_append (ecma_collection_t *container_p, /**< internal co
     ecma_collection_push_back (container_p, ecma_copy_value_if_not_object (key_arg));
   }
 
-  ECMA_CONTAINER_SET_SIZE (container_p, ECMA_CONTAINER_GET_SIZE (container_p) + 1);
+  uint32_t size = ECMA_CONTAINER_GET_SIZE (container_p) + 1;
+  ECMA_CONTAINER_SET_SIZE (container_p, size);
+
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+
+  if (index_p != NULL)
+  {
+    if (index_p->used < index_p->mask - (index_p->mask >> 2))
+    {
+      ecma_op_container_hash_index_insert (index_p,
+                                           ECMA_CONTAINER_START (container_p),
+                                           ecma_op_container_hash (key_arg),
+                                           offset);
+      return;
+    }
+  }
+  else if (size < ECMA_CONTAINER_HASH_INDEX_THRESHOLD || (size & (size - 1)) != 0)
+  {
+    /* Creating the index is only retried when the size of the container is doubled. */
+    return;
+  }
+
+  ecma_op_container_hash_index_rebuild (container_p, ecma_op_container_entry_size (lit_id));
 } /* ecma_op_internal_buffer_append */
 
 /**
@@ -130,9 +322,31 @@ ecma_op_internal_buffer_find (ecma_collection_t *container_p, /**< internal cont
 {
   JERRY_ASSERT (container_p != NULL);
 
+  ecma_container_hash_index_t *index_p = ECMA_CONTAINER_GET_HASH_INDEX (container_p);
+  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
+
+  if (index_p != NULL)
+  {
+    uint32_t *buckets_p = ECMA_CONTAINER_HASH_INDEX_GET_BUCKETS (index_p);
+    uint32_t mask = index_p->mask;
+
+    for (uint32_t bucket = ecma_op_container_hash (key_arg) & mask;
+         buckets_p[bucket] != 0;
+         bucket = (bucket + 1) & mask)
+    {
+      ecma_value_t *entry_p = start_p + buckets_p[bucket] - 1;
+
+      if (!ecma_is_value_empty (*entry_p) && ecma_op_same_value_zero (*entry_p, key_arg))
+      {
+        return entry_p;
+      }
+    }
+
+    return NULL;
+  }
+
   uint8_t entry_size = ecma_op_container_entry_size (lit_id);
   uint32_t entry_count = ECMA_CONTAINER_ENTRY_COUNT (container_p);
-  ecma_value_t *start_p = ECMA_CONTAINER_START (container_p);
 
   for (uint32_t i = 0; i < entry_count; i += entry_size)
   {
@@ -355,6 +569,7 @@ ecma_op_container_free_entries (ecma_object_t *object_p) /**< collection object
   }
 
   ECMA_CONTAINER_SET_SIZE (container_p, 0);
+  ecma_op_container_hash_index_free (container_p);
 } /* ecma_op_container_free_entries */
 
 /**
@@ -664,6 +664,10 @@ ecma_op_get_capabilities_executor_cb (const ecma_value_t function_obj, /**< the
   /* 7. */
   capability_p->reject = args_count > 1 ? args_p[1] : ECMA_VALUE_UNDEFINED;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_gc_remember_object (capability_obj_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   /* 8. */
   return ECMA_VALUE_UNDEFINED;
 } /* ecma_op_get_capabilities_executor_cb */
@@ -744,6 +748,10 @@ ecma_promise_new_capability (ecma_value_t constructor)
   /* 10. */
   capability_p->header.u.class_prop.u.promise = promise;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_gc_remember_object (capability_obj_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   ecma_free_value (promise);
 
   /* 11. */
@@ -880,6 +888,10 @@ ecma_promise_do_then (ecma_value_t promise, /**< the promise which call 'then' *
     {
       ecma_collection_push_back (promise_p->reactions, on_rejected);
     }
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+    ecma_gc_remember_object (promise_obj_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
   }
   else if (flags & ECMA_PROMISE_IS_FULFILLED)
   {
@@ -1197,6 +1209,10 @@ ecma_promise_async_then (ecma_value_t promise, /**< promise object */
     ECMA_SET_THIRD_BIT_TO_POINTER_TAG (executable_object_with_tag);
 
     ecma_collection_push_back (((ecma_promise_object_t *) promise_obj_p)->reactions, executable_object_with_tag);
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+    ecma_gc_remember_object (promise_obj_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
     return;
   }
 
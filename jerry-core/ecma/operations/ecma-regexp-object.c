@@ -46,6 +46,26 @@
  */
 #define RE_GLOBAL_CAPTURE 0
 
+#if ENABLED (JERRY_REGEXP_NFA)
+
+/**
+ * Number of times the backtracking matcher can backtrack before the NFA matcher takes over,
+ * in addition to RE_NFA_STEPS_PER_BYTE steps for each byte of the input string.
+ */
+#define RE_NFA_STEP_BASE 65536u
+
+/**
+ * Number of additional backtracking steps for each byte of the input string.
+ */
+#define RE_NFA_STEPS_PER_BYTE 32u
+
+/**
+ * Marker of undefined capture offsets in the NFA matcher.
+ */
+#define RE_NFA_UNDEFINED UINT32_MAX
+
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
 /**
  * Parse RegExp flags (global, ignoreCase, multiline)
  *
@@ -646,6 +666,205 @@ ecma_regexp_is_word_boundary (ecma_regexp_ctx_t *re_ctx_p, /**< regexp context *
   return lit_char_is_word_char (left_cp) != lit_char_is_word_char (right_cp);
 } /* ecma_regexp_is_word_boundary */
 
+/**
+ * Check a zero-width assertion (line start, line end or word boundary).
+ *
+ * @return true - if the assertion holds at the given position
+ *         false - otherwise
+ */
+static bool
+ecma_regexp_check_assertion (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                             re_opcode_t op, /**< opcode of the assertion */
+                             const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  switch (op)
+  {
+    case RE_OP_ASSERT_LINE_START:
+    {
+      if (str_curr_p <= re_ctx_p->input_start_p)
+      {
+        return true;
+      }
+
+      return ((re_ctx_p->flags & RE_FLAG_MULTILINE)
+              && lit_char_is_line_terminator (lit_cesu8_peek_prev (str_curr_p)));
+    }
+    case RE_OP_ASSERT_LINE_END:
+    {
+      if (str_curr_p >= re_ctx_p->input_end_p)
+      {
+        return true;
+      }
+
+      return ((re_ctx_p->flags & RE_FLAG_MULTILINE)
+              && lit_char_is_line_terminator (lit_cesu8_peek_next (str_curr_p)));
+    }
+    case RE_OP_ASSERT_WORD_BOUNDARY:
+    {
+      return ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p);
+    }
+    default:
+    {
+      JERRY_ASSERT (op == RE_OP_ASSERT_NOT_WORD_BOUNDARY);
+      return !ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p);
+    }
+  }
+} /* ecma_regexp_check_assertion */
+
+/**
+ * Match a character atom (character, character class, class escape or period).
+ *
+ * @return pointer to the input string after the matched character
+ *         NULL, if the character did not match
+ */
+static inline const lit_utf8_byte_t * JERRY_ATTR_ALWAYS_INLINE
+ecma_regexp_match_char (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                        re_opcode_t op, /**< opcode of the atom */
+                        const uint8_t **bc_p, /**< [in, out] pointer to the operands of the atom */
+                        const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  if (str_curr_p >= re_ctx_p->input_end_p)
+  {
+    return NULL;
+  }
+
+  switch (op)
+  {
+    case RE_OP_CLASS_ESCAPE:
+    {
+      const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_curr_p);
+
+      const ecma_class_escape_t escape = (ecma_class_escape_t) re_get_byte (bc_p);
+      if (!ecma_regexp_check_class_escape (cp, escape))
+      {
+        return NULL;
+      }
+
+      return str_curr_p;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      uint8_t flags = re_get_byte (bc_p);
+      uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (bc_p) : 0;
+      uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (bc_p) : 0;
+
+      const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_curr_p);
+
+      uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
+      while (escape_count > 0)
+      {
+        escape_count--;
+        const ecma_class_escape_t escape = re_get_byte (bc_p);
+        if (ecma_regexp_check_class_escape (cp, escape))
+        {
+          goto class_found;
+        }
+      }
+
+      while (char_count > 0)
+      {
+        char_count--;
+        const lit_code_point_t curr = re_get_char (bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+        if (cp == curr)
+        {
+          goto class_found;
+        }
+      }
+
+      while (range_count > 0)
+      {
+        range_count--;
+        const lit_code_point_t begin = re_get_char (bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+
+        if (cp < begin)
+        {
+          *bc_p += re_ctx_p->char_size;
+          continue;
+        }
+
+        const lit_code_point_t end = re_get_char (bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+        if (cp <= end)
+        {
+          goto class_found;
+        }
+      }
+
+      /* Not found */
+      if (flags & RE_CLASS_INVERT)
+      {
+        return str_curr_p;
+      }
+
+      return NULL;
+
+class_found:
+      if (flags & RE_CLASS_INVERT)
+      {
+        return NULL;
+      }
+
+      const uint32_t chars_size = char_count * re_ctx_p->char_size;
+      const uint32_t ranges_size = range_count * re_ctx_p->char_size * 2;
+      *bc_p = *bc_p + escape_count + chars_size + ranges_size;
+      return str_curr_p;
+    }
+#if ENABLED (JERRY_ESNEXT)
+    case RE_OP_UNICODE_PERIOD:
+    {
+      const lit_code_point_t cp = ecma_regexp_unicode_advance (&str_curr_p, re_ctx_p->input_end_p);
+
+      if (!(re_ctx_p->flags & RE_FLAG_DOTALL)
+          && JERRY_UNLIKELY (cp <= LIT_UTF16_CODE_UNIT_MAX
+                             && lit_char_is_line_terminator ((ecma_char_t) cp)))
+      {
+        return NULL;
+      }
+
+      return str_curr_p;
+    }
+#endif /* ENABLED (JERRY_ESNEXT) */
+    case RE_OP_PERIOD:
+    {
+      const ecma_char_t ch = lit_cesu8_read_next (&str_curr_p);
+#if !ENABLED (JERRY_ESNEXT)
+      bool has_dot_all_flag = false;
+#else /* ENABLED (JERRY_ESNEXT) */
+      bool has_dot_all_flag = (re_ctx_p->flags & RE_FLAG_DOTALL) != 0;
+#endif /* !ENABLED (JERRY_ESNEXT) */
+
+      if (!has_dot_all_flag && lit_char_is_line_terminator (ch))
+      {
+        return NULL;
+      }
+
+      return str_curr_p;
+    }
+    case RE_OP_CHAR:
+    {
+      const lit_code_point_t ch1 = re_get_char (bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
+      const lit_code_point_t ch2 = ecma_regexp_advance (re_ctx_p, &str_curr_p);
+
+      if (ch1 != ch2)
+      {
+        return NULL;
+      }
+
+      return str_curr_p;
+    }
+    default:
+    {
+      JERRY_ASSERT (op == RE_OP_BYTE);
+
+      if (*(*bc_p)++ != *str_curr_p++)
+      {
+        return NULL;
+      }
+
+      return str_curr_p;
+    }
+  }
+} /* ecma_regexp_match_char */
+
 /**
  * Recursive function for executing RegExp bytecode.
  *
@@ -667,6 +886,14 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
   }
 #endif /* JERRY_STACK_LIMIT != 0 */
 
+#if ENABLED (JERRY_REGEXP_NFA)
+  if (JERRY_UNLIKELY (re_ctx_p->steps_left == 0) && re_ctx_p->nfa_program_p != NULL)
+  {
+    /* Step budget exhausted, the match is completed by the NFA matcher. */
+    return NULL;
+  }
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
   const lit_utf8_byte_t *str_start_p = str_curr_p;
   const uint8_t *next_alternative_p = NULL;
 
@@ -1282,45 +1509,11 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
         continue;
       }
       case RE_OP_ASSERT_LINE_START:
-      {
-        if (str_curr_p <= re_ctx_p->input_start_p)
-        {
-          continue;
-        }
-
-        if (!(re_ctx_p->flags & RE_FLAG_MULTILINE) || !lit_char_is_line_terminator (lit_cesu8_peek_prev (str_curr_p)))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_LINE_END:
-      {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          continue;
-        }
-
-        if (!(re_ctx_p->flags & RE_FLAG_MULTILINE) || !lit_char_is_line_terminator (lit_cesu8_peek_next (str_curr_p)))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_WORD_BOUNDARY:
-      {
-        if (!ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p))
-        {
-          goto fail;
-        }
-
-        continue;
-      }
       case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
       {
-        if (ecma_regexp_is_word_boundary (re_ctx_p, str_curr_p))
+        if (!ecma_regexp_check_assertion (re_ctx_p, op, str_curr_p))
         {
           goto fail;
         }
@@ -1416,15 +1609,9 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
       }
       case RE_OP_CLASS_ESCAPE:
       {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          goto fail;
-        }
-
-        const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_curr_p);
+        str_curr_p = ecma_regexp_match_char (re_ctx_p, RE_OP_CLASS_ESCAPE, &bc_p, str_curr_p);
 
-        const ecma_class_escape_t escape = (ecma_class_escape_t) re_get_byte (&bc_p);
-        if (!ecma_regexp_check_class_escape (cp, escape))
+        if (str_curr_p == NULL)
         {
           goto fail;
         }
@@ -1433,88 +1620,21 @@ ecma_regexp_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
       }
       case RE_OP_CHAR_CLASS:
       {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          goto fail;
-        }
-
-        uint8_t flags = re_get_byte (&bc_p);
-        uint32_t char_count = (flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
-        uint32_t range_count = (flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+        str_curr_p = ecma_regexp_match_char (re_ctx_p, RE_OP_CHAR_CLASS, &bc_p, str_curr_p);
 
-        const lit_code_point_t cp = ecma_regexp_advance (re_ctx_p, &str_curr_p);
-
-        uint8_t escape_count = flags & RE_CLASS_ESCAPE_COUNT_MASK;
-        while (escape_count > 0)
-        {
-          escape_count--;
-          const ecma_class_escape_t escape = re_get_byte (&bc_p);
-          if (ecma_regexp_check_class_escape (cp, escape))
-          {
-            goto class_found;
-          }
-        }
-
-        while (char_count > 0)
-        {
-          char_count--;
-          const lit_code_point_t curr = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-          if (cp == curr)
-          {
-            goto class_found;
-          }
-        }
-
-        while (range_count > 0)
-        {
-          range_count--;
-          const lit_code_point_t begin = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-
-          if (cp < begin)
-          {
-            bc_p += re_ctx_p->char_size;
-            continue;
-          }
-
-          const lit_code_point_t end = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-          if (cp <= end)
-          {
-            goto class_found;
-          }
-        }
-
-        /* Not found */
-        if (flags & RE_CLASS_INVERT)
-        {
-          continue;
-        }
-
-        goto fail;
-
-class_found:
-        if (flags & RE_CLASS_INVERT)
+        if (str_curr_p == NULL)
         {
           goto fail;
         }
 
-        const uint32_t chars_size = char_count * re_ctx_p->char_size;
-        const uint32_t ranges_size = range_count * re_ctx_p->char_size * 2;
-        bc_p = bc_p + escape_count + chars_size + ranges_size;
         continue;
       }
 #if ENABLED (JERRY_ESNEXT)
       case RE_OP_UNICODE_PERIOD:
       {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          goto fail;
-        }
-
-        const lit_code_point_t cp = ecma_regexp_unicode_advance (&str_curr_p, re_ctx_p->input_end_p);
+        str_curr_p = ecma_regexp_match_char (re_ctx_p, RE_OP_UNICODE_PERIOD, &bc_p, str_curr_p);
 
-        if (!(re_ctx_p->flags & RE_FLAG_DOTALL)
-            && JERRY_UNLIKELY (cp <= LIT_UTF16_CODE_UNIT_MAX
-                               && lit_char_is_line_terminator ((ecma_char_t) cp)))
+        if (str_curr_p == NULL)
         {
           goto fail;
         }
@@ -1524,19 +1644,9 @@ class_found:
 #endif /* ENABLED (JERRY_ESNEXT) */
       case RE_OP_PERIOD:
       {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          goto fail;
-        }
+        str_curr_p = ecma_regexp_match_char (re_ctx_p, RE_OP_PERIOD, &bc_p, str_curr_p);
 
-        const ecma_char_t ch = lit_cesu8_read_next (&str_curr_p);
-#if !ENABLED (JERRY_ESNEXT)
-        bool has_dot_all_flag = false;
-#else /* ENABLED (JERRY_ESNEXT) */
-        bool has_dot_all_flag = (re_ctx_p->flags & RE_FLAG_DOTALL) != 0;
-#endif /* !ENABLED (JERRY_ESNEXT) */
-
-        if (!has_dot_all_flag && lit_char_is_line_terminator (ch))
+        if (str_curr_p == NULL)
         {
           goto fail;
         }
@@ -1545,15 +1655,9 @@ class_found:
       }
       case RE_OP_CHAR:
       {
-        if (str_curr_p >= re_ctx_p->input_end_p)
-        {
-          goto fail;
-        }
-
-        const lit_code_point_t ch1 = re_get_char (&bc_p, re_ctx_p->flags & RE_FLAG_UNICODE);
-        const lit_code_point_t ch2 = ecma_regexp_advance (re_ctx_p, &str_curr_p);
+        str_curr_p = ecma_regexp_match_char (re_ctx_p, RE_OP_CHAR, &bc_p, str_curr_p);
 
-        if (ch1 != ch2)
+        if (str_curr_p == NULL)
         {
           goto fail;
         }
@@ -1564,8 +1668,9 @@ class_found:
       {
         JERRY_ASSERT (op == RE_OP_BYTE);
 
-        if (str_curr_p >= re_ctx_p->input_end_p
-            || *bc_p++ != *str_curr_p++)
+        str_curr_p = ecma_regexp_match_char (re_ctx_p, RE_OP_BYTE, &bc_p, str_curr_p);
+
+        if (str_curr_p == NULL)
         {
           goto fail;
         }
@@ -1576,6 +1681,19 @@ class_found:
 
     JERRY_UNREACHABLE ();
 fail:
+#if ENABLED (JERRY_REGEXP_NFA)
+    if (JERRY_UNLIKELY (re_ctx_p->steps_left == 0))
+    {
+      if (re_ctx_p->nfa_program_p != NULL)
+      {
+        return NULL;
+      }
+
+      re_ctx_p->steps_left = UINT32_MAX;
+    }
+
+    re_ctx_p->steps_left--;
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
     bc_p = next_alternative_p;
 
     if (bc_p == NULL || *bc_p++ != RE_OP_ALTERNATIVE_NEXT)
@@ -1591,6 +1709,293 @@ fail:
   }
 } /* ecma_regexp_run */
 
+#if ENABLED (JERRY_REGEXP_NFA)
+
+/**
+ * Thread list of the NFA matcher
+ */
+typedef struct
+{
+  uint16_t *pc_p;                    /**< instruction indices of the threads */
+  uint32_t *slots_p;                 /**< capture offsets of the threads */
+  uint32_t count;                    /**< number of threads */
+} ecma_regexp_nfa_list_t;
+
+/**
+ * NFA matcher state
+ */
+typedef struct
+{
+  ecma_regexp_ctx_t *re_ctx_p;       /**< RegExp matcher context */
+  uint32_t *marks_p;                 /**< last generation in which each instruction has been visited */
+  uint32_t generation;               /**< current generation */
+  uint32_t slot_count;               /**< number of capture offsets of a thread */
+} ecma_regexp_nfa_t;
+
+/**
+ * Add a thread to an NFA thread list, following all instructions which do not consume characters.
+ *
+ * Threads are added in priority order, and each instruction is added at most once per generation,
+ * so the lower priority threads which reach the same instruction are dropped.
+ */
+static void
+ecma_regexp_nfa_add_thread (ecma_regexp_nfa_t *nfa_p, /**< NFA matcher state */
+                            ecma_regexp_nfa_list_t *list_p, /**< thread list */
+                            uint32_t pc, /**< instruction index */
+                            uint32_t *slots_p, /**< capture offsets of the thread (restored before return) */
+                            const lit_utf8_byte_t *str_curr_p) /**< input string pointer */
+{
+  ecma_regexp_ctx_t *re_ctx_p = nfa_p->re_ctx_p;
+
+  while (nfa_p->marks_p[pc] != nfa_p->generation)
+  {
+    nfa_p->marks_p[pc] = nfa_p->generation;
+    const re_nfa_inst_t *inst_p = re_ctx_p->nfa_program_p + pc;
+
+    switch (inst_p->type)
+    {
+      case RE_NFA_JUMP:
+      {
+        pc = inst_p->value;
+        continue;
+      }
+      case RE_NFA_SPLIT_NEXT:
+      {
+        ecma_regexp_nfa_add_thread (nfa_p, list_p, pc + 1, slots_p, str_curr_p);
+        pc = inst_p->value;
+        continue;
+      }
+      case RE_NFA_SPLIT_JUMP:
+      {
+        ecma_regexp_nfa_add_thread (nfa_p, list_p, inst_p->value, slots_p, str_curr_p);
+        pc++;
+        continue;
+      }
+      case RE_NFA_ASSERT:
+      {
+        if (!ecma_regexp_check_assertion (re_ctx_p, (re_opcode_t) inst_p->value, str_curr_p))
+        {
+          return;
+        }
+
+        pc++;
+        continue;
+      }
+      case RE_NFA_SAVE_START:
+      case RE_NFA_SAVE_END:
+      {
+        const uint32_t slot = 2u * inst_p->value + (inst_p->type == RE_NFA_SAVE_END ? 1u : 0u);
+        const uint32_t saved_offset = slots_p[slot];
+
+        slots_p[slot] = (uint32_t) (str_curr_p - re_ctx_p->input_start_p);
+        ecma_regexp_nfa_add_thread (nfa_p, list_p, pc + 1, slots_p, str_curr_p);
+        slots_p[slot] = saved_offset;
+        return;
+      }
+      case RE_NFA_CLEAR:
+      {
+        uint32_t *const clear_p = slots_p + 2u * inst_p->value;
+        const size_t clear_size = 2u * inst_p->count * sizeof (uint32_t);
+
+        JERRY_VLA (uint32_t, saved_slots_p, 2u * inst_p->count);
+        memcpy (saved_slots_p, clear_p, clear_size);
+        memset (clear_p, 0xff, clear_size);
+
+        ecma_regexp_nfa_add_thread (nfa_p, list_p, pc + 1, slots_p, str_curr_p);
+        memcpy (clear_p, saved_slots_p, clear_size);
+        return;
+      }
+      default:
+      {
+        JERRY_ASSERT (inst_p->type == RE_NFA_CHAR || inst_p->type == RE_NFA_MATCH);
+
+        list_p->pc_p[list_p->count] = (uint16_t) pc;
+        memcpy (list_p->slots_p + list_p->count * nfa_p->slot_count, slots_p, nfa_p->slot_count * sizeof (uint32_t));
+        list_p->count++;
+        return;
+      }
+    }
+  }
+} /* ecma_regexp_nfa_add_thread */
+
+/**
+ * Match a RegExp by simulating its NFA program, which takes linear time in the length of the input string.
+ *
+ * Note:
+ *      The threads are kept in the order in which the backtracking matcher would try them,
+ *      so the result is the same as the result of ecma_regexp_run.
+ *
+ * @return pointer to the end of the matched sub-string
+ *         NULL, if pattern did not match
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_nfa_run (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
+                     const lit_utf8_byte_t *str_curr_p, /**< input string pointer */
+                     bool search) /**< true - find the first position where the pattern matches
+                                   *   false - match only at the given position */
+{
+  JERRY_ASSERT (re_ctx_p->nfa_program_p != NULL);
+
+  const uint32_t length = re_ctx_p->nfa_length;
+  const uint32_t slot_count = 2u * re_ctx_p->captures_count;
+  const size_t slots_size = slot_count * sizeof (uint32_t);
+  const size_t block_size = (length + 2u * length * slot_count + 2u * slot_count) * sizeof (uint32_t)
+                             + 2u * length * sizeof (uint16_t);
+  uint32_t *block_p = jmem_heap_alloc_block (block_size);
+
+  ecma_regexp_nfa_t nfa;
+  nfa.re_ctx_p = re_ctx_p;
+  nfa.marks_p = block_p;
+  nfa.generation = 1;
+  nfa.slot_count = slot_count;
+  memset (nfa.marks_p, 0, length * sizeof (uint32_t));
+
+  ecma_regexp_nfa_list_t lists[2];
+  lists[0].slots_p = nfa.marks_p + length;
+  lists[1].slots_p = lists[0].slots_p + length * slot_count;
+  uint32_t *match_slots_p = lists[1].slots_p + length * slot_count;
+  uint32_t *start_slots_p = match_slots_p + slot_count;
+  lists[0].pc_p = (uint16_t *) (start_slots_p + slot_count);
+  lists[1].pc_p = lists[0].pc_p + length;
+  lists[0].count = 0;
+
+  ecma_regexp_nfa_list_t *curr_list_p = lists + 0;
+  ecma_regexp_nfa_list_t *next_list_p = lists + 1;
+  const lit_utf8_byte_t *match_end_p = NULL;
+  bool add_start = true;
+
+  while (true)
+  {
+    if (add_start && match_end_p == NULL)
+    {
+      /* The new thread has the lowest priority, since it starts at a later position. */
+      memset (start_slots_p, 0xff, slots_size);
+      start_slots_p[0] = (uint32_t) (str_curr_p - re_ctx_p->input_start_p);
+      ecma_regexp_nfa_add_thread (&nfa, curr_list_p, 0, start_slots_p, str_curr_p);
+    }
+
+    add_start = search;
+
+    const lit_utf8_byte_t *next_p = str_curr_p;
+
+    if (str_curr_p < re_ctx_p->input_end_p)
+    {
+#if ENABLED (JERRY_ESNEXT)
+      if (re_ctx_p->flags & RE_FLAG_UNICODE)
+      {
+        ecma_regexp_unicode_advance (&next_p, re_ctx_p->input_end_p);
+      }
+      else
+      {
+        lit_utf8_incr (&next_p);
+      }
+#else /* !ENABLED (JERRY_ESNEXT) */
+      lit_utf8_incr (&next_p);
+#endif /* ENABLED (JERRY_ESNEXT) */
+    }
+
+    nfa.generation++;
+    next_list_p->count = 0;
+
+    for (uint32_t i = 0; i < curr_list_p->count; i++)
+    {
+      const uint32_t pc = curr_list_p->pc_p[i];
+      const re_nfa_inst_t *inst_p = re_ctx_p->nfa_program_p + pc;
+      uint32_t *const thread_slots_p = curr_list_p->slots_p + i * slot_count;
+
+      if (inst_p->type == RE_NFA_MATCH)
+      {
+        /* Lower priority threads are dropped, since their matches would not be selected. */
+        memcpy (match_slots_p, thread_slots_p, slots_size);
+        match_end_p = str_curr_p;
+        break;
+      }
+
+      JERRY_ASSERT (inst_p->type == RE_NFA_CHAR);
+
+      const uint8_t *bc_p = re_ctx_p->bc_start_p + inst_p->value;
+      const re_opcode_t op = re_get_opcode (&bc_p);
+
+      if (ecma_regexp_match_char (re_ctx_p, op, &bc_p, str_curr_p) != NULL)
+      {
+        ecma_regexp_nfa_add_thread (&nfa, next_list_p, pc + 1, thread_slots_p, next_p);
+      }
+    }
+
+    if (str_curr_p >= re_ctx_p->input_end_p
+        || (next_list_p->count == 0 && (match_end_p != NULL || !search)))
+    {
+      break;
+    }
+
+    ecma_regexp_nfa_list_t *list_p = curr_list_p;
+    curr_list_p = next_list_p;
+    next_list_p = list_p;
+    str_curr_p = next_p;
+  }
+
+  if (match_end_p != NULL)
+  {
+    for (uint32_t i = 0; i < re_ctx_p->captures_count; i++)
+    {
+      const uint32_t begin = match_slots_p[2u * i];
+      const uint32_t end = match_slots_p[2u * i + 1];
+
+      re_ctx_p->captures_p[i].begin_p = (begin != RE_NFA_UNDEFINED) ? re_ctx_p->input_start_p + begin : NULL;
+      re_ctx_p->captures_p[i].end_p = (end != RE_NFA_UNDEFINED) ? re_ctx_p->input_start_p + end : NULL;
+    }
+
+    re_ctx_p->captures_p[RE_GLOBAL_CAPTURE].end_p = match_end_p;
+  }
+
+  jmem_heap_free_block (block_p, block_size);
+  return match_end_p;
+} /* ecma_regexp_nfa_run */
+
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
+/**
+ * Find the first position of the input string where the RegExp may match, using the prefilter of the pattern.
+ *
+ * Note:
+ *      The pattern cannot match the empty string, so it cannot match at the end of the input.
+ *
+ * @return pointer to the first position where the pattern may match
+ *         NULL, if the pattern cannot match at any of the remaining positions
+ */
+static const lit_utf8_byte_t *
+ecma_regexp_find_candidate (const re_compiled_code_t *bc_p, /**< RegExp bytecode */
+                            const lit_utf8_byte_t *str_curr_p, /**< input string pointer */
+                            const lit_utf8_byte_t *str_end_p) /**< end of input string */
+{
+  JERRY_ASSERT (bc_p->prefilter_offset != 0);
+
+  const uint8_t *prefilter_p = (const uint8_t *) bc_p + bc_p->prefilter_offset;
+  const lit_utf8_size_t size = (lit_utf8_size_t) (str_end_p - str_curr_p);
+
+  if (bc_p->prefix_size == 1)
+  {
+    return (const lit_utf8_byte_t *) memchr (str_curr_p, prefilter_p[0], size);
+  }
+
+  if (bc_p->prefix_size > 1)
+  {
+    return lit_utf8_string_find (str_curr_p, size, prefilter_p, bc_p->prefix_size);
+  }
+
+  while (str_curr_p < str_end_p)
+  {
+    if (prefilter_p[*str_curr_p >> 3] & (1u << (*str_curr_p & 0x7)))
+    {
+      return str_curr_p;
+    }
+
+    str_curr_p++;
+  }
+
+  return NULL;
+} /* ecma_regexp_find_candidate */
+
 /**
  * Match a RegExp at a specific position in the input string.
  *
@@ -1609,7 +2014,25 @@ ecma_regexp_match (ecma_regexp_ctx_t *re_ctx_p, /**< RegExp matcher context */
     re_ctx_p->captures_p[i].begin_p = NULL;
   }
 
+#if ENABLED (JERRY_REGEXP_NFA)
+  if (JERRY_UNLIKELY (re_ctx_p->steps_left == 0) && re_ctx_p->nfa_program_p != NULL)
+  {
+    return ecma_regexp_nfa_run (re_ctx_p, str_curr_p, false);
+  }
+
+  const lit_utf8_byte_t *matched_p = ecma_regexp_run (re_ctx_p, bc_p, str_curr_p);
+
+  /* The result is discarded if the step budget has been exhausted during the match,
+   * since some alternatives may have been skipped. */
+  if (JERRY_UNLIKELY (re_ctx_p->steps_left == 0) && re_ctx_p->nfa_program_p != NULL)
+  {
+    return ecma_regexp_nfa_run (re_ctx_p, str_curr_p, false);
+  }
+
+  return matched_p;
+#else /* !ENABLED (JERRY_REGEXP_NFA) */
   return ecma_regexp_run (re_ctx_p, bc_p, str_curr_p);
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
 } /* ecma_regexp_match */
 
 /*
@@ -1693,6 +2116,25 @@ ecma_regexp_initialize_context (ecma_regexp_ctx_t *ctx_p, /**< regexp context */
 
   ctx_p->captures_p = jmem_heap_alloc_block (ctx_p->captures_count * sizeof (ecma_regexp_capture_t));
 
+#if ENABLED (JERRY_REGEXP_NFA)
+  ctx_p->bc_start_p = (const uint8_t *) (bc_p + 1);
+  ctx_p->nfa_program_p = NULL;
+  ctx_p->nfa_length = bc_p->nfa_length;
+  ctx_p->steps_left = UINT32_MAX;
+
+  if (bc_p->nfa_length > 0)
+  {
+    const lit_utf8_size_t input_size = (lit_utf8_size_t) (input_end_p - input_start_p);
+
+    ctx_p->nfa_program_p = (const re_nfa_inst_t *) ((const uint8_t *) bc_p + bc_p->nfa_offset);
+
+    if (input_size < (UINT32_MAX - RE_NFA_STEP_BASE) / RE_NFA_STEPS_PER_BYTE)
+    {
+      ctx_p->steps_left = RE_NFA_STEP_BASE + input_size * RE_NFA_STEPS_PER_BYTE;
+    }
+  }
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
   if (ctx_p->non_captures_count > 0)
   {
     ctx_p->non_captures_p = jmem_heap_alloc_block (ctx_p->non_captures_count * sizeof (ecma_regexp_non_capture_t));
@@ -1828,6 +2270,50 @@ ecma_regexp_exec_helper (ecma_object_t *regexp_object_p, /**< RegExp object */
   JERRY_ASSERT (index <= input_length);
   while (true)
   {
+    if (bc_p->prefilter_offset != 0 && !(re_ctx.flags & RE_FLAG_STICKY))
+    {
+      const lit_utf8_byte_t *candidate_p = ecma_regexp_find_candidate (bc_p, input_curr_p, input_end_p);
+
+      if (candidate_p == NULL)
+      {
+        if (re_ctx.flags & RE_FLAG_GLOBAL)
+        {
+          goto fail_put_lastindex;
+        }
+
+        goto match_failed;
+      }
+
+      const lit_utf8_size_t skipped_size = (lit_utf8_size_t) (candidate_p - input_curr_p);
+      index += (input_flags & ECMA_STRING_FLAG_IS_ASCII) ? skipped_size : lit_utf8_string_length (input_curr_p,
+                                                                                                   skipped_size);
+      input_curr_p = candidate_p;
+    }
+
+#if ENABLED (JERRY_REGEXP_NFA)
+    if (JERRY_UNLIKELY (re_ctx.steps_left == 0)
+        && re_ctx.nfa_program_p != NULL
+        && !(re_ctx.flags & RE_FLAG_STICKY))
+    {
+      /* Find the remaining positions in a single pass. */
+      matched_p = ecma_regexp_nfa_run (&re_ctx, input_curr_p, true);
+
+      if (matched_p == NULL)
+      {
+        if (re_ctx.flags & RE_FLAG_GLOBAL)
+        {
+          goto fail_put_lastindex;
+        }
+
+        goto match_failed;
+      }
+
+      const lit_utf8_byte_t *match_begin_p = re_ctx.captures_p[RE_GLOBAL_CAPTURE].begin_p;
+      index += lit_utf8_string_length (input_curr_p, (lit_utf8_size_t) (match_begin_p - input_curr_p));
+      goto match_found;
+    }
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
     matched_p = ecma_regexp_match (&re_ctx, bc_start_p, input_curr_p);
 
     if (matched_p != NULL)
@@ -2259,9 +2745,82 @@ ecma_regexp_split_helper (ecma_value_t this_arg, /**< this value */
 
   ecma_string_t *const lastindex_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LASTINDEX_UL);
 
+  /* When the splitter uses the built-in exec, the positions where it cannot match are skipped by the prefilter. */
+  const re_compiled_code_t *prefilter_bc_p = NULL;
+  const lit_utf8_byte_t *scan_p = NULL;
+  const lit_utf8_byte_t *string_end_p = NULL;
+  ecma_length_t scan_index = 0;
+  uint8_t string_flags = ECMA_STRING_FLAG_IS_ASCII;
+
+  if (ecma_object_class_is (splitter_obj_p, LIT_MAGIC_STRING_REGEXP_UL))
+  {
+    result = ecma_op_object_get_by_magic_id (splitter_obj_p, LIT_MAGIC_STRING_EXEC);
+
+    if (ECMA_IS_VALUE_ERROR (result))
+    {
+      goto cleanup_array;
+    }
+
+    if (ecma_op_is_callable (result)
+        && ecma_builtin_is_regexp_exec ((ecma_extended_object_t *) ecma_get_object_from_value (result)))
+    {
+      ecma_extended_object_t *const splitter_ext_p = (ecma_extended_object_t *) splitter_obj_p;
+      prefilter_bc_p = ECMA_GET_INTERNAL_VALUE_ANY_POINTER (re_compiled_code_t,
+                                                            splitter_ext_p->u.class_prop.u.value);
+    }
+
+    ecma_free_value (result);
+  }
+
+  if (prefilter_bc_p != NULL && prefilter_bc_p->prefilter_offset != 0)
+  {
+    lit_utf8_size_t string_size;
+    scan_p = ecma_string_get_chars (string_p, &string_size, NULL, NULL, &string_flags);
+    string_end_p = scan_p + string_size;
+
+    /* Only short numeric strings are stored in temporary buffers, these are not prefiltered. */
+    if (string_flags & ECMA_STRING_FLAG_MUST_BE_FREED)
+    {
+      jmem_heap_free_block ((void *) scan_p, string_size);
+      prefilter_bc_p = NULL;
+    }
+  }
+  else
+  {
+    prefilter_bc_p = NULL;
+  }
+
   /* 24. */
   while (current_index < string_length)
   {
+    if (prefilter_bc_p != NULL)
+    {
+      if (string_flags & ECMA_STRING_FLAG_IS_ASCII)
+      {
+        scan_p += current_index - scan_index;
+      }
+      else
+      {
+        for (ecma_length_t i = scan_index; i < current_index; i++)
+        {
+          lit_utf8_incr (&scan_p);
+        }
+      }
+
+      const lit_utf8_byte_t *candidate_p = ecma_regexp_find_candidate (prefilter_bc_p, scan_p, string_end_p);
+
+      if (candidate_p == NULL)
+      {
+        break;
+      }
+
+      const lit_utf8_size_t skipped_size = (lit_utf8_size_t) (candidate_p - scan_p);
+      current_index += (string_flags & ECMA_STRING_FLAG_IS_ASCII) ? skipped_size : lit_utf8_string_length (scan_p,
+                                                                                                            skipped_size);
+      scan_p = candidate_p;
+      scan_index = current_index;
+    }
+
     /* 24.a-b. */
     result = ecma_op_object_put (splitter_obj_p,
                                  lastindex_str_p,
@@ -2502,6 +3061,16 @@ cleanup_string:
   /* 13. */
   while (current_str_p < string_end_p)
   {
+    if (bc_p->prefilter_offset != 0)
+    {
+      current_str_p = ecma_regexp_find_candidate (bc_p, current_str_p, string_end_p);
+
+      if (current_str_p == NULL)
+      {
+        break;
+      }
+    }
+
     /* 13.a. */
     const lit_utf8_byte_t *const matched_p = ecma_regexp_match (&re_ctx, bc_start_p, current_str_p);
 
@@ -2695,6 +3264,21 @@ ecma_regexp_replace_helper_fast (ecma_replace_context_t *ctx_p, /**<replace cont
 
   while (true)
   {
+    if (bc_p->prefilter_offset != 0 && !(re_ctx.flags & RE_FLAG_STICKY))
+    {
+      const lit_utf8_byte_t *candidate_p = ecma_regexp_find_candidate (bc_p, current_p, re_ctx.input_end_p);
+
+      if (candidate_p == NULL)
+      {
+        break;
+      }
+
+      const lit_utf8_size_t skipped_size = (lit_utf8_size_t) (candidate_p - current_p);
+      index += (string_flags & ECMA_STRING_FLAG_IS_ASCII) ? skipped_size : lit_utf8_string_length (current_p,
+                                                                                                    skipped_size);
+      current_p = candidate_p;
+    }
+
     matched_p = ecma_regexp_match (&re_ctx, bc_start_p, current_p);
 
     if (matched_p != NULL)
@@ -149,6 +149,12 @@ typedef struct
   ecma_regexp_non_capture_t *non_captures_p;   /**< non-capturing groups */
   uint16_t flags;                              /**< RegExp flags */
   uint8_t char_size;                           /**< size of encoded characters */
+#if ENABLED (JERRY_REGEXP_NFA)
+  const uint8_t *bc_start_p;                   /**< start of the RegExp bytecode */
+  const re_nfa_inst_t *nfa_program_p;          /**< NFA program, NULL if the pattern has none */
+  uint32_t nfa_length;                         /**< number of NFA instructions */
+  uint32_t steps_left;                         /**< number of backtracking steps before the NFA matcher is used */
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
 } ecma_regexp_ctx_t;
 
 #if ENABLED (JERRY_ESNEXT)
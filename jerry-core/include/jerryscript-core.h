@@ -213,6 +213,35 @@ typedef struct
   size_t reserved[4]; /**< padding for future extensions */
 } jerry_heap_stats_t;
 
+/**
+ * Description of JerryScript property lookup cache stats.
+ * It is for tuning the size of the cache.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t rows; /**< number of rows in the cache */
+  size_t row_length; /**< number of entries in a row of the cache */
+  size_t hit_count; /**< number of successful lookups */
+  size_t miss_count; /**< number of failed lookups */
+  size_t eviction_count; /**< number of cached entries replaced by newer ones */
+  size_t reserved[2]; /**< padding for future extensions */
+} jerry_lcache_stats_t;
+
+/**
+ * Description of JerryScript RegExp cache stats.
+ * It is for tuning the size of the cache.
+ */
+typedef struct
+{
+  size_t version; /**< the version of the stats struct */
+  size_t size; /**< number of entries in the cache */
+  size_t hit_count; /**< number of patterns found in the cache */
+  size_t miss_count; /**< number of patterns compiled */
+  size_t eviction_count; /**< number of cached patterns replaced by newer ones */
+  size_t reserved[3]; /**< padding for future extensions */
+} jerry_regexp_cache_stats_t;
+
 /**
  * Type of an external function handler.
  */
@@ -321,6 +350,11 @@ typedef struct
  */
 typedef struct jerry_context_t jerry_context_t;
 
+/**
+ * An opaque declaration of the incremental JSON parser structure.
+ */
+typedef struct jerry_json_parser_t jerry_json_parser_t;
+
 /**
  * Enum that contains the supported binary operation types
  */
@@ -349,9 +383,12 @@ void jerry_register_magic_strings (const jerry_char_t * const *ex_str_items_p,
                                    uint32_t count,
                                    const jerry_length_t *str_lengths_p);
 void jerry_gc (jerry_gc_mode_t mode);
+bool jerry_gc_step (uint32_t budget_us);
 void *jerry_get_context_data (const jerry_context_data_manager_t *manager_p);
 
 bool jerry_get_memory_stats (jerry_heap_stats_t *out_stats_p);
+bool jerry_get_lcache_stats (jerry_lcache_stats_t *out_stats_p);
+bool jerry_get_regexp_cache_stats (jerry_regexp_cache_stats_t *out_stats_p);
 
 /**
  * Parser and executor functions.
@@ -714,6 +751,11 @@ jerry_value_t jerry_get_typedarray_buffer (jerry_value_t value,
                                            jerry_length_t *byte_length);
 jerry_value_t jerry_json_parse (const jerry_char_t *string_p, jerry_size_t string_size);
 jerry_value_t jerry_json_stringify (const jerry_value_t object_to_stringify);
+jerry_json_parser_t *jerry_json_parser_create (void);
+jerry_value_t jerry_json_parser_feed (jerry_json_parser_t *parser_p,
+                                      const jerry_char_t *chunk_p,
+                                      jerry_size_t chunk_size);
+jerry_value_t jerry_json_parser_finish (jerry_json_parser_t *parser_p);
 jerry_value_t jerry_create_container (jerry_container_type_t container_type,
                                       const jerry_value_t *arguments_list_p,
                                       jerry_length_t arguments_list_len);
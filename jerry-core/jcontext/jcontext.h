@@ -75,6 +75,17 @@
  */
 #define CONFIG_ECMA_GC_NEW_OBJECTS_FRACTION (16)
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+/**
+ * Amount of objects promoted to the old generation since the last full GC run, represented as a fraction
+ * of all allocated objects, which when reached will make the next garbage collection a full collection.
+ *
+ * The fraction is calculated as:
+ *                1.0 / CONFIG_ECMA_GC_PROMOTED_OBJECTS_FRACTION
+ */
+#define CONFIG_ECMA_GC_PROMOTED_OBJECTS_FRACTION (4)
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
 /**
  * Heap structure
@@ -126,11 +137,14 @@ struct jerry_context_t
 
   /* Update JERRY_CONTEXT_FIRST_MEMBER if the first non-external member changes */
   jmem_cpointer_t ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT]; /**< pointer to instances of built-in objects */
-#if ENABLED (JERRY_BUILTIN_REGEXP)
-  re_compiled_code_t *re_cache[RE_CACHE_SIZE]; /**< regex cache */
-#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
   jmem_cpointer_t ecma_gc_objects_cp; /**< List of currently alive objects. */
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+  uint32_t jmem_heap_fl_bitmap; /**< bitmap of first level classes with non-empty bins */
+  uint8_t jmem_heap_sl_bitmap[JMEM_HEAP_FL_COUNT]; /**< bitmaps of non-empty second level bins */
+  uint32_t jmem_heap_bins[JMEM_HEAP_FL_COUNT][JMEM_HEAP_SL_COUNT]; /**< heads of the free block bins */
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
   jmem_heap_free_t *jmem_heap_list_skip_p; /**< This is used to speed up deallocation. */
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
   jmem_pools_chunk_t *jmem_free_8_byte_chunk_p; /**< list of free eight byte pool chunks */
 #if ENABLED (JERRY_CPOINTER_32_BIT)
   jmem_pools_chunk_t *jmem_free_16_byte_chunk_p; /**< list of free sixteen byte pool chunks */
@@ -145,6 +159,7 @@ struct jerry_context_t
 #if ENABLED (JERRY_BUILTIN_BIGINT)
   jmem_cpointer_t bigint_list_first_cp; /**< first item of the literal bigint list */
 #endif /* ENABLED (JERRY_BUILTIN_BIGINT) */
+  ecma_lit_hash_table_t *lit_hash_table_p[ECMA_LIT_STORAGE__COUNT]; /**< hash tables of the literal lists */
   jmem_cpointer_t ecma_global_env_cp; /**< global lexical environment */
 #if ENABLED (JERRY_ESNEXT)
   jmem_cpointer_t ecma_global_scope_cp; /**< global lexical scope */
@@ -169,6 +184,29 @@ struct jerry_context_t
 #if (JERRY_GC_MARK_LIMIT != 0)
   uint32_t ecma_gc_mark_recursion_limit; /**< GC mark recursion limit */
 #endif /* (JERRY_GC_MARK_LIMIT != 0) */
+  ecma_gc_mark_stack_chunk_t *ecma_gc_mark_stack_p; /**< top chunk of the GC mark stack */
+  uint32_t ecma_gc_mark_stack_index; /**< number of objects in the top chunk of the GC mark stack */
+#if ENABLED (JERRY_INCREMENTAL_GC)
+  uint32_t *ecma_gc_mark_bitmap_p; /**< mark bits of the incremental collector (one bit per heap unit) */
+  jmem_cpointer_t *ecma_gc_worklist_p; /**< gray objects waiting to be scanned */
+  uint32_t ecma_gc_worklist_size; /**< number of objects in the worklist */
+  uint32_t ecma_gc_worklist_capacity; /**< maximum number of objects in the worklist */
+  jmem_cpointer_t ecma_gc_rescan_cp; /**< next object to rescan after a worklist overflow */
+  jmem_cpointer_t ecma_gc_sweep_cp; /**< objects which are not swept yet */
+  uint8_t ecma_gc_phase; /**< current phase of the incremental collector (ecma_gc_phase_t) */
+  bool ecma_gc_worklist_overflow; /**< some gray objects could not be pushed onto the worklist */
+#endif /* ENABLED (JERRY_INCREMENTAL_GC) */
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  uint32_t *ecma_gc_young_bitmap_p; /**< young (or remembered old) objects of the generational
+                                     *   collector (one bit per heap unit) */
+  jmem_cpointer_t *ecma_gc_remembered_p; /**< old objects which may reference young objects */
+  uint32_t ecma_gc_remembered_size; /**< number of objects in the remembered set */
+  uint32_t ecma_gc_remembered_capacity; /**< maximum number of objects in the remembered set */
+  size_t ecma_gc_promoted_objects; /**< number of objects promoted to the old generation since the last
+                                    *   full GC session */
+  jmem_cpointer_t ecma_gc_old_objects_cp; /**< first object of the old generation in the list of objects */
+  bool ecma_gc_remembered_overflow; /**< the remembered set is incomplete: the next session must be full */
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
 
 #if ENABLED (JERRY_PROPRETY_HASHMAP)
   uint8_t ecma_prop_hashmap_alloc_state; /**< property hashmap allocation state: 0-4,
@@ -176,7 +214,7 @@ struct jerry_context_t
 #endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
 
 #if ENABLED (JERRY_BUILTIN_REGEXP)
-  uint8_t re_cache_idx; /**< evicted item index when regex cache is full (round-robin) */
+  uint32_t re_cache_use_count; /**< use counter of the regex cache, which orders the entries by their last use */
 #endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
 
 #if ENABLED (JERRY_BUILTIN_PROMISE)
@@ -196,6 +234,13 @@ struct jerry_context_t
   uintptr_t stack_base;  /**< stack base marker */
 #endif /* (JERRY_STACK_LIMIT != 0) */
 
+#if (JERRY_VM_STACK_SEGMENT_SIZE != 0)
+  vm_stack_segment_t *vm_stack_segment_p; /**< current segment of the frame stack */
+  vm_stack_segment_t *vm_stack_free_segment_p; /**< unused segment kept for the next segment push */
+  uint8_t *vm_stack_top_p; /**< first free byte of the current segment */
+  uint8_t *vm_stack_end_p; /**< end of the current segment */
+#endif /* (JERRY_VM_STACK_SEGMENT_SIZE != 0) */
+
 #if ENABLED (JERRY_DEBUGGER)
   uint8_t debugger_send_buffer[JERRY_DEBUGGER_TRANSPORT_MAX_BUFFER_SIZE]; /**< buffer for sending messages */
   uint8_t debugger_receive_buffer[JERRY_DEBUGGER_TRANSPORT_MAX_BUFFER_SIZE]; /**< buffer for receiving messages */
@@ -215,14 +260,52 @@ struct jerry_context_t
 
 #if ENABLED (JERRY_MEM_STATS)
   jmem_heap_stats_t jmem_heap_stats; /**< heap's memory usage statistics */
+#if ENABLED (JERRY_LCACHE)
+  ecma_lcache_stats_t lcache_stats; /**< usage statistics of the property lookup cache */
+#endif /* ENABLED (JERRY_LCACHE) */
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  re_cache_stats_t re_cache_stats; /**< usage statistics of the regex cache */
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
 #endif /* ENABLED (JERRY_MEM_STATS) */
 
+#if ENABLED (JERRY_BUILTIN_REGEXP)
+  re_cache_entry_t re_cache[RE_CACHE_SIZE]; /**< regex cache */
+#endif /* ENABLED (JERRY_BUILTIN_REGEXP) */
+
   /* This must be at the end of the context for performance reasons */
 #if ENABLED (JERRY_LCACHE)
   /** hash table for caching the last access of properties */
   ecma_lcache_hash_entry_t lcache[ECMA_LCACHE_HASH_ROWS_COUNT][ECMA_LCACHE_HASH_ROW_LENGTH];
+  /** replacement state of the rows of the lookup cache */
+  ecma_lcache_row_state_t lcache_row_state[ECMA_LCACHE_HASH_ROWS_COUNT];
 #endif /* ENABLED (JERRY_LCACHE) */
 
+#if ENABLED (JERRY_INLINE_CACHE)
+  /** inline caches of the property access sites */
+  vm_inline_cache_entry_t vm_inline_cache[VM_INLINE_CACHE_SIZE];
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+  /** scope caches of the identifier access sites */
+  vm_scope_cache_entry_t vm_scope_cache[VM_SCOPE_CACHE_SIZE];
+  /** incremented when a declarative lexical environment is freed */
+  uint32_t vm_scope_cache_epoch;
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+#if ENABLED (JERRY_STRING_INDEX_CACHE)
+  /** byte offsets of the code units of recently indexed non-ASCII strings */
+  ecma_string_index_entry_t string_index_cache[ECMA_STRING_INDEX_CACHE_SIZE];
+#endif /* ENABLED (JERRY_STRING_INDEX_CACHE) */
+
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+  /** execution counts of the opcodes */
+  uint32_t vm_opcode_counts[VM_OPCODE_STATS_OPCODE_COUNT];
+  /** execution counts of the opcode pairs and triples */
+  vm_opcode_stats_entry_t vm_opcode_sequences[VM_OPCODE_STATS_TABLE_SIZE];
+  /** number of sequences which were not counted because the table was full */
+  uint32_t vm_opcode_sequences_dropped;
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
 #if ENABLED (JERRY_ESNEXT)
   /**
    * Allowed values and it's meaning:
@@ -53,6 +53,13 @@ bool jmem_is_heap_pointer (const void *pointer);
 void *jmem_heap_alloc_block_internal (const size_t size);
 void jmem_heap_free_block_internal (void *ptr, const size_t size);
 
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+void jmem_heap_segregated_init (void);
+void *jmem_heap_segregated_alloc (const size_t size);
+void jmem_heap_segregated_free (void *ptr, const size_t size);
+bool jmem_heap_segregated_extend (void *ptr, const size_t old_size, const size_t new_size);
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
+
 /**
  * \addtogroup poolman Memory pool manager
  * @{
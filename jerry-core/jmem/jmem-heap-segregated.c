@@ -0,0 +1,598 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Segregated free list heap implementation
+ */
+
+#include "jcontext.h"
+#include "jmem.h"
+#include "jrt-libc-includes.h"
+
+#define JMEM_ALLOCATOR_INTERNAL
+#include "jmem-allocator-internal.h"
+
+/** \addtogroup mem Memory allocation
+ * @{
+ *
+ * \addtogroup heap Heap
+ * @{
+ */
+
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+
+/**
+ * Layout of the free heap regions:
+ *
+ * Free regions are grouped into bins by their size (two level segregated fit): the
+ * first level class is the position of the most significant bit of the size (in
+ * JMEM_ALIGNMENT units), the second level divides each class into JMEM_HEAP_SL_COUNT
+ * equal ranges. Sizes below JMEM_HEAP_SL_COUNT units have their own bins. A bitmap for
+ * each level stores which bins are non-empty, so a suitable bin is found in constant time.
+ *
+ * Each bin is a doubly linked list, so any region can be removed from it in constant
+ * time. Since allocated blocks have no header, a bitmap with one bit for each
+ * JMEM_ALIGNMENT sized unit is kept at the end of the heap area. The bits of the
+ * first and last unit of every free region are set, which allows the free neighbours
+ * of a released block to be found without walking any list.
+ *
+ * Regions larger than JMEM_ALIGNMENT store their size both after the next offset and
+ * in their last four bytes. Regions of JMEM_ALIGNMENT size have no room for the size,
+ * they store the previous offset tagged with JMEM_HEAP_SEGREGATED_UNIT_FLAG instead.
+ * Sizes are always multiples of JMEM_ALIGNMENT, so the lowest bit tells the two apart.
+ */
+
+/**
+ * Free region header
+ */
+typedef struct
+{
+  uint32_t next_offset; /**< offset of the next region in the same bin */
+  uint32_t size_or_prev; /**< size of the region, or the tagged offset of the
+                          *   previous region for JMEM_ALIGNMENT sized regions */
+  uint32_t prev_offset; /**< offset of the previous region in the same bin
+                         *   (only present in regions larger than JMEM_ALIGNMENT) */
+} jmem_heap_segregated_free_t;
+
+/**
+ * Flag of JMEM_ALIGNMENT sized free regions.
+ */
+#define JMEM_HEAP_SEGREGATED_UNIT_FLAG 0x1
+
+/**
+ * End of list marker.
+ *
+ * Note:
+ *      the marker is aligned, so it can be tagged with JMEM_HEAP_SEGREGATED_UNIT_FLAG
+ */
+#define JMEM_HEAP_SEGREGATED_END_OF_LIST ((uint32_t) (0xffffffff & ~(JMEM_ALIGNMENT - 1)))
+
+/**
+ * Size of the free region bitmap
+ */
+#define JMEM_HEAP_SEGREGATED_MAP_SIZE \
+  JERRY_ALIGNUP ((JMEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG) / 8 + 1, JMEM_ALIGNMENT)
+
+/**
+ * Size of the heap area managed by the bins
+ */
+#define JMEM_HEAP_SEGREGATED_AREA_SIZE (JMEM_HEAP_AREA_SIZE - JMEM_HEAP_SEGREGATED_MAP_SIZE)
+
+/**
+ * Free region bitmap
+ */
+#define JMEM_HEAP_SEGREGATED_MAP ((uint32_t *) (JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_SEGREGATED_AREA_SIZE))
+
+/**
+ * Get the free region header at a given offset
+ */
+#define JMEM_HEAP_SEGREGATED_GET_REGION(offset) \
+  ((jmem_heap_segregated_free_t *) (JERRY_HEAP_CONTEXT (area) + (offset)))
+
+/**
+ * Get the index of the most significant set bit.
+ *
+ * @return bit index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE JERRY_ATTR_CONST
+jmem_heap_segregated_msb (uint32_t value) /**< non-zero value */
+{
+  JERRY_ASSERT (value != 0);
+
+#if defined (__GNUC__) || defined (__clang__)
+  return (uint32_t) (31 - __builtin_clz (value));
+#else /* !__GNUC__ && !__clang__ */
+  uint32_t result = 0;
+
+  while (value >>= 1)
+  {
+    result++;
+  }
+
+  return result;
+#endif /* __GNUC__ || __clang__ */
+} /* jmem_heap_segregated_msb */
+
+/**
+ * Get the index of the least significant set bit.
+ *
+ * @return bit index
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE JERRY_ATTR_CONST
+jmem_heap_segregated_lsb (uint32_t value) /**< non-zero value */
+{
+  JERRY_ASSERT (value != 0);
+
+#if defined (__GNUC__) || defined (__clang__)
+  return (uint32_t) __builtin_ctz (value);
+#else /* !__GNUC__ && !__clang__ */
+  uint32_t result = 0;
+
+  while ((value & 0x1) == 0)
+  {
+    value >>= 1;
+    result++;
+  }
+
+  return result;
+#endif /* __GNUC__ || __clang__ */
+} /* jmem_heap_segregated_lsb */
+
+/**
+ * Compute the first and second level index of the bin which holds the regions of the given size.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_segregated_get_bin (uint32_t units, /**< size of the region in JMEM_ALIGNMENT units */
+                              uint32_t *fl_p, /**< [out] first level index */
+                              uint32_t *sl_p) /**< [out] second level index */
+{
+  if (units < JMEM_HEAP_SL_COUNT)
+  {
+    *fl_p = 0;
+    *sl_p = units;
+    return;
+  }
+
+  uint32_t msb = jmem_heap_segregated_msb (units);
+
+  *fl_p = msb - JMEM_HEAP_SL_COUNT_LOG + 1;
+  *sl_p = (units >> (msb - JMEM_HEAP_SL_COUNT_LOG)) - JMEM_HEAP_SL_COUNT;
+} /* jmem_heap_segregated_get_bin */
+
+/**
+ * Check whether the free bit of a heap unit is set.
+ *
+ * @return true - if the unit is the first or last unit of a free region
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_segregated_is_free_unit (uint32_t offset) /**< offset of the unit */
+{
+  uint32_t unit = offset >> JMEM_ALIGNMENT_LOG;
+  return (JMEM_HEAP_SEGREGATED_MAP[unit >> 5] & (1u << (unit & 0x1f))) != 0;
+} /* jmem_heap_segregated_is_free_unit */
+
+/**
+ * Set or clear the free bits of the first and last unit of a region.
+ */
+static inline void JERRY_ATTR_ALWAYS_INLINE
+jmem_heap_segregated_mark_region (uint32_t offset, /**< offset of the region */
+                                  uint32_t size, /**< size of the region */
+                                  bool is_free) /**< new state of the region */
+{
+  uint32_t *map_p = JMEM_HEAP_SEGREGATED_MAP;
+  uint32_t first_unit = offset >> JMEM_ALIGNMENT_LOG;
+  uint32_t last_unit = (offset + size - JMEM_ALIGNMENT) >> JMEM_ALIGNMENT_LOG;
+
+  if (is_free)
+  {
+    map_p[first_unit >> 5] |= 1u << (first_unit & 0x1f);
+    map_p[last_unit >> 5] |= 1u << (last_unit & 0x1f);
+  }
+  else
+  {
+    map_p[first_unit >> 5] &= ~(1u << (first_unit & 0x1f));
+    map_p[last_unit >> 5] &= ~(1u << (last_unit & 0x1f));
+  }
+} /* jmem_heap_segregated_mark_region */
+
+/**
+ * Get the size of a free region.
+ *
+ * @return size of the region
+ */
+static uint32_t
+jmem_heap_segregated_get_size (uint32_t offset) /**< offset of the free region */
+{
+  jmem_heap_segregated_free_t *region_p = JMEM_HEAP_SEGREGATED_GET_REGION (offset);
+
+  JMEM_VALGRIND_DEFINED_SPACE (&region_p->size_or_prev, sizeof (uint32_t));
+  uint32_t size_or_prev = region_p->size_or_prev;
+  JMEM_VALGRIND_NOACCESS_SPACE (&region_p->size_or_prev, sizeof (uint32_t));
+
+  return (size_or_prev & JMEM_HEAP_SEGREGATED_UNIT_FLAG) ? JMEM_ALIGNMENT : size_or_prev;
+} /* jmem_heap_segregated_get_size */
+
+/**
+ * Set the previous region offset of a free region.
+ */
+static void
+jmem_heap_segregated_set_prev (uint32_t offset, /**< offset of the free region */
+                               uint32_t prev_offset) /**< offset of the previous region */
+{
+  jmem_heap_segregated_free_t *region_p = JMEM_HEAP_SEGREGATED_GET_REGION (offset);
+
+  JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+  if (region_p->size_or_prev & JMEM_HEAP_SEGREGATED_UNIT_FLAG)
+  {
+    region_p->size_or_prev = prev_offset | JMEM_HEAP_SEGREGATED_UNIT_FLAG;
+  }
+  else
+  {
+    JMEM_VALGRIND_DEFINED_SPACE (&region_p->prev_offset, sizeof (uint32_t));
+    region_p->prev_offset = prev_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (&region_p->prev_offset, sizeof (uint32_t));
+  }
+
+  JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+} /* jmem_heap_segregated_set_prev */
+
+/**
+ * Set the next region offset of a free region.
+ */
+static void
+jmem_heap_segregated_set_next (uint32_t offset, /**< offset of the free region */
+                               uint32_t next_offset) /**< offset of the next region */
+{
+  jmem_heap_segregated_free_t *region_p = JMEM_HEAP_SEGREGATED_GET_REGION (offset);
+
+  JMEM_VALGRIND_DEFINED_SPACE (&region_p->next_offset, sizeof (uint32_t));
+  region_p->next_offset = next_offset;
+  JMEM_VALGRIND_NOACCESS_SPACE (&region_p->next_offset, sizeof (uint32_t));
+} /* jmem_heap_segregated_set_next */
+
+/**
+ * Insert a free region into its bin and mark it as free.
+ *
+ * Note:
+ *      the neighbours of the region must not be free
+ */
+static void
+jmem_heap_segregated_insert (uint32_t offset, /**< offset of the region */
+                             uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT (offset % JMEM_ALIGNMENT == 0 && size % JMEM_ALIGNMENT == 0 && size > 0);
+  JERRY_ASSERT (offset + size <= JMEM_HEAP_SEGREGATED_AREA_SIZE);
+
+  uint32_t fl, sl;
+  jmem_heap_segregated_get_bin (size >> JMEM_ALIGNMENT_LOG, &fl, &sl);
+
+  uint32_t *head_p = &JERRY_CONTEXT (jmem_heap_bins)[fl][sl];
+  const uint32_t next_offset = *head_p;
+  jmem_heap_segregated_free_t *region_p = JMEM_HEAP_SEGREGATED_GET_REGION (offset);
+
+  if (size == JMEM_ALIGNMENT)
+  {
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+    region_p->next_offset = next_offset;
+    region_p->size_or_prev = JMEM_HEAP_SEGREGATED_END_OF_LIST | JMEM_HEAP_SEGREGATED_UNIT_FLAG;
+    JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+  }
+  else
+  {
+    uint32_t *footer_p = (uint32_t *) ((uint8_t *) region_p + size) - 1;
+
+    JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_segregated_free_t));
+    JMEM_VALGRIND_DEFINED_SPACE (footer_p, sizeof (uint32_t));
+    region_p->next_offset = next_offset;
+    region_p->size_or_prev = size;
+    region_p->prev_offset = JMEM_HEAP_SEGREGATED_END_OF_LIST;
+    *footer_p = size;
+    JMEM_VALGRIND_NOACCESS_SPACE (footer_p, sizeof (uint32_t));
+    JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_segregated_free_t));
+  }
+
+  if (next_offset != JMEM_HEAP_SEGREGATED_END_OF_LIST)
+  {
+    jmem_heap_segregated_set_prev (next_offset, offset);
+  }
+
+  *head_p = offset;
+  JERRY_CONTEXT (jmem_heap_fl_bitmap) |= 1u << fl;
+  JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] = (uint8_t) (JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] | (1u << sl));
+
+  jmem_heap_segregated_mark_region (offset, size, true);
+} /* jmem_heap_segregated_insert */
+
+/**
+ * Remove a free region from its bin and mark it as used.
+ */
+static void
+jmem_heap_segregated_remove (uint32_t offset, /**< offset of the region */
+                             uint32_t size) /**< size of the region */
+{
+  JERRY_ASSERT (jmem_heap_segregated_is_free_unit (offset));
+  JERRY_ASSERT (jmem_heap_segregated_get_size (offset) == size);
+
+  jmem_heap_segregated_free_t *region_p = JMEM_HEAP_SEGREGATED_GET_REGION (offset);
+  uint32_t next_offset;
+  uint32_t prev_offset;
+
+  JMEM_VALGRIND_DEFINED_SPACE (region_p, sizeof (jmem_heap_free_t));
+  next_offset = region_p->next_offset;
+
+  if (size == JMEM_ALIGNMENT)
+  {
+    prev_offset = region_p->size_or_prev & ~(uint32_t) JMEM_HEAP_SEGREGATED_UNIT_FLAG;
+  }
+  else
+  {
+    JMEM_VALGRIND_DEFINED_SPACE (&region_p->prev_offset, sizeof (uint32_t));
+    prev_offset = region_p->prev_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (&region_p->prev_offset, sizeof (uint32_t));
+  }
+  JMEM_VALGRIND_NOACCESS_SPACE (region_p, sizeof (jmem_heap_free_t));
+
+  if (next_offset != JMEM_HEAP_SEGREGATED_END_OF_LIST)
+  {
+    jmem_heap_segregated_set_prev (next_offset, prev_offset);
+  }
+
+  if (prev_offset != JMEM_HEAP_SEGREGATED_END_OF_LIST)
+  {
+    jmem_heap_segregated_set_next (prev_offset, next_offset);
+  }
+  else
+  {
+    uint32_t fl, sl;
+    jmem_heap_segregated_get_bin (size >> JMEM_ALIGNMENT_LOG, &fl, &sl);
+
+    JERRY_ASSERT (JERRY_CONTEXT (jmem_heap_bins)[fl][sl] == offset);
+    JERRY_CONTEXT (jmem_heap_bins)[fl][sl] = next_offset;
+
+    if (next_offset == JMEM_HEAP_SEGREGATED_END_OF_LIST)
+    {
+      JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] = (uint8_t) (JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] & ~(1u << sl));
+
+      if (JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] == 0)
+      {
+        JERRY_CONTEXT (jmem_heap_fl_bitmap) &= ~(1u << fl);
+      }
+    }
+  }
+
+  jmem_heap_segregated_mark_region (offset, size, false);
+} /* jmem_heap_segregated_remove */
+
+/**
+ * Find a free region which is at least as large as the requested size.
+ *
+ * @return offset of the region - if found,
+ *         JMEM_HEAP_SEGREGATED_END_OF_LIST - otherwise
+ */
+static uint32_t
+jmem_heap_segregated_find (uint32_t size) /**< required size */
+{
+  uint32_t units = size >> JMEM_ALIGNMENT_LOG;
+  uint32_t fl, sl;
+
+  /* Round the request up to the next bin boundary, so any region of the selected bin is large enough. */
+  if (units >= JMEM_HEAP_SL_COUNT)
+  {
+    units += (1u << (jmem_heap_segregated_msb (units) - JMEM_HEAP_SL_COUNT_LOG)) - 1;
+  }
+
+  jmem_heap_segregated_get_bin (units, &fl, &sl);
+
+  if (JERRY_LIKELY (fl < JMEM_HEAP_FL_COUNT))
+  {
+    uint32_t sl_bitmap = JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] & (~0u << sl);
+
+    if (sl_bitmap == 0)
+    {
+      uint32_t fl_bitmap = (fl + 1 < 32) ? (JERRY_CONTEXT (jmem_heap_fl_bitmap) & (~0u << (fl + 1))) : 0;
+
+      if (fl_bitmap != 0)
+      {
+        fl = jmem_heap_segregated_lsb (fl_bitmap);
+        sl_bitmap = JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl];
+      }
+    }
+
+    if (sl_bitmap != 0)
+    {
+      return JERRY_CONTEXT (jmem_heap_bins)[fl][jmem_heap_segregated_lsb (sl_bitmap)];
+    }
+  }
+
+  /* No bin is guaranteed to fit, but the bin of the exact size may still contain a large enough region.
+   * This is only reached when the heap is nearly full, so a linear search is acceptable. */
+  jmem_heap_segregated_get_bin (size >> JMEM_ALIGNMENT_LOG, &fl, &sl);
+
+  uint32_t offset = JERRY_CONTEXT (jmem_heap_bins)[fl][sl];
+
+  while (offset != JMEM_HEAP_SEGREGATED_END_OF_LIST)
+  {
+    if (jmem_heap_segregated_get_size (offset) >= size)
+    {
+      break;
+    }
+
+    jmem_heap_segregated_free_t *region_p = JMEM_HEAP_SEGREGATED_GET_REGION (offset);
+
+    JMEM_VALGRIND_DEFINED_SPACE (&region_p->next_offset, sizeof (uint32_t));
+    offset = region_p->next_offset;
+    JMEM_VALGRIND_NOACCESS_SPACE (&region_p->next_offset, sizeof (uint32_t));
+  }
+
+  return offset;
+} /* jmem_heap_segregated_find */
+
+/**
+ * Initialize the bins with a single free region covering the whole heap area.
+ */
+void
+jmem_heap_segregated_init (void)
+{
+  JERRY_ASSERT ((JMEM_HEAP_AREA_SIZE >> JMEM_ALIGNMENT_LOG)
+                < (1u << (JMEM_HEAP_FL_COUNT + JMEM_HEAP_SL_COUNT_LOG - 1)));
+
+  for (uint32_t fl = 0; fl < JMEM_HEAP_FL_COUNT; fl++)
+  {
+    JERRY_CONTEXT (jmem_heap_sl_bitmap)[fl] = 0;
+
+    for (uint32_t sl = 0; sl < JMEM_HEAP_SL_COUNT; sl++)
+    {
+      JERRY_CONTEXT (jmem_heap_bins)[fl][sl] = JMEM_HEAP_SEGREGATED_END_OF_LIST;
+    }
+  }
+
+  JERRY_CONTEXT (jmem_heap_fl_bitmap) = 0;
+
+  memset (JMEM_HEAP_SEGREGATED_MAP, 0, JMEM_HEAP_SEGREGATED_MAP_SIZE);
+  JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_SEGREGATED_AREA_SIZE);
+
+  jmem_heap_segregated_insert (0, (uint32_t) JMEM_HEAP_SEGREGATED_AREA_SIZE);
+} /* jmem_heap_segregated_init */
+
+/**
+ * Allocate a region from the bins.
+ *
+ * @return pointer to the allocated region - if allocation is successful,
+ *         NULL - if there is no large enough free region
+ */
+void *
+jmem_heap_segregated_alloc (const size_t size) /**< aligned size of the region */
+{
+  JERRY_ASSERT (size % JMEM_ALIGNMENT == 0);
+
+  if (JERRY_UNLIKELY (size > JMEM_HEAP_SEGREGATED_AREA_SIZE))
+  {
+    return NULL;
+  }
+
+  const uint32_t offset = jmem_heap_segregated_find ((uint32_t) size);
+
+  if (JERRY_UNLIKELY (offset == JMEM_HEAP_SEGREGATED_END_OF_LIST))
+  {
+    return NULL;
+  }
+
+  const uint32_t region_size = jmem_heap_segregated_get_size (offset);
+  JERRY_ASSERT (region_size >= size);
+
+  jmem_heap_segregated_remove (offset, region_size);
+
+  if (region_size > size)
+  {
+    jmem_heap_segregated_insert (offset + (uint32_t) size, region_size - (uint32_t) size);
+  }
+
+  return JERRY_HEAP_CONTEXT (area) + offset;
+} /* jmem_heap_segregated_alloc */
+
+/**
+ * Return a region to the bins, merging it with its free neighbours.
+ */
+void
+jmem_heap_segregated_free (void *ptr, /**< pointer to the region */
+                           const size_t size) /**< aligned size of the region */
+{
+  JERRY_ASSERT (size % JMEM_ALIGNMENT == 0);
+  JERRY_ASSERT ((uint8_t *) ptr >= JERRY_HEAP_CONTEXT (area)
+                && (uint8_t *) ptr + size <= JERRY_HEAP_CONTEXT (area) + JMEM_HEAP_SEGREGATED_AREA_SIZE);
+
+  uint32_t offset = (uint32_t) ((uint8_t *) ptr - JERRY_HEAP_CONTEXT (area));
+  uint32_t region_size = (uint32_t) size;
+  const uint32_t end_offset = offset + region_size;
+
+  /* The unit before the region is the last unit of the preceding free region. */
+  if (offset > 0 && jmem_heap_segregated_is_free_unit (offset - JMEM_ALIGNMENT))
+  {
+    uint32_t *footer_p = (uint32_t *) ptr - 1;
+
+    JMEM_VALGRIND_DEFINED_SPACE (footer_p, sizeof (uint32_t));
+    uint32_t prev_size = *footer_p;
+    JMEM_VALGRIND_NOACCESS_SPACE (footer_p, sizeof (uint32_t));
+
+    if (prev_size & JMEM_HEAP_SEGREGATED_UNIT_FLAG)
+    {
+      prev_size = JMEM_ALIGNMENT;
+    }
+
+    offset -= prev_size;
+    region_size += prev_size;
+    jmem_heap_segregated_remove (offset, prev_size);
+  }
+
+  /* The unit after the region is the first unit of the following free region.
+   * The bits after the managed area are never set, so no bounds check is needed. */
+  if (jmem_heap_segregated_is_free_unit (end_offset))
+  {
+    uint32_t next_size = jmem_heap_segregated_get_size (end_offset);
+
+    region_size += next_size;
+    jmem_heap_segregated_remove (end_offset, next_size);
+  }
+
+  jmem_heap_segregated_insert (offset, region_size);
+} /* jmem_heap_segregated_free */
+
+/**
+ * Try to extend an allocated region in place, using the free region which follows it.
+ *
+ * @return true - if the region is extended,
+ *         false - otherwise
+ */
+bool
+jmem_heap_segregated_extend (void *ptr, /**< pointer to the region */
+                             const size_t old_size, /**< current aligned size of the region */
+                             const size_t new_size) /**< desired aligned size of the region */
+{
+  JERRY_ASSERT (old_size % JMEM_ALIGNMENT == 0 && new_size % JMEM_ALIGNMENT == 0);
+  JERRY_ASSERT (new_size > old_size);
+
+  const uint32_t end_offset = (uint32_t) ((uint8_t *) ptr + old_size - JERRY_HEAP_CONTEXT (area));
+
+  if (!jmem_heap_segregated_is_free_unit (end_offset))
+  {
+    return false;
+  }
+
+  const uint32_t next_size = jmem_heap_segregated_get_size (end_offset);
+  const uint32_t required_size = (uint32_t) (new_size - old_size);
+
+  if (next_size < required_size)
+  {
+    return false;
+  }
+
+  jmem_heap_segregated_remove (end_offset, next_size);
+
+  if (next_size > required_size)
+  {
+    jmem_heap_segregated_insert (end_offset + required_size, next_size - required_size);
+  }
+
+  return true;
+} /* jmem_heap_segregated_extend */
+
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
+
+/**
+ * @}
+ * @}
+ */
@@ -33,7 +33,7 @@
  * @{
  */
 
-#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR) && !ENABLED (JERRY_SEGREGATED_ALLOCATOR)
 /**
  * End of list marker.
  */
@@ -64,7 +64,7 @@ jmem_heap_get_region_end (jmem_heap_free_t *curr_p) /**< current region */
 {
   return (jmem_heap_free_t *) ((uint8_t *) curr_p + curr_p->size);
 } /* jmem_heap_get_region_end */
-#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) && !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
 /**
  * Startup initialization of heap
@@ -81,6 +81,10 @@ jmem_heap_init (void)
 
   JERRY_CONTEXT (jmem_heap_limit) = CONFIG_GC_LIMIT;
 
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+  JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+  jmem_heap_segregated_init ();
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
   jmem_heap_free_t *const region_p = (jmem_heap_free_t *) JERRY_HEAP_CONTEXT (area);
 
   region_p->size = JMEM_HEAP_AREA_SIZE;
@@ -93,6 +97,7 @@ jmem_heap_init (void)
 
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (JERRY_HEAP_CONTEXT (area), JMEM_HEAP_AREA_SIZE);
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
 #endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
   JMEM_HEAP_STAT_INIT ();
@@ -125,6 +130,20 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
 #if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
   /* Align size. */
   const size_t required_size = ((size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT) * JMEM_ALIGNMENT;
+
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+  void *data_space_p = jmem_heap_segregated_alloc (required_size);
+
+  if (JERRY_LIKELY (data_space_p != NULL))
+  {
+    JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
+
+    while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
+    {
+      JERRY_CONTEXT (jmem_heap_limit) += CONFIG_GC_LIMIT;
+    }
+  }
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
   jmem_heap_free_t *data_space_p = NULL;
 
   JMEM_VALGRIND_DEFINED_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
@@ -238,6 +257,7 @@ jmem_heap_alloc (const size_t size) /**< size of requested block */
   }
 
   JMEM_VALGRIND_NOACCESS_SPACE (&JERRY_HEAP_CONTEXT (first), sizeof (jmem_heap_free_t));
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
   JERRY_ASSERT ((uintptr_t) data_space_p % JMEM_ALIGNMENT == 0);
   JMEM_VALGRIND_MALLOCLIKE_SPACE (data_space_p, size);
@@ -352,7 +372,37 @@ jmem_heap_alloc_block_null_on_error (const size_t size) /**< required memory siz
   return block_p;
 } /* jmem_heap_alloc_block_null_on_error */
 
-#if !ENABLED (JERRY_SYSTEM_ALLOCATOR)
+/**
+ * Allocation of memory block without reclaiming unused memory.
+ *
+ * Note:
+ *      This function can be used while the garbage collector is running.
+ *
+ * @return NULL, if the required memory size is 0
+ *         also NULL, if there is not enough free memory
+ *         pointer to the allocated memory block, otherwise
+ */
+void *
+jmem_heap_alloc_block_no_gc (const size_t size) /**< required memory size */
+{
+  if (JERRY_UNLIKELY (size == 0))
+  {
+    return NULL;
+  }
+
+  void *block_p = jmem_heap_alloc (size);
+
+#if ENABLED (JERRY_MEM_STATS)
+  if (block_p != NULL)
+  {
+    JMEM_HEAP_STAT_ALLOC (size);
+  }
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+  return block_p;
+} /* jmem_heap_alloc_block_no_gc */
+
+#if !ENABLED (JERRY_SYSTEM_ALLOCATOR) && !ENABLED (JERRY_SEGREGATED_ALLOCATOR)
 /**
  * Finds the block in the free block list which preceeds the argument block
  *
@@ -446,7 +496,7 @@ jmem_heap_insert_block (jmem_heap_free_t *block_p, /**< block to insert */
   JMEM_VALGRIND_NOACCESS_SPACE (block_p, sizeof (jmem_heap_free_t));
   JMEM_VALGRIND_NOACCESS_SPACE (next_p, sizeof (jmem_heap_free_t));
 } /* jmem_heap_insert_block */
-#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) */
+#endif /* !ENABLED (JERRY_SYSTEM_ALLOCATOR) && !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
 /**
  * Internal method for freeing a memory block.
@@ -466,9 +516,14 @@ jmem_heap_free_block_internal (void *ptr, /**< pointer to beginning of data spac
 
   const size_t aligned_size = (size + JMEM_ALIGNMENT - 1) / JMEM_ALIGNMENT * JMEM_ALIGNMENT;
 
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+  JMEM_VALGRIND_NOACCESS_SPACE (ptr, aligned_size);
+  jmem_heap_segregated_free (ptr, aligned_size);
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
   jmem_heap_free_t *const block_p = (jmem_heap_free_t *) ptr;
   jmem_heap_free_t *const prev_p = jmem_heap_find_prev (block_p);
   jmem_heap_insert_block (block_p, prev_p, aligned_size);
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
   JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_size;
 
@@ -518,9 +573,13 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
     JMEM_VALGRIND_RESIZE_SPACE (block_p, old_size, new_size);
     JMEM_HEAP_STAT_FREE (old_size);
     JMEM_HEAP_STAT_ALLOC (new_size);
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+    jmem_heap_segregated_free ((uint8_t *) block_p + aligned_new_size, aligned_old_size - aligned_new_size);
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
     jmem_heap_insert_block ((jmem_heap_free_t *) ((uint8_t *) block_p + aligned_new_size),
                             jmem_heap_find_prev (block_p),
                             aligned_old_size - aligned_new_size);
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
     JERRY_CONTEXT (jmem_heap_allocated_size) -= (aligned_old_size - aligned_new_size);
     while (JERRY_CONTEXT (jmem_heap_allocated_size) + CONFIG_GC_LIMIT <= JERRY_CONTEXT (jmem_heap_limit))
@@ -543,6 +602,14 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
   ecma_gc_run ();
 #endif /* ENABLED (JERRY_MEM_GC_BEFORE_EACH_ALLOC) */
 
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+  /* Check if block can be extended at the end */
+  if (jmem_heap_segregated_extend (block_p, aligned_old_size, aligned_new_size))
+  {
+    JMEM_VALGRIND_RESIZE_SPACE (block_p, old_size, new_size);
+    ret_block_p = block_p;
+  }
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
   jmem_heap_free_t *prev_p = jmem_heap_find_prev (block_p);
   JMEM_VALGRIND_DEFINED_SPACE (prev_p, sizeof (jmem_heap_free_t));
   jmem_heap_free_t * const next_p = JMEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
@@ -619,11 +686,14 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
       JMEM_VALGRIND_NOACCESS_SPACE (prev_p, sizeof (jmem_heap_free_t));
     }
   }
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
 
   if (ret_block_p != NULL)
   {
     /* Managed to extend the block. Update memory usage and the skip pointer. */
+#if !ENABLED (JERRY_SEGREGATED_ALLOCATOR)
     JERRY_CONTEXT (jmem_heap_list_skip_p) = prev_p;
+#endif /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
     JERRY_CONTEXT (jmem_heap_allocated_size) += required_size;
 
     while (JERRY_CONTEXT (jmem_heap_allocated_size) >= JERRY_CONTEXT (jmem_heap_limit))
@@ -639,12 +709,18 @@ jmem_heap_realloc_block (void *ptr, /**< memory region to reallocate */
     JERRY_CONTEXT (jmem_heap_allocated_size) -= aligned_old_size;
     ret_block_p = jmem_heap_alloc_block_internal (new_size);
 
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+    memcpy (ret_block_p, block_p, old_size);
+    JMEM_VALGRIND_NOACCESS_SPACE (block_p, aligned_old_size);
+    jmem_heap_segregated_free (block_p, aligned_old_size);
+#else /* !ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
     /* jmem_heap_alloc_block_internal may trigger garbage collection, which can create new free blocks
      * in the heap structure, so we need to look up the previous block again. */
     prev_p = jmem_heap_find_prev (block_p);
 
     memcpy (ret_block_p, block_p, old_size);
     jmem_heap_insert_block (block_p, prev_p, aligned_old_size);
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
     /* jmem_heap_alloc_block_internal will call JMEM_VALGRIND_MALLOCLIKE_SPACE */
     JMEM_VALGRIND_FREELIKE_SPACE (block_p);
   }
@@ -139,11 +139,39 @@ typedef struct
   uint32_t size; /**< Size of region */
 } jmem_heap_free_t;
 
+#if ENABLED (JERRY_SEGREGATED_ALLOCATOR)
+
+/**
+ * Logarithm of the number of second level bins of the segregated allocator.
+ */
+#define JMEM_HEAP_SL_COUNT_LOG 3
+
+/**
+ * Number of second level bins in each first level class of the segregated allocator.
+ */
+#define JMEM_HEAP_SL_COUNT (1u << JMEM_HEAP_SL_COUNT_LOG)
+
+/**
+ * Number of first level classes of the segregated allocator.
+ *
+ * Note:
+ *      block sizes are counted in JMEM_ALIGNMENT sized units, so the size of the largest
+ *      block is less than 2^(offset bits - JMEM_ALIGNMENT_LOG) units
+ */
+#if ENABLED (JERRY_CPOINTER_32_BIT)
+#define JMEM_HEAP_FL_COUNT (32 - JMEM_ALIGNMENT_LOG - JMEM_HEAP_SL_COUNT_LOG + 1)
+#else /* !ENABLED (JERRY_CPOINTER_32_BIT) */
+#define JMEM_HEAP_FL_COUNT (16 + 1 - JMEM_HEAP_SL_COUNT_LOG + 1)
+#endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+
+#endif /* ENABLED (JERRY_SEGREGATED_ALLOCATOR) */
+
 void jmem_init (void);
 void jmem_finalize (void);
 
 void *jmem_heap_alloc_block (const size_t size);
 void *jmem_heap_alloc_block_null_on_error (const size_t size);
+void *jmem_heap_alloc_block_no_gc (const size_t size);
 void *jmem_heap_realloc_block (void *ptr, const size_t old_size, const size_t new_size);
 void jmem_heap_free_block (void *ptr, const size_t size);
 
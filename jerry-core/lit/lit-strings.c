@@ -569,6 +569,131 @@ lit_utf8_decr (const lit_utf8_byte_t **buf_p) /**< [in,out] buffer with characte
   *buf_p = current_p;
 } /* lit_utf8_decr */
 
+#if JERRY_FAST_STRING_HASH
+
+/**
+ * Multiplier of the polynomial string hash (prime close to 2^32 divided by the golden ratio).
+ */
+#define LIT_STRING_HASH_MULTIPLIER 0x9e3779b1u
+
+/**
+ * Powers of the multiplier for evaluating four bytes in one step.
+ */
+#define LIT_STRING_HASH_MULTIPLIER_POW2 0xffe6cc61u
+#define LIT_STRING_HASH_MULTIPLIER_POW3 0xcc042811u
+#define LIT_STRING_HASH_MULTIPLIER_POW4 0x1f76bcc1u
+
+/**
+ * Initial value of the polynomial string hash.
+ */
+#define LIT_STRING_HASH_SEED 0x811c9dc5u
+
+/**
+ * Mix the bits of a polynomial hash value (finalizer of MurmurHash3).
+ *
+ * @return mixed hash value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+lit_string_hash_mix (uint32_t hash) /**< polynomial hash value */
+{
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash;
+} /* lit_string_hash_mix */
+
+/**
+ * Inverse of lit_string_hash_mix.
+ *
+ * @return polynomial hash value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+lit_string_hash_unmix (uint32_t hash) /**< mixed hash value */
+{
+  hash ^= hash >> 16;
+  /* Multiplicative inverse of 0xc2b2ae35. */
+  hash *= 0x7ed1b41du;
+  hash ^= (hash >> 13) ^ (hash >> 26);
+  /* Multiplicative inverse of 0x85ebca6b. */
+  hash *= 0xa5cb9243u;
+  hash ^= hash >> 16;
+  return hash;
+} /* lit_string_hash_unmix */
+
+/**
+ * Continue a polynomial hash value with the bytes of a buffer.
+ *
+ * Computes hash * M^n + buf[0] * M^(n-1) + ... + buf[n-1], where the four
+ * multiplications of a four byte step are independent from each other.
+ *
+ * @return polynomial hash value
+ */
+static inline uint32_t JERRY_ATTR_ALWAYS_INLINE
+lit_string_hash_update (uint32_t hash, /**< polynomial hash value */
+                        const lit_utf8_byte_t *utf8_buf_p, /**< characters buffer */
+                        lit_utf8_size_t utf8_buf_size) /**< number of characters in the buffer */
+{
+  const lit_utf8_byte_t *utf8_buf_end_p = utf8_buf_p + utf8_buf_size;
+
+  while (utf8_buf_end_p - utf8_buf_p >= 4)
+  {
+    hash = (hash * LIT_STRING_HASH_MULTIPLIER_POW4
+            + utf8_buf_p[0] * LIT_STRING_HASH_MULTIPLIER_POW3
+            + utf8_buf_p[1] * LIT_STRING_HASH_MULTIPLIER_POW2
+            + utf8_buf_p[2] * LIT_STRING_HASH_MULTIPLIER
+            + utf8_buf_p[3]);
+    utf8_buf_p += 4;
+  }
+
+  while (utf8_buf_p < utf8_buf_end_p)
+  {
+    hash = hash * LIT_STRING_HASH_MULTIPLIER + *utf8_buf_p++;
+  }
+
+  return hash;
+} /* lit_string_hash_update */
+
+/**
+ * Calc hash using the specified hash_basis.
+ *
+ * NOTE:
+ *   The hash of a string is a polynomial hash of its bytes mixed by an invertible
+ *   function, so continuing the hash of a string with the bytes of another string
+ *   gives the hash of their concatenation.
+ *
+ * @return ecma-string's hash
+ */
+inline lit_string_hash_t JERRY_ATTR_ALWAYS_INLINE
+lit_utf8_string_hash_combine (lit_string_hash_t hash_basis, /**< hash to be combined with */
+                              const lit_utf8_byte_t *utf8_buf_p, /**< characters buffer */
+                              lit_utf8_size_t utf8_buf_size) /**< number of characters in the buffer */
+{
+  JERRY_ASSERT (utf8_buf_p != NULL || utf8_buf_size == 0);
+
+  uint32_t hash = lit_string_hash_unmix (hash_basis);
+  hash = lit_string_hash_update (hash, utf8_buf_p, utf8_buf_size);
+  return (lit_string_hash_t) lit_string_hash_mix (hash);
+} /* lit_utf8_string_hash_combine */
+
+/**
+ * Calculate hash from the buffer.
+ *
+ * @return ecma-string's hash
+ */
+inline lit_string_hash_t JERRY_ATTR_ALWAYS_INLINE
+lit_utf8_string_calc_hash (const lit_utf8_byte_t *utf8_buf_p, /**< characters buffer */
+                           lit_utf8_size_t utf8_buf_size) /**< number of characters in the buffer */
+{
+  JERRY_ASSERT (utf8_buf_p != NULL || utf8_buf_size == 0);
+
+  uint32_t hash = lit_string_hash_update (LIT_STRING_HASH_SEED, utf8_buf_p, utf8_buf_size);
+  return (lit_string_hash_t) lit_string_hash_mix (hash);
+} /* lit_utf8_string_calc_hash */
+
+#else /* !JERRY_FAST_STRING_HASH */
+
 /**
  * Calc hash using the specified hash_basis.
  *
@@ -612,6 +737,8 @@ lit_utf8_string_calc_hash (const lit_utf8_byte_t *utf8_buf_p, /**< characters bu
   return lit_utf8_string_hash_combine ((lit_string_hash_t) 2166136261, utf8_buf_p, utf8_buf_size);
 } /* lit_utf8_string_calc_hash */
 
+#endif /* JERRY_FAST_STRING_HASH */
+
 /**
  * Return code unit at the specified position in string
  *
@@ -638,6 +765,173 @@ lit_utf8_string_code_unit_at (const lit_utf8_byte_t *utf8_buf_p, /**< utf-8 stri
   return code_unit;
 } /* lit_utf8_string_code_unit_at */
 
+/**
+ * Minimum size of a needle which is searched by the Boyer-Moore-Horspool algorithm
+ */
+#define LIT_STRING_FIND_SKIP_TABLE_MIN_NEEDLE_SIZE 4
+
+/**
+ * Minimum size of a haystack which is searched by the Boyer-Moore-Horspool algorithm
+ */
+#define LIT_STRING_FIND_SKIP_TABLE_MIN_HAYSTACK_SIZE 256
+
+/**
+ * Find the first occurrence of a cesu-8 string in another cesu-8 string
+ *
+ * Note:
+ *   the search compares bytes: since the first byte of a character is never equal to
+ *   the continuation bytes of another character, each match starts at a character boundary
+ *
+ * @return pointer to the first occurrence - if the needle is found
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_string_find (const lit_utf8_byte_t *haystack_p, /**< string to be searched */
+                      lit_utf8_size_t haystack_size, /**< size of the haystack */
+                      const lit_utf8_byte_t *needle_p, /**< string to be found */
+                      lit_utf8_size_t needle_size) /**< size of the needle */
+{
+  if (needle_size == 0)
+  {
+    return haystack_p;
+  }
+
+  if (needle_size > haystack_size)
+  {
+    return NULL;
+  }
+
+  lit_utf8_size_t last_pos = haystack_size - needle_size;
+
+  if (needle_size < LIT_STRING_FIND_SKIP_TABLE_MIN_NEEDLE_SIZE
+      || haystack_size < LIT_STRING_FIND_SKIP_TABLE_MIN_HAYSTACK_SIZE)
+  {
+    /* The candidates are found by memchr, which is vectorized by most C libraries. */
+    const lit_utf8_byte_t *current_p = haystack_p;
+    const lit_utf8_byte_t *last_p = haystack_p + last_pos;
+
+    while (current_p <= last_p)
+    {
+      current_p = (const lit_utf8_byte_t *) memchr (current_p, needle_p[0], (size_t) (last_p - current_p) + 1);
+
+      if (current_p == NULL)
+      {
+        return NULL;
+      }
+
+      if (memcmp (current_p + 1, needle_p + 1, needle_size - 1) == 0)
+      {
+        return current_p;
+      }
+
+      current_p++;
+    }
+
+    return NULL;
+  }
+
+  /* Boyer-Moore-Horspool search: the shifts are limited to UINT8_MAX, which is still correct for long needles. */
+  uint8_t skip_table[UINT8_MAX + 1];
+  lit_utf8_size_t max_skip = JERRY_MIN (needle_size, UINT8_MAX);
+
+  memset (skip_table, (int) max_skip, sizeof (skip_table));
+
+  for (lit_utf8_size_t i = needle_size - max_skip; i < needle_size - 1; i++)
+  {
+    skip_table[needle_p[i]] = (uint8_t) (needle_size - 1 - i);
+  }
+
+  lit_utf8_byte_t last_byte = needle_p[needle_size - 1];
+  lit_utf8_size_t pos = 0;
+
+  while (pos <= last_pos)
+  {
+    lit_utf8_byte_t byte = haystack_p[pos + needle_size - 1];
+
+    if (byte == last_byte && memcmp (haystack_p + pos, needle_p, needle_size - 1) == 0)
+    {
+      return haystack_p + pos;
+    }
+
+    pos += skip_table[byte];
+  }
+
+  return NULL;
+} /* lit_utf8_string_find */
+
+/**
+ * Find the last occurrence of a cesu-8 string in another cesu-8 string
+ *
+ * @return pointer to the last occurrence - if the needle is found
+ *         NULL - otherwise
+ */
+const lit_utf8_byte_t *
+lit_utf8_string_find_last (const lit_utf8_byte_t *haystack_p, /**< string to be searched */
+                           lit_utf8_size_t haystack_size, /**< size of the haystack */
+                           const lit_utf8_byte_t *needle_p, /**< string to be found */
+                           lit_utf8_size_t needle_size) /**< size of the needle */
+{
+  if (needle_size == 0)
+  {
+    return haystack_p + haystack_size;
+  }
+
+  if (needle_size > haystack_size)
+  {
+    return NULL;
+  }
+
+  lit_utf8_size_t pos = haystack_size - needle_size;
+  lit_utf8_byte_t first_byte = needle_p[0];
+
+  if (needle_size < LIT_STRING_FIND_SKIP_TABLE_MIN_NEEDLE_SIZE
+      || haystack_size < LIT_STRING_FIND_SKIP_TABLE_MIN_HAYSTACK_SIZE)
+  {
+    while (true)
+    {
+      if (haystack_p[pos] == first_byte && memcmp (haystack_p + pos + 1, needle_p + 1, needle_size - 1) == 0)
+      {
+        return haystack_p + pos;
+      }
+
+      if (pos == 0)
+      {
+        return NULL;
+      }
+
+      pos--;
+    }
+  }
+
+  /* Boyer-Moore-Horspool search backwards: the needle is aligned to its first byte. */
+  uint8_t skip_table[UINT8_MAX + 1];
+  lit_utf8_size_t max_skip = JERRY_MIN (needle_size, UINT8_MAX);
+
+  memset (skip_table, (int) max_skip, sizeof (skip_table));
+
+  for (lit_utf8_size_t i = max_skip - 1; i > 0; i--)
+  {
+    skip_table[needle_p[i]] = (uint8_t) i;
+  }
+
+  while (true)
+  {
+    lit_utf8_byte_t byte = haystack_p[pos];
+
+    if (byte == first_byte && memcmp (haystack_p + pos + 1, needle_p + 1, needle_size - 1) == 0)
+    {
+      return haystack_p + pos;
+    }
+
+    if (pos < skip_table[byte])
+    {
+      return NULL;
+    }
+
+    pos -= skip_table[byte];
+  }
+} /* lit_utf8_string_find_last */
+
 /**
  * Get CESU-8 encoded size of character
  *
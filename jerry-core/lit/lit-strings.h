@@ -110,6 +110,12 @@ ecma_char_t lit_utf8_string_code_unit_at (const lit_utf8_byte_t *utf8_buf_p, lit
                                           lit_utf8_size_t code_unit_offset);
 lit_utf8_size_t lit_get_unicode_char_size_by_utf8_first_byte (const lit_utf8_byte_t first_byte);
 
+/* substring search */
+const lit_utf8_byte_t *lit_utf8_string_find (const lit_utf8_byte_t *haystack_p, lit_utf8_size_t haystack_size,
+                                             const lit_utf8_byte_t *needle_p, lit_utf8_size_t needle_size);
+const lit_utf8_byte_t *lit_utf8_string_find_last (const lit_utf8_byte_t *haystack_p, lit_utf8_size_t haystack_size,
+                                                  const lit_utf8_byte_t *needle_p, lit_utf8_size_t needle_size);
+
 /* conversion */
 lit_utf8_size_t lit_code_unit_to_utf8 (ecma_char_t code_unit, lit_utf8_byte_t *buf_p);
 lit_utf8_size_t lit_code_point_to_utf8 (lit_code_point_t code_point, lit_utf8_byte_t *buf);
@@ -25,11 +25,17 @@ JERRY_STATIC_ASSERT ((sizeof (cbc_uint16_arguments_t) % sizeof (jmem_cpointer_t)
  * The reason of these two static asserts to notify the developer to increase the JERRY_SNAPSHOT_VERSION
  * whenever new bytecodes are introduced or existing ones have been deleted.
  */
-JERRY_STATIC_ASSERT (CBC_END == 238,
+JERRY_STATIC_ASSERT (CBC_END == 247,
                      number_of_cbc_opcodes_changed);
 JERRY_STATIC_ASSERT (CBC_EXT_END == 136,
                      number_of_cbc_ext_opcodes_changed);
 
+JERRY_STATIC_ASSERT (CBC_SUBTRACT_TWO_LITERALS_SET_IDENT - CBC_ADD_TWO_LITERALS_SET_IDENT
+                     == CBC_SUBTRACT_TWO_LITERALS - CBC_ADD_TWO_LITERALS
+                     && CBC_MULTIPLY_TWO_LITERALS_SET_IDENT - CBC_ADD_TWO_LITERALS_SET_IDENT
+                        == CBC_MULTIPLY_TWO_LITERALS - CBC_ADD_TWO_LITERALS,
+                     arithmetic_set_ident_opcodes_must_follow_the_order_of_arithmetic_opcodes);
+
 #if ENABLED (JERRY_PARSER)
 
 /** \addtogroup parser Parser
@@ -66,7 +72,7 @@ const uint8_t cbc_ext_flags[] =
 
 #undef CBC_OPCODE
 
-#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
+#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) || ENABLED (JERRY_VM_OPCODE_STATS)
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) #arg1,
 
@@ -88,7 +94,7 @@ const char * const cbc_ext_names[] =
 
 #undef CBC_OPCODE
 
-#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
+#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) || ENABLED (JERRY_VM_OPCODE_STATS) */
 
 /**
  * @}
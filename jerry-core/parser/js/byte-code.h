@@ -116,11 +116,36 @@
   CBC_OPCODE (name ## _IDENT_BLOCK, CBC_HAS_LITERAL_ARG, 0, \
               (VM_OC_ ## group) | VM_OC_GET_LITERAL | VM_OC_PUT_IDENT | VM_OC_PUT_BLOCK)
 
+/* Combined opcodes of the 'ident = literal op literal' idiom: the two
+ * literal operands are followed by the literal of the identifier. */
+#define CBC_ARITHMETIC_SET_IDENT_OPERATION(name) \
+  CBC_OPCODE (name ## _TWO_LITERALS_SET_IDENT, CBC_HAS_LITERAL_ARG2, 0, \
+              VM_OC_ARITHMETIC_SET_IDENT | VM_OC_GET_LITERAL_LITERAL) \
+  CBC_OPCODE (name ## _TWO_LITERALS_SET_IDENT_PUSH_RESULT, CBC_HAS_LITERAL_ARG2, 1, \
+              VM_OC_ARITHMETIC_SET_IDENT | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_STACK) \
+  CBC_OPCODE (name ## _TWO_LITERALS_SET_IDENT_BLOCK, CBC_HAS_LITERAL_ARG2, 0, \
+              VM_OC_ARITHMETIC_SET_IDENT | VM_OC_GET_LITERAL_LITERAL | VM_OC_PUT_BLOCK)
+
 #define CBC_UNARY_LVALUE_WITH_IDENT 3
 
 #define CBC_BINARY_WITH_LITERAL 1
 #define CBC_BINARY_WITH_TWO_LITERALS 2
 
+/**
+ * Checks whether the opcode is an arithmetic operation with
+ * two literal arguments which has a combined set ident form.
+ */
+#define CBC_HAS_ARITHMETIC_SET_IDENT_FORM(opcode) \
+  ((opcode) == CBC_ADD_TWO_LITERALS \
+   || (opcode) == CBC_SUBTRACT_TWO_LITERALS \
+   || (opcode) == CBC_MULTIPLY_TWO_LITERALS)
+
+/**
+ * Converts an arithmetic operation with two literal arguments to its combined set ident form.
+ */
+#define CBC_ARITHMETIC_TO_SET_IDENT(opcode) \
+  ((opcode) - CBC_ADD_TWO_LITERALS + CBC_ADD_TWO_LITERALS_SET_IDENT)
+
 /**
  * Several opcodes (mostly call and assignment opcodes) have
  * two forms: one which does not push a return value onto
@@ -510,6 +535,9 @@
               VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_ASSIGN_PROP_THIS_LITERAL_BLOCK, CBC_HAS_LITERAL_ARG, -1, \
               VM_OC_ASSIGN_PROP_THIS | VM_OC_GET_LITERAL | VM_OC_PUT_REFERENCE | VM_OC_PUT_BLOCK) \
+  CBC_ARITHMETIC_SET_IDENT_OPERATION (CBC_ADD) \
+  CBC_ARITHMETIC_SET_IDENT_OPERATION (CBC_SUBTRACT) \
+  CBC_ARITHMETIC_SET_IDENT_OPERATION (CBC_MULTIPLY) \
   CBC_OPCODE (CBC_MOV_IDENT, CBC_HAS_LITERAL_ARG, -1, \
               VM_OC_MOV_IDENT | VM_OC_GET_STACK | VM_OC_PUT_IDENT) \
   CBC_OPCODE (CBC_ASSIGN_LET_CONST, CBC_HAS_LITERAL_ARG, -1, \
@@ -857,6 +885,8 @@ typedef enum
   CBC_CODE_FLAGS_REST_PARAMETER = (1u << 8), /**< this function has rest parameter */
   CBC_CODE_FLAGS_HAS_TAGGED_LITERALS = (1u << 9), /**< this function has tagged template literal list */
   CBC_CODE_FLAGS_LEXICAL_BLOCK_NEEDED = (1u << 10), /**< compiled code needs a lexical block */
+  CBC_CODE_FLAGS_STATIC_SCOPE = (1u << 11), /**< the lexical environments of the scope chain are never
+                                              *   extended by direct eval calls (see vm_scope_cache_find) */
 
   /* Bits from bit 12 is reserved for function types (see CBC_FUNCTION_TYPE_SHIFT).
    * Note: the last bits are used for type flags because < and >= operators can be used to
@@ -960,7 +990,7 @@ typedef enum
 extern const uint8_t cbc_flags[];
 extern const uint8_t cbc_ext_flags[];
 
-#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE)
+#if ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) || ENABLED (JERRY_VM_OPCODE_STATS)
 
 /**
  * Opcode names for debugging.
@@ -968,7 +998,7 @@ extern const uint8_t cbc_ext_flags[];
 extern const char * const cbc_names[];
 extern const char * const cbc_ext_names[];
 
-#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) */
+#endif /* ENABLED (JERRY_PARSER_DUMP_BYTE_CODE) || ENABLED (JERRY_VM_OPCODE_STATS) */
 
 /**
  * @}
@@ -2357,7 +2357,7 @@ parser_process_unary_expression (parser_context_t *context_p, /**< context */
 
         if (is_eval)
         {
-          context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+          context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED | PARSER_HAS_DIRECT_EVAL;
 
 #if ENABLED (JERRY_ESNEXT)
           uint16_t eval_flags = PARSER_SAVE_STATUS_FLAGS (context_p->status_flags);
@@ -2972,6 +2972,17 @@ parser_process_binary_opcodes (parser_context_t *context_p, /**< context */
           continue;
         }
 
+        if (CBC_HAS_ARITHMETIC_SET_IDENT_FORM (context_p->last_cbc_opcode)
+            && opcode == CBC_ASSIGN_SET_IDENT)
+        {
+          JERRY_ASSERT (CBC_ARGS_EQ (CBC_ARITHMETIC_TO_SET_IDENT (context_p->last_cbc_opcode),
+                                     CBC_HAS_LITERAL_ARG2));
+
+          context_p->last_cbc.third_literal_index = index;
+          context_p->last_cbc_opcode = (uint16_t) CBC_ARITHMETIC_TO_SET_IDENT (context_p->last_cbc_opcode);
+          continue;
+        }
+
         parser_emit_cbc_literal (context_p, (uint16_t) opcode, index);
 
         if (opcode == CBC_ASSIGN_PROP_THIS_LITERAL
@@ -80,6 +80,7 @@ typedef enum
   PARSER_MODULE_DEFAULT_CLASS_OR_FUNC = (1u << 25),  /**< parsing a function or class default export */
   PARSER_MODULE_STORE_IDENT = (1u << 26),     /**< store identifier of the current export statement */
 #endif /* ENABLED (JERRY_MODULE_SYSTEM) */
+  PARSER_HAS_DIRECT_EVAL = (1u << 27),        /**< the code block contains a direct eval call */
   PARSER_HAS_LATE_LIT_INIT = (1u << 30),      /**< there are identifier or string literals which construction
                                                *   is postponed after the local parser data is freed */
 #ifndef JERRY_NDEBUG
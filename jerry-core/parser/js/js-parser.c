@@ -217,6 +217,61 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
   *const_literal_end = const_literal_index;
 } /* parser_compute_indicies */
 
+/**
+ * Clear the static scope flag of a function and its nested functions.
+ *
+ * Note:
+ *      the lexical environment of the enclosing code block can be extended by a direct
+ *      eval call, so the scope chains of these functions may gain new bindings
+ */
+static void
+parser_clear_static_scope (ecma_compiled_code_t *bytecode_p) /**< function byte code */
+{
+  JERRY_ASSERT (CBC_IS_FUNCTION (bytecode_p->status_flags));
+
+  /* The flag of the nested functions is cleared as well when the flag is not set. */
+  if (!(bytecode_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE))
+  {
+    return;
+  }
+
+  bytecode_p->status_flags &= (uint16_t) ~CBC_CODE_FLAGS_STATIC_SCOPE;
+
+  ecma_value_t *literal_start_p;
+  uint32_t literal_end;
+  uint32_t const_literal_end;
+
+  if (bytecode_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) bytecode_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+
+    literal_start_p = (ecma_value_t *) ((uint8_t *) bytecode_p + sizeof (cbc_uint16_arguments_t));
+    literal_start_p -= args_p->register_end;
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) bytecode_p;
+    literal_end = args_p->literal_end;
+    const_literal_end = args_p->const_literal_end;
+
+    literal_start_p = (ecma_value_t *) ((uint8_t *) bytecode_p + sizeof (cbc_uint8_arguments_t));
+    literal_start_p -= args_p->register_end;
+  }
+
+  for (uint32_t i = const_literal_end; i < literal_end; i++)
+  {
+    ecma_compiled_code_t *bytecode_literal_p = ECMA_GET_INTERNAL_VALUE_POINTER (ecma_compiled_code_t,
+                                                                                literal_start_p[i]);
+
+    if (CBC_IS_FUNCTION (bytecode_literal_p->status_flags))
+    {
+      parser_clear_static_scope (bytecode_literal_p);
+    }
+  }
+} /* parser_clear_static_scope */
+
 /**
  * Initialize literal pool.
  */
@@ -277,6 +332,12 @@ parser_init_literal_pool (parser_context_t *context_p, /**< context */
 
         ECMA_SET_INTERNAL_VALUE_POINTER (literal_pool_p[literal_p->prop.index],
                                          literal_p->u.bytecode_p);
+
+        if (literal_p->type == LEXER_FUNCTION_LITERAL
+            && (context_p->status_flags & PARSER_HAS_DIRECT_EVAL))
+        {
+          parser_clear_static_scope (literal_p->u.bytecode_p);
+        }
         break;
       }
       default:
@@ -690,6 +751,11 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     JERRY_DEBUG_MSG (",no_lexical_env");
   }
 
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+  {
+    JERRY_DEBUG_MSG (",static_scope");
+  }
+
 #if ENABLED (JERRY_ESNEXT)
   switch (CBC_FUNCTION_GET_TYPE (compiled_code_p->status_flags))
   {
@@ -1396,6 +1462,20 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED;
   }
 
+  /* The scope chain of direct eval code contains the lexical environments of the
+   * caller, which can be extended by other eval calls of the caller. */
+  if (!(context_p->status_flags & PARSER_HAS_DIRECT_EVAL)
+      && !(context_p->global_status_flags & ECMA_PARSE_DIRECT_EVAL))
+  {
+#if ENABLED (JERRY_DEBUGGER)
+    /* The debugger can evaluate expressions in any frame. */
+    if (!(JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_CONNECTED))
+#endif /* ENABLED (JERRY_DEBUGGER) */
+    {
+      compiled_code_p->status_flags |= CBC_CODE_FLAGS_STATIC_SCOPE;
+    }
+  }
+
 #if ENABLED (JERRY_ESNEXT)
   uint16_t function_type = CBC_FUNCTION_TO_TYPE_BITS (CBC_FUNCTION_NORMAL);
 
@@ -34,7 +34,12 @@
 /**
   * Size of the RegExp bytecode cache
   */
-#define RE_CACHE_SIZE 8u
+#define RE_CACHE_SIZE ((uint32_t) JERRY_REGEXP_CACHE_SIZE)
+
+/**
+ * Number of entries in a set of the RegExp bytecode cache
+ */
+#define RE_CACHE_SET_SIZE 4u
 
 /**
  * Maximum value that can be encoded in the RegExp bytecode as a single byte.
@@ -89,6 +94,52 @@ typedef enum
   RE_OP_BYTE,                                     /**< 1-byte utf8 character */
 } re_opcode_t;
 
+#if ENABLED (JERRY_REGEXP_NFA)
+
+/**
+ * Maximum number of instructions in an NFA program.
+ */
+#define RE_NFA_MAX_LENGTH 128u
+
+/**
+ * Maximum number of capturing groups (including the whole match) of patterns with an NFA program.
+ */
+#define RE_NFA_MAX_CAPTURES 8u
+
+/**
+ * NFA instruction types
+ */
+typedef enum
+{
+  RE_NFA_CHAR,                                    /**< match the character atom at the bytecode offset in value */
+  RE_NFA_ASSERT,                                  /**< zero-width assertion, value is its RegExp opcode */
+  RE_NFA_JUMP,                                    /**< continue with the instruction in value */
+  RE_NFA_SPLIT_NEXT,                              /**< try the next instruction first, then the one in value */
+  RE_NFA_SPLIT_JUMP,                              /**< try the instruction in value first, then the next one */
+  RE_NFA_SAVE_START,                              /**< save the start of the capturing group in value */
+  RE_NFA_SAVE_END,                                /**< save the end of the capturing group in value */
+  RE_NFA_CLEAR,                                   /**< clear count capturing groups starting from value */
+  RE_NFA_MATCH,                                   /**< pattern matched */
+} re_nfa_type_t;
+
+/**
+ * NFA instruction
+ */
+typedef struct
+{
+  uint8_t type;                      /**< instruction type (re_nfa_type_t) */
+  uint8_t count;                     /**< number of cleared capturing groups */
+  uint16_t value;                    /**< instruction operand */
+} re_nfa_inst_t;
+
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
+/**
+ * Size of the prefilter data: a bit set of the possible first bytes of a match,
+ * or a literal prefix of at most this many bytes.
+ */
+#define RE_PREFILTER_SIZE 32u
+
 /**
  * Compiled byte code data.
  */
@@ -98,8 +149,38 @@ typedef struct
   uint32_t captures_count;           /**< number of capturing groups */
   uint32_t non_captures_count;       /**< number of non-capturing groups */
   ecma_value_t source;               /**< original RegExp pattern */
+  uint16_t prefilter_offset;         /**< offset of the prefilter data from the start of the compiled code,
+                                      *   0 if the pattern has no prefilter */
+  uint16_t prefix_size;              /**< size of the literal prefix, 0 if the prefilter data is a set of bytes */
+#if ENABLED (JERRY_REGEXP_NFA)
+  uint16_t nfa_offset;               /**< offset of the NFA program from the start of the compiled code,
+                                      *   0 if the pattern has no NFA program */
+  uint16_t nfa_length;               /**< number of instructions in the NFA program */
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
 } re_compiled_code_t;
 
+/**
+ * Entry of the RegExp bytecode cache.
+ */
+typedef struct
+{
+  re_compiled_code_t *bytecode_p;    /**< compiled pattern, NULL if the entry is unused */
+  lit_string_hash_t hash;            /**< hash of the pattern string */
+  uint32_t last_use;                 /**< value of the use counter of the cache when the entry was last used */
+} re_cache_entry_t;
+
+#if ENABLED (JERRY_MEM_STATS)
+/**
+ * Usage statistics of the RegExp bytecode cache.
+ */
+typedef struct
+{
+  size_t hit_count;                  /**< number of patterns found in the cache */
+  size_t miss_count;                 /**< number of patterns compiled */
+  size_t eviction_count;             /**< number of patterns replaced by newer ones */
+} re_cache_stats_t;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
 void re_initialize_regexp_bytecode (re_compiler_ctx_t *re_ctx_p);
 uint32_t re_bytecode_size (re_compiler_ctx_t *re_ctx_p);
 
@@ -38,6 +38,44 @@
  * @{
  */
 
+/**
+ * Get the set of the RegExp cache, where the pattern can be stored.
+ *
+ * @return pointer to the first entry of the set
+ */
+static inline re_cache_entry_t * JERRY_ATTR_ALWAYS_INLINE
+re_cache_get_set (lit_string_hash_t hash, /**< hash of the pattern string */
+                  uint16_t flags) /**< flags */
+{
+  const uint32_t set_index = (hash + flags) & (RE_CACHE_SIZE / RE_CACHE_SET_SIZE - 1);
+  return JERRY_CONTEXT (re_cache) + set_index * RE_CACHE_SET_SIZE;
+} /* re_cache_get_set */
+
+/**
+ * Increase the use counter of the RegExp cache.
+ *
+ * @return new value of the use counter
+ */
+static uint32_t
+re_cache_next_use (void)
+{
+  uint32_t use_count = ++JERRY_CONTEXT (re_cache_use_count);
+
+  if (JERRY_UNLIKELY (use_count == 0))
+  {
+    /* The order of the entries is lost when the counter wraps around. */
+    for (uint32_t i = 0; i < RE_CACHE_SIZE; i++)
+    {
+      JERRY_CONTEXT (re_cache)[i].last_use = 0;
+    }
+
+    use_count = 1;
+    JERRY_CONTEXT (re_cache_use_count) = use_count;
+  }
+
+  return use_count;
+} /* re_cache_next_use */
+
 /**
  * Search for the given pattern in the RegExp cache.
  *
@@ -48,52 +86,1169 @@ static re_compiled_code_t *
 re_cache_lookup (ecma_string_t *pattern_str_p, /**< pattern string */
                  uint16_t flags) /**< flags */
 {
-  re_compiled_code_t **cache_p = JERRY_CONTEXT (re_cache);
+  const lit_string_hash_t hash = ecma_string_hash (pattern_str_p);
+  re_cache_entry_t *entry_p = re_cache_get_set (hash, flags);
 
-  for (uint8_t idx = 0u; idx < RE_CACHE_SIZE; idx++)
+  for (uint32_t i = 0; i < RE_CACHE_SET_SIZE; i++, entry_p++)
   {
-    re_compiled_code_t *cached_bytecode_p = cache_p[idx];
+    re_compiled_code_t *cached_bytecode_p = entry_p->bytecode_p;
 
-    if (cached_bytecode_p == NULL)
+    if (cached_bytecode_p != NULL
+        && entry_p->hash == hash
+        && cached_bytecode_p->header.status_flags == flags
+        && ecma_compare_ecma_strings (ecma_get_string_from_value (cached_bytecode_p->source), pattern_str_p))
     {
-      break;
+      entry_p->last_use = re_cache_next_use ();
+#if ENABLED (JERRY_MEM_STATS)
+      JERRY_CONTEXT (re_cache_stats).hit_count++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+      return cached_bytecode_p;
     }
+  }
 
-    ecma_string_t *cached_pattern_str_p = ecma_get_string_from_value (cached_bytecode_p->source);
+#if ENABLED (JERRY_MEM_STATS)
+  JERRY_CONTEXT (re_cache_stats).miss_count++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+  return NULL;
+} /* re_cache_lookup */
+
+/**
+ * Insert a compiled pattern into the RegExp cache, replacing the least recently used pattern of its set.
+ */
+static void
+re_cache_insert (ecma_string_t *pattern_str_p, /**< pattern string */
+                 re_compiled_code_t *bytecode_p) /**< compiled pattern */
+{
+  const lit_string_hash_t hash = ecma_string_hash (pattern_str_p);
+  re_cache_entry_t *entry_p = re_cache_get_set (hash, bytecode_p->header.status_flags);
+  re_cache_entry_t *victim_p = entry_p;
 
-    if (cached_bytecode_p->header.status_flags == flags
-        && ecma_compare_ecma_strings (cached_pattern_str_p, pattern_str_p))
+  for (uint32_t i = 0; i < RE_CACHE_SET_SIZE; i++, entry_p++)
+  {
+    if (entry_p->bytecode_p == NULL)
     {
-      return cached_bytecode_p;
+      victim_p = entry_p;
+      break;
+    }
+
+    if (entry_p->last_use < victim_p->last_use)
+    {
+      victim_p = entry_p;
     }
   }
 
-  return NULL;
-} /* re_cache_lookup */
+  if (victim_p->bytecode_p != NULL)
+  {
+    ecma_bytecode_deref ((ecma_compiled_code_t *) victim_p->bytecode_p);
+#if ENABLED (JERRY_MEM_STATS)
+    JERRY_CONTEXT (re_cache_stats).eviction_count++;
+#endif /* ENABLED (JERRY_MEM_STATS) */
+  }
+
+  victim_p->bytecode_p = bytecode_p;
+  victim_p->hash = hash;
+  victim_p->last_use = re_cache_next_use ();
+} /* re_cache_insert */
 
 /**
  * Run garbage collection in RegExp cache.
+ *
+ * The least recently used patterns are freed until the total size of the
+ * remaining ones does not exceed JERRY_REGEXP_CACHE_GC_LIMIT.
  */
 void
 re_cache_gc (void)
 {
-  re_compiled_code_t **cache_p = JERRY_CONTEXT (re_cache);
+  re_cache_entry_t *cache_p = JERRY_CONTEXT (re_cache);
+  size_t total_size = 0;
+
+  for (uint32_t i = 0; i < RE_CACHE_SIZE; i++)
+  {
+    if (cache_p[i].bytecode_p != NULL)
+    {
+      total_size += ((size_t) cache_p[i].bytecode_p->header.size) << JMEM_ALIGNMENT_LOG;
+    }
+  }
+
+  while (total_size > JERRY_REGEXP_CACHE_GC_LIMIT)
+  {
+    re_cache_entry_t *victim_p = NULL;
+
+    for (uint32_t i = 0; i < RE_CACHE_SIZE; i++)
+    {
+      if (cache_p[i].bytecode_p != NULL
+          && (victim_p == NULL || cache_p[i].last_use < victim_p->last_use))
+      {
+        victim_p = cache_p + i;
+      }
+    }
+
+    JERRY_ASSERT (victim_p != NULL);
+
+    total_size -= ((size_t) victim_p->bytecode_p->header.size) << JMEM_ALIGNMENT_LOG;
+    ecma_bytecode_deref ((ecma_compiled_code_t *) victim_p->bytecode_p);
+    victim_p->bytecode_p = NULL;
+  }
+} /* re_cache_gc */
+
+/**
+ * Free all patterns stored in the RegExp cache.
+ */
+void
+re_cache_free (void)
+{
+  re_cache_entry_t *cache_p = JERRY_CONTEXT (re_cache);
+
+  for (uint32_t i = 0; i < RE_CACHE_SIZE; i++)
+  {
+    if (cache_p[i].bytecode_p != NULL)
+    {
+      ecma_bytecode_deref ((ecma_compiled_code_t *) cache_p[i].bytecode_p);
+      cache_p[i].bytecode_p = NULL;
+    }
+  }
+} /* re_cache_free */
+
+#if ENABLED (JERRY_MEM_STATS)
+/**
+ * Print RegExp cache usage statistics
+ */
+void
+re_cache_stats_print (void)
+{
+  re_cache_stats_t *re_cache_stats_p = &JERRY_CONTEXT (re_cache_stats);
+
+  JERRY_DEBUG_MSG ("RegExp cache stats:\n"
+                   "  Size = %u\n"
+                   "  Hits = %zu\n"
+                   "  Misses = %zu\n"
+                   "  Evictions = %zu\n",
+                   (unsigned int) RE_CACHE_SIZE,
+                   re_cache_stats_p->hit_count,
+                   re_cache_stats_p->miss_count,
+                   re_cache_stats_p->eviction_count);
+} /* re_cache_stats_print */
+#endif /* ENABLED (JERRY_MEM_STATS) */
+
+/**
+ * Skip a character atom.
+ *
+ * @return pointer to the bytecode after the atom
+ */
+static const uint8_t *
+re_skip_atom (uint16_t flags, /**< RegExp flags */
+              const uint8_t *bc_p) /**< atom bytecode */
+{
+  const uint32_t char_size = (flags & RE_FLAG_UNICODE) ? sizeof (lit_code_point_t) : sizeof (ecma_char_t);
+
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_CLASS_ESCAPE:
+    case RE_OP_BYTE:
+    {
+      return bc_p + 1;
+    }
+    case RE_OP_CHAR:
+    {
+      return bc_p + char_size;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const uint8_t class_flags = re_get_byte (&bc_p);
+      const uint32_t char_count = (class_flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
+      const uint32_t range_count = (class_flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+
+      return bc_p + (class_flags & RE_CLASS_ESCAPE_COUNT_MASK) + (char_count + 2 * range_count) * char_size;
+    }
+    default:
+    {
+#if ENABLED (JERRY_ESNEXT)
+      JERRY_ASSERT (bc_p[-1] == RE_OP_PERIOD || bc_p[-1] == RE_OP_UNICODE_PERIOD);
+#else /* !ENABLED (JERRY_ESNEXT) */
+      JERRY_ASSERT (bc_p[-1] == RE_OP_PERIOD);
+#endif /* ENABLED (JERRY_ESNEXT) */
+      return bc_p;
+    }
+  }
+} /* re_skip_atom */
+
+/**
+ * Find the end opcode of a group.
+ *
+ * @return pointer to the end opcode
+ */
+static const uint8_t *
+re_find_group_end (uint16_t flags, /**< RegExp flags */
+                   const uint8_t *bc_p) /**< group body */
+{
+  uint32_t depth = 0;
+
+  while (true)
+  {
+    const uint8_t *op_p = bc_p;
+
+    switch (re_get_opcode (&bc_p))
+    {
+      case RE_OP_ALTERNATIVE_START:
+      case RE_OP_ALTERNATIVE_NEXT:
+      case RE_OP_BACKREFERENCE:
+      {
+        re_get_value (&bc_p);
+        break;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+
+        if (*op_p == RE_OP_NON_CAPTURING_GROUP_START)
+        {
+          re_get_value (&bc_p);
+        }
+
+        if (re_get_value (&bc_p) == 0)
+        {
+          re_get_value (&bc_p);
+        }
+
+        depth++;
+        break;
+      }
+      case RE_OP_GREEDY_CAPTURING_GROUP_END:
+      case RE_OP_GREEDY_NON_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_NON_CAPTURING_GROUP_END:
+      {
+        if (depth == 0)
+        {
+          return op_p;
+        }
+
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        depth--;
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        const uint32_t end_offset = re_get_value (&bc_p);
+        bc_p += end_offset;
+        break;
+      }
+      case RE_OP_ASSERT_LOOKAHEAD_POS:
+      case RE_OP_ASSERT_LOOKAHEAD_NEG:
+      {
+        re_get_byte (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        const uint32_t end_offset = re_get_value (&bc_p);
+        bc_p += end_offset;
+        break;
+      }
+      case RE_OP_EOF:
+      case RE_OP_NO_ALTERNATIVE:
+      case RE_OP_ITERATOR_END:
+      case RE_OP_ASSERT_LINE_START:
+      case RE_OP_ASSERT_LINE_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_END:
+      {
+        break;
+      }
+      default:
+      {
+        bc_p = re_skip_atom (flags, op_p);
+        break;
+      }
+    }
+  }
+} /* re_find_group_end */
+
+#if ENABLED (JERRY_REGEXP_NFA)
+
+/**
+ * Marker of unpatched NFA jump targets.
+ */
+#define RE_NFA_NO_TARGET UINT16_MAX
+
+/**
+ * NFA compiler context
+ */
+typedef struct
+{
+  const uint8_t *bc_start_p;          /**< start of the RegExp bytecode */
+  re_nfa_inst_t *program_p;           /**< NFA program */
+  uint32_t length;                    /**< number of emitted instructions */
+  uint16_t flags;                     /**< RegExp flags */
+  bool unsupported;                   /**< the pattern cannot be compiled to an NFA program */
+} re_nfa_compiler_t;
+
+/**
+ * Description of an item which is repeated by a quantifier
+ */
+typedef struct
+{
+  const uint8_t *bc_p;                /**< bytecode of the atom or the group body */
+  uint32_t capture_idx;               /**< index of the capturing group, 0 for atoms and non-capturing groups */
+  uint32_t clear_start;               /**< first nested capturing group */
+  uint32_t clear_count;               /**< number of nested capturing groups */
+  bool is_group;                      /**< the item is a group */
+} re_nfa_item_t;
+
+static bool re_nfa_compile_alternatives (re_nfa_compiler_t *nfa_p, const uint8_t **bc_p);
+
+/**
+ * Append an instruction to the NFA program.
+ *
+ * @return index of the instruction
+ */
+static uint32_t
+re_nfa_emit (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+             re_nfa_type_t type, /**< instruction type */
+             uint32_t count, /**< number of cleared capturing groups */
+             uint32_t value) /**< instruction operand */
+{
+  if (nfa_p->length >= RE_NFA_MAX_LENGTH || count > UINT8_MAX || value > UINT16_MAX)
+  {
+    nfa_p->unsupported = true;
+    return 0;
+  }
+
+  re_nfa_inst_t *inst_p = nfa_p->program_p + nfa_p->length;
+  inst_p->type = (uint8_t) type;
+  inst_p->count = (uint8_t) count;
+  inst_p->value = (uint16_t) value;
+  return nfa_p->length++;
+} /* re_nfa_emit */
+
+/**
+ * Set the targets of a chain of jump or split instructions, which are linked through their operands.
+ */
+static void
+re_nfa_patch_chain (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+                    uint32_t chain, /**< last instruction of the chain */
+                    uint32_t target) /**< jump target */
+{
+  while (chain != RE_NFA_NO_TARGET && !nfa_p->unsupported)
+  {
+    re_nfa_inst_t *inst_p = nfa_p->program_p + chain;
+    chain = inst_p->value;
+    inst_p->value = (uint16_t) target;
+  }
+} /* re_nfa_patch_chain */
+
+/**
+ * Emit one iteration of a quantified item.
+ *
+ * @return true - if the iteration can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_iteration (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+                          const re_nfa_item_t *item_p) /**< repeated item */
+{
+  if (!item_p->is_group)
+  {
+    re_nfa_emit (nfa_p, RE_NFA_CHAR, 0, (uint32_t) (item_p->bc_p - nfa_p->bc_start_p));
+    return false;
+  }
+
+  if (item_p->clear_count > 0)
+  {
+    re_nfa_emit (nfa_p, RE_NFA_CLEAR, item_p->clear_count, item_p->clear_start);
+  }
+
+  if (item_p->capture_idx > 0)
+  {
+    re_nfa_emit (nfa_p, RE_NFA_SAVE_START, 0, item_p->capture_idx);
+  }
+
+  const uint8_t *bc_p = item_p->bc_p;
+  const bool nullable = re_nfa_compile_alternatives (nfa_p, &bc_p);
+
+  if (item_p->capture_idx > 0)
+  {
+    re_nfa_emit (nfa_p, RE_NFA_SAVE_END, 0, item_p->capture_idx);
+  }
+
+  return nullable;
+} /* re_nfa_compile_iteration */
+
+/**
+ * Emit a quantified item.
+ *
+ * Note:
+ *      The backtracking matcher rejects optional iterations which match the empty
+ *      string. This cannot be expressed by an NFA program, so optional iterations
+ *      of items which can match the empty string are not supported.
+ *
+ * @return true - if the item can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_quantified (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+                           const re_nfa_item_t *item_p, /**< repeated item */
+                           uint32_t qmin, /**< minimum number of iterations */
+                           uint32_t qmax, /**< maximum number of iterations */
+                           bool greedy) /**< greedy quantifier */
+{
+  if (qmin >= RE_NFA_MAX_LENGTH || (qmax != UINT32_MAX && qmax - qmin >= RE_NFA_MAX_LENGTH))
+  {
+    nfa_p->unsupported = true;
+    return false;
+  }
+
+  bool nullable = true;
+
+  for (uint32_t i = 0; i < qmin && !nfa_p->unsupported; i++)
+  {
+    nullable = re_nfa_compile_iteration (nfa_p, item_p);
+  }
+
+  if (qmax <= qmin)
+  {
+    return nullable;
+  }
+
+  const re_nfa_type_t split_type = greedy ? RE_NFA_SPLIT_NEXT : RE_NFA_SPLIT_JUMP;
+
+  if (qmax == UINT32_MAX)
+  {
+    const uint32_t split_idx = re_nfa_emit (nfa_p, split_type, 0, RE_NFA_NO_TARGET);
+
+    if (re_nfa_compile_iteration (nfa_p, item_p))
+    {
+      nfa_p->unsupported = true;
+    }
+
+    re_nfa_emit (nfa_p, RE_NFA_JUMP, 0, split_idx);
+    re_nfa_patch_chain (nfa_p, split_idx, nfa_p->length);
+    return nullable;
+  }
+
+  /* Each optional iteration is skipped together with the following ones. */
+  uint32_t split_chain = RE_NFA_NO_TARGET;
+
+  for (uint32_t i = qmin; i < qmax && !nfa_p->unsupported; i++)
+  {
+    split_chain = re_nfa_emit (nfa_p, split_type, 0, split_chain);
+
+    if (re_nfa_compile_iteration (nfa_p, item_p))
+    {
+      nfa_p->unsupported = true;
+    }
+  }
+
+  re_nfa_patch_chain (nfa_p, split_chain, nfa_p->length);
+  return nullable;
+} /* re_nfa_compile_quantified */
+
+/**
+ * Emit a group.
+ *
+ * @return true - if the group can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_group (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+                      const uint8_t **bc_p) /**< [in, out] bytecode pointer */
+{
+  re_nfa_item_t item;
+  item.is_group = true;
+  item.capture_idx = 0;
+
+  if (re_get_opcode (bc_p) == RE_OP_CAPTURING_GROUP_START)
+  {
+    item.capture_idx = re_get_value (bc_p);
+    item.clear_start = item.capture_idx + 1;
+    item.clear_count = re_get_value (bc_p) - 1;
+  }
+  else
+  {
+    re_get_value (bc_p);
+    item.clear_start = re_get_value (bc_p);
+    item.clear_count = re_get_value (bc_p);
+  }
+
+  const uint32_t qmin = re_get_value (bc_p);
+
+  if (qmin == 0)
+  {
+    const uint32_t end_offset = re_get_value (bc_p);
+    item.bc_p = *bc_p;
+    *bc_p += end_offset;
+  }
+  else
+  {
+    item.bc_p = *bc_p;
+    *bc_p = re_find_group_end (nfa_p->flags, *bc_p);
+  }
+
+  const re_opcode_t end_opcode = re_get_opcode (bc_p);
+  re_get_value (bc_p);
+  re_get_value (bc_p);
+  const uint32_t qmax = re_get_value (bc_p) - RE_QMAX_OFFSET;
+
+  if (qmax <= 1)
+  {
+    /* Nested captures only need to be cleared between iterations. */
+    item.clear_count = 0;
+  }
+
+  const bool greedy = (end_opcode == RE_OP_GREEDY_CAPTURING_GROUP_END
+                       || end_opcode == RE_OP_GREEDY_NON_CAPTURING_GROUP_END);
+
+  return re_nfa_compile_quantified (nfa_p, &item, qmin, qmax, greedy);
+} /* re_nfa_compile_group */
+
+/**
+ * Emit a sequence of terms, which ends at the end of an alternative.
+ *
+ * @return true - if the sequence can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_terms (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+                      const uint8_t **bc_p) /**< [in, out] bytecode pointer */
+{
+  bool nullable = true;
+
+  while (!nfa_p->unsupported)
+  {
+    switch (**bc_p)
+    {
+      case RE_OP_EOF:
+      case RE_OP_ALTERNATIVE_NEXT:
+      case RE_OP_GREEDY_CAPTURING_GROUP_END:
+      case RE_OP_GREEDY_NON_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_NON_CAPTURING_GROUP_END:
+      {
+        return nullable;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        if (!re_nfa_compile_group (nfa_p, bc_p))
+        {
+          nullable = false;
+        }
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        const bool greedy = (re_get_opcode (bc_p) == RE_OP_GREEDY_ITERATOR);
+        const uint32_t qmin = re_get_value (bc_p);
+        const uint32_t qmax = re_get_value (bc_p) - RE_QMAX_OFFSET;
+        const uint32_t end_offset = re_get_value (bc_p);
+
+        re_nfa_item_t item;
+        item.bc_p = *bc_p;
+        item.capture_idx = 0;
+        item.clear_start = 0;
+        item.clear_count = 0;
+        item.is_group = false;
+
+        if (!re_nfa_compile_quantified (nfa_p, &item, qmin, qmax, greedy))
+        {
+          nullable = false;
+        }
+
+        *bc_p += end_offset;
+        break;
+      }
+      case RE_OP_ASSERT_LINE_START:
+      case RE_OP_ASSERT_LINE_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        re_nfa_emit (nfa_p, RE_NFA_ASSERT, 0, re_get_opcode (bc_p));
+        break;
+      }
+      case RE_OP_CLASS_ESCAPE:
+      case RE_OP_CHAR_CLASS:
+#if ENABLED (JERRY_ESNEXT)
+      case RE_OP_UNICODE_PERIOD:
+#endif /* ENABLED (JERRY_ESNEXT) */
+      case RE_OP_PERIOD:
+      case RE_OP_CHAR:
+      case RE_OP_BYTE:
+      {
+        re_nfa_emit (nfa_p, RE_NFA_CHAR, 0, (uint32_t) (*bc_p - nfa_p->bc_start_p));
+        *bc_p = re_skip_atom (nfa_p->flags, *bc_p);
+        nullable = false;
+        break;
+      }
+      default:
+      {
+        /* Backreferences and lookahead assertions are not supported. */
+        nfa_p->unsupported = true;
+        break;
+      }
+    }
+  }
+
+  return false;
+} /* re_nfa_compile_terms */
+
+/**
+ * Emit a disjunction, which ends at the end of its group or at the end of the pattern.
+ *
+ * @return true - if the disjunction can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_nfa_compile_alternatives (re_nfa_compiler_t *nfa_p, /**< NFA compiler context */
+                             const uint8_t **bc_p) /**< [in, out] bytecode pointer */
+{
+  if (**bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return re_nfa_compile_terms (nfa_p, bc_p);
+  }
 
-  for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
+  bool nullable = false;
+  uint32_t jump_chain = RE_NFA_NO_TARGET;
+
+  while (!nfa_p->unsupported)
   {
-    const re_compiled_code_t *cached_bytecode_p = cache_p[i];
+    JERRY_ASSERT (**bc_p == RE_OP_ALTERNATIVE_START || **bc_p == RE_OP_ALTERNATIVE_NEXT);
+    (*bc_p)++;
+
+    /* The offset points to the start of the next alternative, or to the end of the last one. */
+    const uint32_t offset = re_get_value (bc_p);
+    const bool has_next = ((*bc_p)[offset] == RE_OP_ALTERNATIVE_NEXT);
+    uint32_t split_idx = RE_NFA_NO_TARGET;
+
+    if (has_next)
+    {
+      split_idx = re_nfa_emit (nfa_p, RE_NFA_SPLIT_NEXT, 0, RE_NFA_NO_TARGET);
+    }
 
-    if (cached_bytecode_p == NULL)
+    if (re_nfa_compile_terms (nfa_p, bc_p))
+    {
+      nullable = true;
+    }
+
+    if (!has_next)
     {
       break;
     }
 
-    ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
-    cache_p[i] = NULL;
+    jump_chain = re_nfa_emit (nfa_p, RE_NFA_JUMP, 0, jump_chain);
+    re_nfa_patch_chain (nfa_p, split_idx, nfa_p->length);
   }
 
-  JERRY_CONTEXT (re_cache_idx) = 0;
-} /* re_cache_gc */
+  re_nfa_patch_chain (nfa_p, jump_chain, nfa_p->length);
+  return nullable;
+} /* re_nfa_compile_alternatives */
+
+/**
+ * Compile the RegExp bytecode to an NFA program.
+ *
+ * @return number of NFA instructions - if the pattern is supported
+ *         0 - otherwise
+ */
+static uint32_t
+re_nfa_compile (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                re_nfa_inst_t *program_p) /**< [out] NFA program */
+{
+  if (re_ctx_p->captures_count > RE_NFA_MAX_CAPTURES)
+  {
+    return 0;
+  }
+
+  re_nfa_compiler_t nfa;
+  nfa.bc_start_p = re_ctx_p->bytecode_start_p + sizeof (re_compiled_code_t);
+  nfa.program_p = program_p;
+  nfa.length = 0;
+  nfa.flags = re_ctx_p->flags;
+  nfa.unsupported = false;
+
+  const uint8_t *bc_p = nfa.bc_start_p;
+  re_nfa_compile_alternatives (&nfa, &bc_p);
+  re_nfa_emit (&nfa, RE_NFA_MATCH, 0, 0);
+
+  if (nfa.unsupported)
+  {
+    return 0;
+  }
+
+  JERRY_ASSERT (*bc_p == RE_OP_EOF);
+  return nfa.length;
+} /* re_nfa_compile */
+
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
+/**
+ * First byte of the cesu-8 representation of the non-ASCII characters
+ */
+#define RE_PREFILTER_NON_ASCII_START 0xc0
+
+/**
+ * Prefilter compiler context
+ */
+typedef struct
+{
+  uint8_t first_bytes[RE_PREFILTER_SIZE]; /**< set of the possible first bytes of a match */
+  uint16_t flags;                         /**< RegExp flags */
+  bool unsupported;                       /**< the first bytes of a match cannot be determined */
+} re_prefilter_compiler_t;
+
+static bool re_prefilter_alternatives (re_prefilter_compiler_t *prefilter_p, const uint8_t *bc_p);
+
+/**
+ * Add a range of bytes to the set of first bytes.
+ */
+static void
+re_prefilter_add_bytes (re_prefilter_compiler_t *prefilter_p, /**< prefilter compiler context */
+                        uint32_t begin, /**< first byte */
+                        uint32_t end) /**< last byte */
+{
+  for (uint32_t byte = begin; byte <= end; byte++)
+  {
+    prefilter_p->first_bytes[byte >> 3] = (uint8_t) (prefilter_p->first_bytes[byte >> 3] | (1u << (byte & 0x7)));
+  }
+} /* re_prefilter_add_bytes */
+
+/**
+ * Add the first bytes of a range of characters to the set of first bytes.
+ */
+static void
+re_prefilter_add_chars (re_prefilter_compiler_t *prefilter_p, /**< prefilter compiler context */
+                        lit_code_point_t begin, /**< first character */
+                        lit_code_point_t end) /**< last character */
+{
+  if (begin > end)
+  {
+    return;
+  }
+
+  if (prefilter_p->flags & RE_FLAG_IGNORE_CASE)
+  {
+    /* Characters are compared after canonicalization, and non-ASCII characters
+     * may have ASCII canonical forms, so only the ASCII letters are exact. */
+    for (lit_code_point_t ch = begin; ch <= end && ch <= LIT_UTF8_1_BYTE_CODE_POINT_MAX; ch++)
+    {
+      re_prefilter_add_bytes (prefilter_p, ch, ch);
+
+      if ((ch >= LIT_CHAR_ASCII_UPPERCASE_LETTERS_BEGIN && ch <= LIT_CHAR_ASCII_UPPERCASE_LETTERS_END)
+          || (ch >= LIT_CHAR_ASCII_LOWERCASE_LETTERS_BEGIN && ch <= LIT_CHAR_ASCII_LOWERCASE_LETTERS_END))
+      {
+        re_prefilter_add_bytes (prefilter_p, ch ^ 0x20, ch ^ 0x20);
+      }
+    }
+
+    re_prefilter_add_bytes (prefilter_p, RE_PREFILTER_NON_ASCII_START, UINT8_MAX);
+    return;
+  }
+
+  if (begin <= LIT_UTF8_1_BYTE_CODE_POINT_MAX)
+  {
+    re_prefilter_add_bytes (prefilter_p, begin, JERRY_MIN (end, LIT_UTF8_1_BYTE_CODE_POINT_MAX));
+    begin = LIT_UTF8_1_BYTE_CODE_POINT_MAX + 1;
+  }
+
+  if (begin > end)
+  {
+    return;
+  }
+
+  /* The first byte of a cesu-8 sequence grows with the encoded code unit, and
+   * code points above the BMP are encoded as surrogate pairs. */
+  lit_utf8_byte_t begin_bytes[LIT_CESU8_MAX_BYTES_IN_CODE_POINT];
+  lit_utf8_byte_t end_bytes[LIT_CESU8_MAX_BYTES_IN_CODE_POINT];
+  lit_code_point_to_cesu8 (begin, begin_bytes);
+  lit_code_point_to_cesu8 (end, end_bytes);
+
+  if (begin > LIT_UTF16_CODE_UNIT_MAX)
+  {
+    re_prefilter_add_bytes (prefilter_p, begin_bytes[0], begin_bytes[0]);
+    return;
+  }
+
+  if (end > LIT_UTF16_CODE_UNIT_MAX)
+  {
+    lit_code_point_to_cesu8 (LIT_UTF16_CODE_UNIT_MAX, end_bytes);
+    re_prefilter_add_bytes (prefilter_p, LIT_UTF8_3_BYTE_MARKER | 0xd, LIT_UTF8_3_BYTE_MARKER | 0xd);
+  }
+
+  re_prefilter_add_bytes (prefilter_p, begin_bytes[0], end_bytes[0]);
+} /* re_prefilter_add_chars */
+
+/**
+ * Add the first bytes of the characters matched by a class escape to the set of first bytes.
+ */
+static void
+re_prefilter_add_class_escape (re_prefilter_compiler_t *prefilter_p, /**< prefilter compiler context */
+                               ecma_class_escape_t escape) /**< class escape */
+{
+  switch (escape)
+  {
+    case RE_ESCAPE_DIGIT:
+    {
+      re_prefilter_add_chars (prefilter_p, LIT_CHAR_0, LIT_CHAR_9);
+      break;
+    }
+    case RE_ESCAPE_WORD_CHAR:
+    {
+      re_prefilter_add_chars (prefilter_p, LIT_CHAR_0, LIT_CHAR_9);
+      re_prefilter_add_chars (prefilter_p, LIT_CHAR_UPPERCASE_A, LIT_CHAR_UPPERCASE_Z);
+      re_prefilter_add_chars (prefilter_p, LIT_CHAR_LOWERCASE_A, LIT_CHAR_LOWERCASE_Z);
+      re_prefilter_add_chars (prefilter_p, LIT_CHAR_UNDERSCORE, LIT_CHAR_UNDERSCORE);
+      break;
+    }
+    case RE_ESCAPE_WHITESPACE:
+    {
+      re_prefilter_add_bytes (prefilter_p, LIT_CHAR_TAB, LIT_CHAR_CR);
+      re_prefilter_add_bytes (prefilter_p, LIT_CHAR_SP, LIT_CHAR_SP);
+      re_prefilter_add_bytes (prefilter_p, RE_PREFILTER_NON_ASCII_START, UINT8_MAX);
+      break;
+    }
+    default:
+    {
+      re_prefilter_add_bytes (prefilter_p, 0, LIT_UTF8_1_BYTE_CODE_POINT_MAX);
+      re_prefilter_add_bytes (prefilter_p, RE_PREFILTER_NON_ASCII_START, UINT8_MAX);
+      break;
+    }
+  }
+} /* re_prefilter_add_class_escape */
+
+/**
+ * Add the first bytes of the characters matched by a character atom to the set of first bytes.
+ */
+static void
+re_prefilter_add_atom (re_prefilter_compiler_t *prefilter_p, /**< prefilter compiler context */
+                       const uint8_t *bc_p) /**< atom bytecode */
+{
+  const bool unicode = (prefilter_p->flags & RE_FLAG_UNICODE) != 0;
+
+  switch (re_get_opcode (&bc_p))
+  {
+    case RE_OP_BYTE:
+    {
+      const uint8_t byte = re_get_byte (&bc_p);
+      re_prefilter_add_bytes (prefilter_p, byte, byte);
+      break;
+    }
+    case RE_OP_CHAR:
+    {
+      const lit_code_point_t ch = re_get_char (&bc_p, unicode);
+      re_prefilter_add_chars (prefilter_p, ch, ch);
+      break;
+    }
+    case RE_OP_CLASS_ESCAPE:
+    {
+      re_prefilter_add_class_escape (prefilter_p, (ecma_class_escape_t) re_get_byte (&bc_p));
+      break;
+    }
+    case RE_OP_CHAR_CLASS:
+    {
+      const uint8_t class_flags = re_get_byte (&bc_p);
+      uint32_t char_count = (class_flags & RE_CLASS_HAS_CHARS) ? re_get_value (&bc_p) : 0;
+      uint32_t range_count = (class_flags & RE_CLASS_HAS_RANGES) ? re_get_value (&bc_p) : 0;
+
+      if (class_flags & RE_CLASS_INVERT)
+      {
+        prefilter_p->unsupported = true;
+        break;
+      }
+
+      for (uint32_t i = 0; i < (class_flags & RE_CLASS_ESCAPE_COUNT_MASK); i++)
+      {
+        re_prefilter_add_class_escape (prefilter_p, (ecma_class_escape_t) re_get_byte (&bc_p));
+      }
+
+      while (char_count-- > 0)
+      {
+        const lit_code_point_t ch = re_get_char (&bc_p, unicode);
+        re_prefilter_add_chars (prefilter_p, ch, ch);
+      }
+
+      while (range_count-- > 0)
+      {
+        const lit_code_point_t begin = re_get_char (&bc_p, unicode);
+        const lit_code_point_t end = re_get_char (&bc_p, unicode);
+        re_prefilter_add_chars (prefilter_p, begin, end);
+      }
+      break;
+    }
+    default:
+    {
+      /* Periods match almost every character. */
+      prefilter_p->unsupported = true;
+      break;
+    }
+  }
+} /* re_prefilter_add_atom */
+
+/**
+ * Add the first bytes of the matches of a sequence of terms to the set of first bytes.
+ *
+ * @return true - if the sequence can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_prefilter_terms (re_prefilter_compiler_t *prefilter_p, /**< prefilter compiler context */
+                    const uint8_t *bc_p) /**< bytecode of the terms */
+{
+  while (!prefilter_p->unsupported)
+  {
+    const uint8_t *op_p = bc_p;
+
+    switch (re_get_opcode (&bc_p))
+    {
+      case RE_OP_EOF:
+      case RE_OP_ALTERNATIVE_NEXT:
+      case RE_OP_GREEDY_CAPTURING_GROUP_END:
+      case RE_OP_GREEDY_NON_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_CAPTURING_GROUP_END:
+      case RE_OP_LAZY_NON_CAPTURING_GROUP_END:
+      {
+        return true;
+      }
+      case RE_OP_NO_ALTERNATIVE:
+      {
+        return false;
+      }
+      case RE_OP_CAPTURING_GROUP_START:
+      case RE_OP_NON_CAPTURING_GROUP_START:
+      {
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+
+        if (*op_p == RE_OP_NON_CAPTURING_GROUP_START)
+        {
+          re_get_value (&bc_p);
+        }
+
+        const uint32_t qmin = re_get_value (&bc_p);
+        const uint8_t *end_p;
+
+        if (qmin == 0)
+        {
+          const uint32_t end_offset = re_get_value (&bc_p);
+          end_p = bc_p + end_offset;
+        }
+        else
+        {
+          end_p = re_find_group_end (prefilter_p->flags, bc_p);
+        }
+
+        if (!re_prefilter_alternatives (prefilter_p, bc_p) && qmin > 0)
+        {
+          return false;
+        }
+
+        bc_p = end_p;
+        re_get_opcode (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        break;
+      }
+      case RE_OP_GREEDY_ITERATOR:
+      case RE_OP_LAZY_ITERATOR:
+      {
+        const uint32_t qmin = re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        const uint32_t end_offset = re_get_value (&bc_p);
+
+        re_prefilter_add_atom (prefilter_p, bc_p);
+
+        if (qmin > 0)
+        {
+          return false;
+        }
+
+        bc_p += end_offset;
+        break;
+      }
+      case RE_OP_ASSERT_LINE_START:
+      case RE_OP_ASSERT_LINE_END:
+      case RE_OP_ASSERT_WORD_BOUNDARY:
+      case RE_OP_ASSERT_NOT_WORD_BOUNDARY:
+      {
+        break;
+      }
+      case RE_OP_ASSERT_LOOKAHEAD_POS:
+      case RE_OP_ASSERT_LOOKAHEAD_NEG:
+      {
+        /* Lookahead assertions do not consume characters. */
+        re_get_byte (&bc_p);
+        re_get_value (&bc_p);
+        re_get_value (&bc_p);
+        const uint32_t end_offset = re_get_value (&bc_p);
+        bc_p += end_offset;
+        break;
+      }
+      case RE_OP_BACKREFERENCE:
+      {
+        prefilter_p->unsupported = true;
+        break;
+      }
+      default:
+      {
+        re_prefilter_add_atom (prefilter_p, op_p);
+        return false;
+      }
+    }
+  }
+
+  return true;
+} /* re_prefilter_terms */
+
+/**
+ * Add the first bytes of the matches of a disjunction to the set of first bytes.
+ *
+ * @return true - if the disjunction can match the empty string
+ *         false - otherwise
+ */
+static bool
+re_prefilter_alternatives (re_prefilter_compiler_t *prefilter_p, /**< prefilter compiler context */
+                           const uint8_t *bc_p) /**< bytecode of the disjunction */
+{
+  if (*bc_p != RE_OP_ALTERNATIVE_START)
+  {
+    return re_prefilter_terms (prefilter_p, bc_p);
+  }
+
+  bool nullable = false;
+
+  do
+  {
+    bc_p++;
+    const uint32_t offset = re_get_value (&bc_p);
+
+    if (re_prefilter_terms (prefilter_p, bc_p))
+    {
+      nullable = true;
+    }
+
+    bc_p += offset;
+  }
+  while (*bc_p == RE_OP_ALTERNATIVE_NEXT && !prefilter_p->unsupported);
+
+  return nullable;
+} /* re_prefilter_alternatives */
+
+/**
+ * Compute the prefilter of a RegExp, which is used by the matcher to skip the positions
+ * of the input where the pattern cannot match without running the bytecode.
+ *
+ * The prefilter is a literal prefix, which is required by all matches, or the set of the
+ * possible first bytes of the matches. A set with a single byte is stored as a prefix.
+ *
+ * @return size of the prefilter data - if the pattern has a prefilter
+ *         0 - otherwise
+ */
+static uint32_t
+re_compile_prefilter (re_compiler_ctx_t *re_ctx_p, /**< RegExp compiler context */
+                      uint8_t *data_p, /**< [out] prefilter data */
+                      uint32_t *prefix_size_p) /**< [out] size of the literal prefix */
+{
+  const uint8_t *const bc_start_p = re_ctx_p->bytecode_start_p + sizeof (re_compiled_code_t);
+  const bool unicode = (re_ctx_p->flags & RE_FLAG_UNICODE) != 0;
+  uint32_t prefix_size = 0;
+
+  if (!(re_ctx_p->flags & RE_FLAG_IGNORE_CASE))
+  {
+    const uint8_t *bc_p = bc_start_p;
+
+    while (true)
+    {
+      const re_opcode_t op = re_get_opcode (&bc_p);
+      lit_utf8_byte_t char_bytes[LIT_CESU8_MAX_BYTES_IN_CODE_POINT];
+      lit_utf8_size_t char_size;
+
+      if (op == RE_OP_BYTE)
+      {
+        char_bytes[0] = re_get_byte (&bc_p);
+        char_size = 1;
+      }
+      else if (op == RE_OP_CHAR)
+      {
+        char_size = lit_code_point_to_cesu8 (re_get_char (&bc_p, unicode), char_bytes);
+      }
+      else if (op == RE_OP_ASSERT_LINE_START
+               || op == RE_OP_ASSERT_LINE_END
+               || op == RE_OP_ASSERT_WORD_BOUNDARY
+               || op == RE_OP_ASSERT_NOT_WORD_BOUNDARY)
+      {
+        /* Assertions do not consume characters. */
+        continue;
+      }
+      else
+      {
+        break;
+      }
+
+      if (prefix_size + char_size > RE_PREFILTER_SIZE)
+      {
+        break;
+      }
+
+      memcpy (data_p + prefix_size, char_bytes, char_size);
+      prefix_size += char_size;
+    }
+  }
+
+  if (prefix_size <= 1)
+  {
+    re_prefilter_compiler_t prefilter;
+    memset (prefilter.first_bytes, 0, RE_PREFILTER_SIZE);
+    prefilter.flags = re_ctx_p->flags;
+    prefilter.unsupported = false;
+
+    if (re_prefilter_alternatives (&prefilter, bc_start_p) || prefilter.unsupported)
+    {
+      return 0;
+    }
+
+    uint32_t byte_count = 0;
+    uint32_t last_byte = 0;
+
+    for (uint32_t byte = 0; byte <= UINT8_MAX; byte++)
+    {
+      if (prefilter.first_bytes[byte >> 3] & (1u << (byte & 0x7)))
+      {
+        byte_count++;
+        last_byte = byte;
+      }
+    }
+
+    if (byte_count == 1)
+    {
+      data_p[0] = (uint8_t) last_byte;
+      prefix_size = 1;
+    }
+    else
+    {
+      memcpy (data_p, prefilter.first_bytes, RE_PREFILTER_SIZE);
+      prefix_size = 0;
+    }
+  }
+
+  /* Surrogate pairs are matched as single characters in unicode mode, so the matcher
+   * must not start between the halves of a pair, which begin with the same byte. */
+  const uint8_t surrogate_byte = LIT_UTF8_3_BYTE_MARKER | 0xd;
+
+  if (unicode
+      && (prefix_size > 0 ? data_p[0] == surrogate_byte
+                          : (data_p[surrogate_byte >> 3] & (1u << (surrogate_byte & 0x7))) != 0))
+  {
+    return 0;
+  }
+
+  *prefix_size_p = prefix_size;
+  return prefix_size > 0 ? prefix_size : RE_PREFILTER_SIZE;
+} /* re_compile_prefilter */
 
 /**
  * Compilation of RegExp bytecode
@@ -139,12 +1294,64 @@ re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
     return NULL;
   }
 
+#if ENABLED (JERRY_REGEXP_NFA)
+  /* The NFA program is stored after the RegExp bytecode. */
+  re_nfa_inst_t *nfa_program_p = jmem_heap_alloc_block (RE_NFA_MAX_LENGTH * sizeof (re_nfa_inst_t));
+  uint32_t nfa_length = re_nfa_compile (&re_ctx, nfa_program_p);
+  const uint32_t nfa_offset = JERRY_ALIGNUP ((uint32_t) re_ctx.bytecode_size, (uint32_t) sizeof (re_nfa_inst_t));
+
+  if (nfa_offset + nfa_length * sizeof (re_nfa_inst_t) > UINT16_MAX)
+  {
+    nfa_length = 0;
+  }
+
+  uint32_t code_size = (uint32_t) (nfa_length > 0 ? nfa_offset + nfa_length * sizeof (re_nfa_inst_t)
+                                                   : re_ctx.bytecode_size);
+#else /* !ENABLED (JERRY_REGEXP_NFA) */
+  uint32_t code_size = (uint32_t) re_ctx.bytecode_size;
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
+  /* The prefilter data is stored after the RegExp bytecode and the NFA program. */
+  uint8_t prefilter_data[RE_PREFILTER_SIZE];
+  uint32_t prefix_size = 0;
+  uint32_t prefilter_size = re_compile_prefilter (&re_ctx, prefilter_data, &prefix_size);
+  const uint32_t prefilter_offset = code_size;
+
+  if (prefilter_offset + prefilter_size > UINT16_MAX)
+  {
+    prefilter_size = 0;
+  }
+
+  code_size += prefilter_size;
+
   /* Align bytecode size to JMEM_ALIGNMENT so that it can be stored in the bytecode header. */
-  const uint32_t final_size = JERRY_ALIGNUP (re_ctx.bytecode_size, JMEM_ALIGNMENT);
+  const uint32_t final_size = JERRY_ALIGNUP (code_size, JMEM_ALIGNMENT);
   re_compiled_code_t *re_compiled_code_p = (re_compiled_code_t *) jmem_heap_realloc_block (re_ctx.bytecode_start_p,
                                                                                            re_ctx.bytecode_size,
                                                                                            final_size);
 
+#if ENABLED (JERRY_REGEXP_NFA)
+  re_compiled_code_p->nfa_offset = 0;
+  re_compiled_code_p->nfa_length = (uint16_t) nfa_length;
+
+  if (nfa_length > 0)
+  {
+    re_compiled_code_p->nfa_offset = (uint16_t) nfa_offset;
+    memcpy ((uint8_t *) re_compiled_code_p + nfa_offset, nfa_program_p, nfa_length * sizeof (re_nfa_inst_t));
+  }
+
+  jmem_heap_free_block (nfa_program_p, RE_NFA_MAX_LENGTH * sizeof (re_nfa_inst_t));
+#endif /* ENABLED (JERRY_REGEXP_NFA) */
+
+  re_compiled_code_p->prefilter_offset = 0;
+  re_compiled_code_p->prefix_size = (uint16_t) prefix_size;
+
+  if (prefilter_size > 0)
+  {
+    re_compiled_code_p->prefilter_offset = (uint16_t) prefilter_offset;
+    memcpy ((uint8_t *) re_compiled_code_p + prefilter_offset, prefilter_data, prefilter_size);
+  }
+
   /* Bytecoded will be inserted into the cache and returned to the caller, so refcount is implicitly set to 2. */
   re_compiled_code_p->header.refs = 2;
   re_compiled_code_p->header.size = (uint16_t) (final_size >> JMEM_ALIGNMENT_LOG);
@@ -162,15 +1369,7 @@ re_compile_bytecode (ecma_string_t *pattern_str_p, /**< pattern */
   }
 #endif /* ENABLED (JERRY_REGEXP_DUMP_BYTE_CODE) */
 
-  uint8_t cache_idx = JERRY_CONTEXT (re_cache_idx);
-
-  if (JERRY_CONTEXT (re_cache)[cache_idx] != NULL)
-  {
-    ecma_bytecode_deref ((ecma_compiled_code_t *) JERRY_CONTEXT (re_cache)[cache_idx]);
-  }
-
-  JERRY_CONTEXT (re_cache)[cache_idx] = re_compiled_code_p;
-  JERRY_CONTEXT (re_cache_idx) = (uint8_t) (cache_idx + 1) % RE_CACHE_SIZE;
+  re_cache_insert (pattern_str_p, re_compiled_code_p);
 
   return re_compiled_code_p;
 } /* re_compile_bytecode */
@@ -35,6 +35,10 @@ re_compiled_code_t *
 re_compile_bytecode (ecma_string_t *pattern_str_p, uint16_t flags);
 
 void re_cache_gc (void);
+void re_cache_free (void);
+#if ENABLED (JERRY_MEM_STATS)
+void re_cache_stats_print (void);
+#endif /* ENABLED (JERRY_MEM_STATS) */
 
 /**
  * @}
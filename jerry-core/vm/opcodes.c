@@ -155,7 +155,7 @@ opfunc_set_data_property (ecma_object_t *object_p, /**< object */
 
       ECMA_CHANGE_PROPERTY_TYPE (property_p);
       *property_p = (uint8_t) (*property_p | ECMA_PROPERTY_CONFIGURABLE_ENUMERABLE_WRITABLE);
-      prop_value_p->value = ecma_copy_value_if_not_object (value);
+      prop_value_p->value = ecma_copy_value_if_not_object_into (object_p, value);
       return;
     }
   }
@@ -223,6 +223,10 @@ opfunc_set_accessor (bool is_getter, /**< is getter accessor */
       ECMA_SET_POINTER (prop_value_p->getter_setter_pair.getter_cp, getter_func_p);
       ECMA_SET_POINTER (prop_value_p->getter_setter_pair.setter_cp, setter_func_p);
 #endif /* ENABLED (JERRY_CPOINTER_32_BIT) */
+
+#if ENABLED (JERRY_GENERATIONAL_GC)
+      ecma_gc_remember_object (object_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
       return;
     }
 
@@ -588,6 +592,10 @@ opfunc_append_array (ecma_value_t *stack_top_p, /**< current stack top */
 
     ext_array_obj_p->u.array.u.hole_count -= filled_holes * ECMA_FAST_ARRAY_HOLE_ONE;
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+    ecma_gc_remember_object (array_obj_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
     if (JERRY_UNLIKELY ((values_length - filled_holes) > ECMA_FAST_ARRAY_MAX_NEW_HOLES_COUNT))
     {
       ecma_fast_array_convert_to_normal (array_obj_p);
@@ -863,6 +871,11 @@ opfunc_resume_executable_object (vm_executable_object_t *executable_object_p, /*
 
   ecma_deref_if_object (executable_object_p->frame_ctx.block_result);
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  /* The suspended frame keeps the values stored by the execution. */
+  ecma_gc_remember_object ((ecma_object_t *) executable_object_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   return result;
 } /* opfunc_resume_executable_object */
 
@@ -1016,6 +1029,9 @@ ecma_op_implicit_constructor_handler_heritage_cb (const ecma_value_t function_ob
     {
       ECMA_SET_POINTER (ecma_get_object_from_value (result)->u2.prototype_cp,
                         ecma_get_object_from_value (proto_value));
+#if ENABLED (JERRY_GENERATIONAL_GC)
+      ecma_gc_remember_object (ecma_get_object_from_value (result));
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
     }
     ecma_free_value (proto_value);
   }
@@ -1183,6 +1199,10 @@ opfunc_init_class (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
 
   ECMA_SET_POINTER (ctor_p->u2.prototype_cp, ctor_parent_p);
 
+#if ENABLED (JERRY_GENERATIONAL_GC)
+  ecma_gc_remember_object (ctor_p);
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
+
   if (free_proto_parent)
   {
     ecma_deref_object (proto_parent_p);
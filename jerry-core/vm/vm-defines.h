@@ -58,6 +58,96 @@ typedef struct vm_frame_ctx_t
   /* Registers start immediately after the frame context. */
 } vm_frame_ctx_t;
 
+#if (JERRY_VM_STACK_SEGMENT_SIZE != 0)
+
+/**
+ * Size of a frame stack segment in bytes
+ */
+#define VM_STACK_SEGMENT_SIZE ((size_t) (JERRY_VM_STACK_SEGMENT_SIZE * 1024))
+
+/**
+ * Header of a frame stack segment, the frames are allocated after the header
+ */
+typedef struct vm_stack_segment_t
+{
+  struct vm_stack_segment_t *prev_p; /**< previous segment */
+  uint8_t *prev_top_p; /**< top of the previous segment when this segment was pushed */
+  size_t size; /**< size of the segment including the header */
+} vm_stack_segment_t;
+
+#endif /* (JERRY_VM_STACK_SEGMENT_SIZE != 0) */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+
+/**
+ * Number of entries in the inline cache table (must be a power of 2)
+ */
+#define VM_INLINE_CACHE_SIZE 128
+
+/**
+ * Number of property positions remembered by an inline cache entry
+ */
+#define VM_INLINE_CACHE_WAYS 2
+
+/**
+ * Inline cache entry of a property access site
+ */
+typedef struct
+{
+  const uint8_t *site_p; /**< byte code of the property access */
+  uint8_t positions[VM_INLINE_CACHE_WAYS]; /**< positions of the property in the property list of the
+                                            *   recently accessed objects (most recent first, 0 if unused) */
+} vm_inline_cache_entry_t;
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+
+/**
+ * Number of entries in the scope cache table (must be a power of 2)
+ */
+#define VM_SCOPE_CACHE_SIZE 128
+
+/**
+ * Scope cache entry of an identifier access site
+ */
+typedef struct
+{
+  const uint8_t *site_p; /**< byte code of the identifier access */
+  ecma_value_t name; /**< name of the identifier */
+  uint32_t epoch; /**< value of the environment free counter when lex_env_cp was stored */
+  jmem_cpointer_t lex_env_cp; /**< lexical environment of the last found binding */
+  jmem_cpointer_t pair_cp; /**< property pair of the last found binding */
+  uint8_t depth; /**< number of lexical environments skipped before the binding is found */
+  uint8_t position; /**< position of the binding in the property list of the lexical environment
+                     *   (0 if the identifier is not bound by the skipped declarative environments) */
+} vm_scope_cache_entry_t;
+
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+
+/**
+ * Number of opcodes counted by the opcode statistics (extended opcodes follow the normal ones)
+ */
+#define VM_OPCODE_STATS_OPCODE_COUNT (CBC_END + 1 + CBC_EXT_END)
+
+/**
+ * Number of entries in the opcode sequence counter table (must be a power of 2)
+ */
+#define VM_OPCODE_STATS_TABLE_SIZE 4096
+
+/**
+ * Counter of an opcode pair or triple
+ */
+typedef struct
+{
+  uint32_t key; /**< encoded opcode sequence, 0 if the entry is unused */
+  uint32_t count; /**< number of executions of the sequence */
+} vm_opcode_stats_entry_t;
+
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
 /**
  * Get register list corresponding to the frame context.
  */
@@ -0,0 +1,206 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "jcontext.h"
+#include "vm-defines.h"
+#include "vm-inline-cache.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_inline_cache Inline caches of property access sites
+ * @{
+ */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+
+/**
+ * Compute the index of the inline cache entry of a property access site
+ */
+#define VM_INLINE_CACHE_INDEX(site_p) \
+  ((((uintptr_t) (site_p)) ^ (((uintptr_t) (site_p)) >> 7)) & (VM_INLINE_CACHE_SIZE - 1))
+
+/**
+ * Maximum number of property pairs which can be skipped by a cached position
+ */
+#define VM_INLINE_CACHE_MAX_PAIRS (UINT8_MAX / ECMA_PROPERTY_PAIR_ITEM_COUNT)
+
+/**
+ * Checks whether a property slot of a property pair has the given name
+ *
+ * @return true - if the slot contains a named property with the given name
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_inline_cache_is_name_matching (ecma_property_header_t *prop_iter_p, /**< property pair */
+                                  uint32_t slot, /**< slot index in the property pair */
+                                  ecma_property_t name_type, /**< name type of the property name */
+                                  jmem_cpointer_t name_cp, /**< compressed property name */
+                                  ecma_string_t *name_p) /**< property name */
+{
+  ecma_property_t property = prop_iter_p->types[slot];
+
+  if (!ECMA_PROPERTY_IS_NAMED_PROPERTY (property)
+      || ECMA_PROPERTY_GET_NAME_TYPE (property) != name_type)
+  {
+    return false;
+  }
+
+  jmem_cpointer_t property_name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[slot];
+
+  if (property_name_cp == name_cp)
+  {
+    return true;
+  }
+
+  return (name_type == ECMA_DIRECT_STRING_PTR
+          && ecma_compare_ecma_non_direct_strings (name_p,
+                                                   ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_name_cp)));
+} /* vm_inline_cache_is_name_matching */
+
+/**
+ * Find an own property of an object using the inline cache of a property access site
+ *
+ * The cache remembers the positions of the property in the property lists of the objects recently
+ * accessed by the site. Objects created by the same literal or constructor have the same property
+ * layout, so a single position check is usually enough to find the property. Otherwise the property
+ * list is searched, and the position of the property is remembered for the next access.
+ *
+ * Note:
+ *      only general objects without lazy instantiated (built-in) properties can be passed to this
+ *      function, since their own properties are always stored in their property list
+ *
+ * @return true - if the own properties of the object are searched: property_p is set to the
+ *                property, or to NULL if the object has no such own property
+ *         false - if the object cannot be handled by the inline cache (e.g. it has a property hashmap)
+ */
+bool
+vm_inline_cache_find (const uint8_t *site_p, /**< byte code of the property access */
+                      ecma_object_t *object_p, /**< object */
+                      ecma_string_t *name_p, /**< property name */
+                      ecma_property_t **property_p) /**< [out] found property */
+{
+  JERRY_ASSERT (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL);
+  JERRY_ASSERT (!ecma_get_object_is_builtin (object_p));
+
+  jmem_cpointer_t prop_iter_cp = object_p->u1.property_list_cp;
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    *property_p = NULL;
+    return true;
+  }
+
+  ecma_property_header_t *prop_list_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (prop_list_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+  {
+    return false;
+  }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+
+  ecma_property_t name_type = ECMA_DIRECT_STRING_PTR;
+  jmem_cpointer_t name_cp;
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    name_type = (ecma_property_t) ECMA_GET_DIRECT_STRING_TYPE (name_p);
+    name_cp = (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p);
+  }
+  else
+  {
+    ECMA_SET_NON_NULL_POINTER (name_cp, name_p);
+  }
+
+  vm_inline_cache_entry_t *entry_p = JERRY_CONTEXT (vm_inline_cache) + VM_INLINE_CACHE_INDEX (site_p);
+
+  if (entry_p->site_p == site_p)
+  {
+    for (uint32_t way = 0; way < VM_INLINE_CACHE_WAYS && entry_p->positions[way] != 0; way++)
+    {
+      uint32_t position = (uint32_t) entry_p->positions[way] - 1;
+      uint32_t pair_index = position / ECMA_PROPERTY_PAIR_ITEM_COUNT;
+      uint32_t slot = position % ECMA_PROPERTY_PAIR_ITEM_COUNT;
+      ecma_property_header_t *prop_iter_p = prop_list_p;
+
+      while (pair_index > 0 && prop_iter_p->next_property_cp != JMEM_CP_NULL)
+      {
+        prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+        pair_index--;
+      }
+
+      if (pair_index == 0
+          && vm_inline_cache_is_name_matching (prop_iter_p, slot, name_type, name_cp, name_p))
+      {
+        if (way > 0)
+        {
+          /* Move the position to the front. */
+          uint8_t found_position = entry_p->positions[way];
+          entry_p->positions[way] = entry_p->positions[0];
+          entry_p->positions[0] = found_position;
+        }
+
+        *property_p = prop_iter_p->types + slot;
+        return true;
+      }
+    }
+  }
+  else
+  {
+    entry_p->site_p = site_p;
+    memset (entry_p->positions, 0, sizeof (entry_p->positions));
+  }
+
+  ecma_property_header_t *prop_iter_p = prop_list_p;
+  uint32_t pair_index = 0;
+
+  while (true)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (uint32_t slot = 0; slot < ECMA_PROPERTY_PAIR_ITEM_COUNT; slot++)
+    {
+      if (vm_inline_cache_is_name_matching (prop_iter_p, slot, name_type, name_cp, name_p))
+      {
+        if (pair_index < VM_INLINE_CACHE_MAX_PAIRS)
+        {
+          memmove (entry_p->positions + 1, entry_p->positions, VM_INLINE_CACHE_WAYS - 1);
+          entry_p->positions[0] = (uint8_t) (pair_index * ECMA_PROPERTY_PAIR_ITEM_COUNT + slot + 1);
+        }
+
+        *property_p = prop_iter_p->types + slot;
+        return true;
+      }
+    }
+
+    if (prop_iter_p->next_property_cp == JMEM_CP_NULL)
+    {
+      *property_p = NULL;
+      return true;
+    }
+
+    prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+    pair_index++;
+  }
+} /* vm_inline_cache_find */
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,40 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_INLINE_CACHE_H
+#define VM_INLINE_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_inline_cache Inline caches of property access sites
+ * @{
+ */
+
+#if ENABLED (JERRY_INLINE_CACHE)
+
+bool vm_inline_cache_find (const uint8_t *site_p, ecma_object_t *object_p, ecma_string_t *name_p,
+                           ecma_property_t **property_p);
+
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_INLINE_CACHE_H */
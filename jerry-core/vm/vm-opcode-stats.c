@@ -0,0 +1,265 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jcontext.h"
+#include "vm-defines.h"
+#include "vm-opcode-stats.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_opcode_stats Opcode sequence statistics
+ * @{
+ */
+
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+
+/**
+ * Number of bits used by an opcode in the opcode history
+ */
+#define VM_OPCODE_STATS_ID_BITS 9
+
+/**
+ * Mask of an opcode in the opcode history
+ */
+#define VM_OPCODE_STATS_ID_MASK ((1u << VM_OPCODE_STATS_ID_BITS) - 1)
+
+/**
+ * Mask of the last two opcodes in the opcode history
+ */
+#define VM_OPCODE_STATS_PAIR_MASK ((1u << (2 * VM_OPCODE_STATS_ID_BITS)) - 1)
+
+/**
+ * Mask of the last three opcodes in the opcode history
+ */
+#define VM_OPCODE_STATS_TRIPLE_MASK ((1u << (3 * VM_OPCODE_STATS_ID_BITS)) - 1)
+
+/**
+ * This flag distinguishes the keys of opcode pairs from the keys of opcode triples
+ */
+#define VM_OPCODE_STATS_PAIR_FLAG (1u << (3 * VM_OPCODE_STATS_ID_BITS))
+
+/**
+ * Maximum number of entries checked when a sequence is searched in the counter table
+ */
+#define VM_OPCODE_STATS_MAX_PROBES 8
+
+/**
+ * Number of opcodes and sequences printed by vm_opcode_stats_print
+ */
+#define VM_OPCODE_STATS_PRINT_LIMIT 64
+
+JERRY_STATIC_ASSERT (VM_OPCODE_STATS_OPCODE_COUNT < VM_OPCODE_STATS_ID_MASK,
+                     opcodes_must_fit_into_the_bits_of_the_opcode_history);
+
+JERRY_STATIC_ASSERT ((VM_OPCODE_STATS_TABLE_SIZE & (VM_OPCODE_STATS_TABLE_SIZE - 1)) == 0,
+                     vm_opcode_stats_table_size_must_be_a_power_of_2);
+
+/**
+ * Increase the counter of an opcode sequence
+ */
+static void
+vm_opcode_stats_count_sequence (uint32_t key) /**< encoded opcode sequence */
+{
+  vm_opcode_stats_entry_t *table_p = JERRY_CONTEXT (vm_opcode_sequences);
+  uint32_t index = (key * 2654435761u) >> 16;
+
+  for (uint32_t i = 0; i < VM_OPCODE_STATS_MAX_PROBES; i++)
+  {
+    vm_opcode_stats_entry_t *entry_p = table_p + ((index + i) & (VM_OPCODE_STATS_TABLE_SIZE - 1));
+
+    if (entry_p->key == key)
+    {
+      entry_p->count++;
+      return;
+    }
+
+    if (entry_p->key == 0)
+    {
+      entry_p->key = key;
+      entry_p->count = 1;
+      return;
+    }
+  }
+
+  JERRY_CONTEXT (vm_opcode_sequences_dropped)++;
+} /* vm_opcode_stats_count_sequence */
+
+/**
+ * Count an executed opcode together with the pair and triple it closes.
+ *
+ * The history holds the last three opcodes executed by the current invocation
+ * of vm_loop, a zero history starts a new sequence.
+ *
+ * @return updated opcode history
+ */
+uint32_t
+vm_opcode_stats_record (uint32_t history, /**< opcode history */
+                        uint32_t opcode_id) /**< opcode (extended opcodes follow the normal ones) */
+{
+  JERRY_ASSERT (opcode_id < VM_OPCODE_STATS_OPCODE_COUNT);
+
+  JERRY_CONTEXT (vm_opcode_counts)[opcode_id]++;
+
+  history = ((history << VM_OPCODE_STATS_ID_BITS) | (opcode_id + 1)) & VM_OPCODE_STATS_TRIPLE_MASK;
+
+  if (history > VM_OPCODE_STATS_ID_MASK)
+  {
+    vm_opcode_stats_count_sequence (VM_OPCODE_STATS_PAIR_FLAG | (history & VM_OPCODE_STATS_PAIR_MASK));
+
+    if (history > VM_OPCODE_STATS_PAIR_MASK)
+    {
+      vm_opcode_stats_count_sequence (history);
+    }
+  }
+
+  return history;
+} /* vm_opcode_stats_record */
+
+/**
+ * Get the name of an opcode
+ *
+ * @return opcode name
+ */
+static const char *
+vm_opcode_stats_get_name (uint32_t opcode_id) /**< opcode (extended opcodes follow the normal ones) */
+{
+  if (opcode_id <= CBC_END)
+  {
+    return cbc_names[opcode_id];
+  }
+
+  return cbc_ext_names[opcode_id - (CBC_END + 1)];
+} /* vm_opcode_stats_get_name */
+
+/**
+ * Print the most frequent opcode pairs or triples
+ */
+static void
+vm_opcode_stats_print_sequences (bool is_pair) /**< print pairs if true, triples otherwise */
+{
+  vm_opcode_stats_entry_t *table_p = JERRY_CONTEXT (vm_opcode_sequences);
+  uint32_t last_count = UINT32_MAX;
+  uint32_t last_index = 0;
+
+  JERRY_DEBUG_MSG ("Most frequent opcode %s:\n", is_pair ? "pairs" : "triples");
+
+  /* Entries are printed by decreasing count, entries with the same count by increasing index. */
+  for (uint32_t printed = 0; printed < VM_OPCODE_STATS_PRINT_LIMIT; printed++)
+  {
+    vm_opcode_stats_entry_t *best_p = NULL;
+    uint32_t best_index = 0;
+
+    for (uint32_t i = 0; i < VM_OPCODE_STATS_TABLE_SIZE; i++)
+    {
+      vm_opcode_stats_entry_t *entry_p = table_p + i;
+
+      if (entry_p->key == 0
+          || ((entry_p->key & VM_OPCODE_STATS_PAIR_FLAG) != 0) != is_pair
+          || entry_p->count > last_count
+          || (entry_p->count == last_count && i <= last_index)
+          || (best_p != NULL && entry_p->count <= best_p->count))
+      {
+        continue;
+      }
+
+      best_p = entry_p;
+      best_index = i;
+    }
+
+    if (best_p == NULL)
+    {
+      break;
+    }
+
+    uint32_t key = best_p->key;
+
+    if (is_pair)
+    {
+      JERRY_DEBUG_MSG ("  %10u  %s %s\n",
+                       (unsigned int) best_p->count,
+                       vm_opcode_stats_get_name (((key >> VM_OPCODE_STATS_ID_BITS) & VM_OPCODE_STATS_ID_MASK) - 1),
+                       vm_opcode_stats_get_name ((key & VM_OPCODE_STATS_ID_MASK) - 1));
+    }
+    else
+    {
+      JERRY_DEBUG_MSG ("  %10u  %s %s %s\n",
+                       (unsigned int) best_p->count,
+                       vm_opcode_stats_get_name ((key >> (2 * VM_OPCODE_STATS_ID_BITS)) - 1),
+                       vm_opcode_stats_get_name (((key >> VM_OPCODE_STATS_ID_BITS) & VM_OPCODE_STATS_ID_MASK) - 1),
+                       vm_opcode_stats_get_name ((key & VM_OPCODE_STATS_ID_MASK) - 1));
+    }
+
+    last_count = best_p->count;
+    last_index = best_index;
+  }
+} /* vm_opcode_stats_print_sequences */
+
+/**
+ * Print the opcode statistics
+ */
+void
+vm_opcode_stats_print (void)
+{
+  uint32_t *counts_p = JERRY_CONTEXT (vm_opcode_counts);
+  size_t total = 0;
+  bool printed[VM_OPCODE_STATS_OPCODE_COUNT];
+
+  for (uint32_t i = 0; i < VM_OPCODE_STATS_OPCODE_COUNT; i++)
+  {
+    total += counts_p[i];
+    printed[i] = false;
+  }
+
+  JERRY_DEBUG_MSG ("Opcode statistics:\n"
+                   "  Executed opcodes = %zu\n"
+                   "  Dropped sequences = %u\n"
+                   "Most frequent opcodes:\n",
+                   total,
+                   (unsigned int) JERRY_CONTEXT (vm_opcode_sequences_dropped));
+
+  for (uint32_t count = 0; count < VM_OPCODE_STATS_PRINT_LIMIT; count++)
+  {
+    uint32_t best = VM_OPCODE_STATS_OPCODE_COUNT;
+
+    for (uint32_t i = 0; i < VM_OPCODE_STATS_OPCODE_COUNT; i++)
+    {
+      if (!printed[i]
+          && counts_p[i] != 0
+          && (best == VM_OPCODE_STATS_OPCODE_COUNT || counts_p[i] > counts_p[best]))
+      {
+        best = i;
+      }
+    }
+
+    if (best == VM_OPCODE_STATS_OPCODE_COUNT)
+    {
+      break;
+    }
+
+    printed[best] = true;
+    JERRY_DEBUG_MSG ("  %10u  %s\n", (unsigned int) counts_p[best], vm_opcode_stats_get_name (best));
+  }
+
+  vm_opcode_stats_print_sequences (true);
+  vm_opcode_stats_print_sequences (false);
+} /* vm_opcode_stats_print */
+
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,40 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_OPCODE_STATS_H
+#define VM_OPCODE_STATS_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_opcode_stats Opcode sequence statistics
+ * @{
+ */
+
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+
+uint32_t vm_opcode_stats_record (uint32_t history, uint32_t opcode_id);
+void vm_opcode_stats_print (void);
+
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_OPCODE_STATS_H */
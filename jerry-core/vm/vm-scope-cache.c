@@ -0,0 +1,282 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "ecma-lex-env.h"
+#include "jcontext.h"
+#include "vm-defines.h"
+#include "vm-scope-cache.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_scope_cache Scope caches of identifier access sites
+ * @{
+ */
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+
+/**
+ * Compute the index of the scope cache entry of an identifier access site
+ */
+#define VM_SCOPE_CACHE_INDEX(site_p) \
+  ((((uintptr_t) (site_p)) ^ (((uintptr_t) (site_p)) >> 7)) & (VM_SCOPE_CACHE_SIZE - 1))
+
+/**
+ * Maximum number of property pairs which can be skipped by a cached position
+ */
+#define VM_SCOPE_CACHE_MAX_PAIRS (UINT8_MAX / ECMA_PROPERTY_PAIR_ITEM_COUNT)
+
+/**
+ * Get the first property pair of a declarative lexical environment
+ *
+ * Note:
+ *      the property hashmap is skipped, so the positions of the bindings
+ *      do not change when the hashmap is created or freed
+ *
+ * @return pointer to the first property pair, NULL if the environment has no bindings
+ */
+static ecma_property_header_t *
+vm_scope_cache_get_first_pair (ecma_object_t *lex_env_p) /**< declarative lexical environment */
+{
+  jmem_cpointer_t prop_iter_cp = lex_env_p->u1.property_list_cp;
+
+#if ENABLED (JERRY_PROPRETY_HASHMAP)
+  if (prop_iter_cp != JMEM_CP_NULL)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+
+    if (prop_iter_p->types[0] == ECMA_PROPERTY_TYPE_HASHMAP)
+    {
+      prop_iter_cp = prop_iter_p->next_property_cp;
+    }
+  }
+#endif /* ENABLED (JERRY_PROPRETY_HASHMAP) */
+
+  if (prop_iter_cp == JMEM_CP_NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, prop_iter_cp);
+} /* vm_scope_cache_get_first_pair */
+
+/**
+ * Checks whether a property slot of a property pair is a binding with the given name
+ *
+ * @return true - if the slot contains a named property with the given name
+ *         false - otherwise
+ */
+static inline bool JERRY_ATTR_ALWAYS_INLINE
+vm_scope_cache_is_name_matching (ecma_property_header_t *prop_iter_p, /**< property pair */
+                                 uint32_t slot, /**< slot index in the property pair */
+                                 ecma_string_t *name_p) /**< identifier name */
+{
+  ecma_property_t property = prop_iter_p->types[slot];
+
+  if (!ECMA_PROPERTY_IS_NAMED_PROPERTY (property))
+  {
+    return false;
+  }
+
+  jmem_cpointer_t property_name_cp = ((ecma_property_pair_t *) prop_iter_p)->names_cp[slot];
+
+  if (ECMA_IS_DIRECT_STRING (name_p))
+  {
+    return (ECMA_PROPERTY_GET_NAME_TYPE (property) == ECMA_GET_DIRECT_STRING_TYPE (name_p)
+            && property_name_cp == (jmem_cpointer_t) ECMA_GET_DIRECT_STRING_VALUE (name_p));
+  }
+
+  if (ECMA_PROPERTY_GET_NAME_TYPE (property) != ECMA_DIRECT_STRING_PTR)
+  {
+    return false;
+  }
+
+  ecma_string_t *property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_name_cp);
+
+  return (property_name_p == name_p || ecma_compare_ecma_non_direct_strings (property_name_p, name_p));
+} /* vm_scope_cache_is_name_matching */
+
+/**
+ * Find the binding of an identifier using the scope cache of an identifier access site
+ *
+ * The scope chain of a code block, whose enclosing functions contain no direct eval calls
+ * (see CBC_CODE_FLAGS_STATIC_SCOPE), has the same shape every time an identifier access
+ * site of the code block is executed: declarative environments are never extended after
+ * their bindings are created. Hence the (depth, position) coordinates of the binding found
+ * by the first lookup are valid for the later ones, and only the name of the binding found
+ * at the cached position needs to be checked. Object bound environments (e.g. the global
+ * object or a with statement) and the global scope (which is extended by each script) are
+ * never skipped, the search continues by name from these environments.
+ *
+ * @return pointer to the binding - if the binding is found by the cache, lex_env_p is set to
+ *                                  the declarative environment which contains the binding
+ *         NULL - otherwise, lex_env_p is set to the lexical environment where the search
+ *                by name must be continued
+ */
+ecma_property_t *
+vm_scope_cache_find (const uint8_t *site_p, /**< byte code of the identifier access */
+                     ecma_value_t name, /**< identifier name literal */
+                     ecma_object_t **lex_env_p) /**< [in, out] lexical environment */
+{
+  vm_scope_cache_entry_t *entry_p = JERRY_CONTEXT (vm_scope_cache) + VM_SCOPE_CACHE_INDEX (site_p);
+  ecma_string_t *name_p = ecma_get_string_from_value (name);
+  ecma_object_t *current_lex_env_p = *lex_env_p;
+
+  if (entry_p->site_p == site_p && entry_p->name == name)
+  {
+    uint32_t depth = entry_p->depth;
+
+    while (depth > 0
+           && ecma_get_lex_env_type (current_lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND)
+    {
+      JERRY_ASSERT (current_lex_env_p->u2.outer_reference_cp != JMEM_CP_NULL);
+      current_lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, current_lex_env_p->u2.outer_reference_cp);
+      depth--;
+    }
+
+    if (depth == 0)
+    {
+      if (entry_p->position == 0)
+      {
+        *lex_env_p = current_lex_env_p;
+        return NULL;
+      }
+
+      uint32_t position = (uint32_t) entry_p->position - 1;
+      uint32_t slot = position % ECMA_PROPERTY_PAIR_ITEM_COUNT;
+      jmem_cpointer_t lex_env_cp;
+
+      ECMA_SET_NON_NULL_POINTER (lex_env_cp, current_lex_env_p);
+
+      if (lex_env_cp == entry_p->lex_env_cp && entry_p->epoch == JERRY_CONTEXT (vm_scope_cache_epoch))
+      {
+        /* The same environment is accessed again: the binding is not moved while the environment is alive. */
+        ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, entry_p->pair_cp);
+
+        if (vm_scope_cache_is_name_matching (prop_iter_p, slot, name_p))
+        {
+          *lex_env_p = current_lex_env_p;
+          return prop_iter_p->types + slot;
+        }
+      }
+      else if (ecma_get_lex_env_type (current_lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+      {
+        uint32_t pair_index = position / ECMA_PROPERTY_PAIR_ITEM_COUNT;
+        ecma_property_header_t *prop_iter_p = vm_scope_cache_get_first_pair (current_lex_env_p);
+
+        while (pair_index > 0 && prop_iter_p != NULL)
+        {
+          prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+          pair_index--;
+        }
+
+        if (prop_iter_p != NULL && vm_scope_cache_is_name_matching (prop_iter_p, slot, name_p))
+        {
+          entry_p->epoch = JERRY_CONTEXT (vm_scope_cache_epoch);
+          entry_p->lex_env_cp = lex_env_cp;
+          ECMA_SET_NON_NULL_POINTER (entry_p->pair_cp, prop_iter_p);
+
+          *lex_env_p = current_lex_env_p;
+          return prop_iter_p->types + slot;
+        }
+      }
+    }
+
+    current_lex_env_p = *lex_env_p;
+  }
+
+  /* The entry is updated by a search by name. */
+  entry_p->site_p = NULL;
+
+  ecma_object_t *global_scope_p = ecma_get_global_scope ();
+  uint32_t depth = 0;
+
+  while (depth <= UINT8_MAX
+         && current_lex_env_p != global_scope_p
+         && ecma_get_lex_env_type (current_lex_env_p) != ECMA_LEXICAL_ENVIRONMENT_THIS_OBJECT_BOUND)
+  {
+    if (ecma_get_lex_env_type (current_lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
+    {
+      ecma_property_header_t *prop_iter_p = vm_scope_cache_get_first_pair (current_lex_env_p);
+      uint32_t pair_index = 0;
+
+      while (prop_iter_p != NULL)
+      {
+        JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+        for (uint32_t slot = 0; slot < ECMA_PROPERTY_PAIR_ITEM_COUNT; slot++)
+        {
+          if (vm_scope_cache_is_name_matching (prop_iter_p, slot, name_p))
+          {
+            if (pair_index < VM_SCOPE_CACHE_MAX_PAIRS)
+            {
+              entry_p->site_p = site_p;
+              entry_p->name = name;
+              entry_p->epoch = JERRY_CONTEXT (vm_scope_cache_epoch);
+              ECMA_SET_NON_NULL_POINTER (entry_p->lex_env_cp, current_lex_env_p);
+              ECMA_SET_NON_NULL_POINTER (entry_p->pair_cp, prop_iter_p);
+              entry_p->depth = (uint8_t) depth;
+              entry_p->position = (uint8_t) (pair_index * ECMA_PROPERTY_PAIR_ITEM_COUNT + slot + 1);
+            }
+
+            *lex_env_p = current_lex_env_p;
+            return prop_iter_p->types + slot;
+          }
+        }
+
+        prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp);
+        pair_index++;
+      }
+    }
+
+    JERRY_ASSERT (current_lex_env_p->u2.outer_reference_cp != JMEM_CP_NULL);
+    current_lex_env_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, current_lex_env_p->u2.outer_reference_cp);
+    depth++;
+  }
+
+  if (depth <= UINT8_MAX)
+  {
+    entry_p->site_p = site_p;
+    entry_p->name = name;
+    entry_p->lex_env_cp = JMEM_CP_NULL;
+    entry_p->depth = (uint8_t) depth;
+    entry_p->position = 0;
+  }
+
+  *lex_env_p = current_lex_env_p;
+  return NULL;
+} /* vm_scope_cache_find */
+
+/**
+ * Invalidate all scope cache entries
+ *
+ * Note:
+ *      must be called when a byte code which may have cached sites is freed,
+ *      since a new byte code allocated at the same address may have a
+ *      different scope chain
+ */
+void
+vm_scope_cache_invalidate (void)
+{
+  memset (JERRY_CONTEXT (vm_scope_cache), 0, sizeof (JERRY_CONTEXT (vm_scope_cache)));
+} /* vm_scope_cache_invalidate */
+
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
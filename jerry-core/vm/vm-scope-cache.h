@@ -0,0 +1,40 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef VM_SCOPE_CACHE_H
+#define VM_SCOPE_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup vm Virtual machine
+ * @{
+ *
+ * \addtogroup vm_scope_cache Scope caches of identifier access sites
+ * @{
+ */
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+
+ecma_property_t *vm_scope_cache_find (const uint8_t *site_p, ecma_value_t name, ecma_object_t **lex_env_p);
+void vm_scope_cache_invalidate (void);
+
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !VM_SCOPE_CACHE_H */
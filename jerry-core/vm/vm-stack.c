@@ -513,6 +513,132 @@ vm_ref_lex_env_chain (ecma_object_t *lex_env_p, /**< top of lexical environment
 
 #endif /* ENABLED (JERRY_ESNEXT) */
 
+#if (JERRY_VM_STACK_SEGMENT_SIZE != 0)
+
+/**
+ * Push a new segment onto the frame stack
+ *
+ * @return pointer to the frame allocated at the start of the new segment
+ *         NULL - if there is not enough memory
+ */
+static vm_frame_ctx_t * JERRY_ATTR_NOINLINE
+vm_stack_push_segment (size_t frame_size) /**< aligned size of the frame */
+{
+  size_t segment_size = JERRY_MAX (VM_STACK_SEGMENT_SIZE, sizeof (vm_stack_segment_t) + frame_size);
+  vm_stack_segment_t *segment_p = JERRY_CONTEXT (vm_stack_free_segment_p);
+
+  if (segment_p != NULL && segment_p->size < segment_size)
+  {
+    jmem_heap_free_block (segment_p, segment_p->size);
+    segment_p = NULL;
+  }
+
+  JERRY_CONTEXT (vm_stack_free_segment_p) = NULL;
+
+  if (segment_p == NULL)
+  {
+    segment_p = (vm_stack_segment_t *) jmem_heap_alloc_block_null_on_error (segment_size);
+
+    if (JERRY_UNLIKELY (segment_p == NULL))
+    {
+      return NULL;
+    }
+
+    segment_p->size = segment_size;
+  }
+
+  segment_p->prev_p = JERRY_CONTEXT (vm_stack_segment_p);
+  segment_p->prev_top_p = JERRY_CONTEXT (vm_stack_top_p);
+
+  uint8_t *frame_p = (uint8_t *) (segment_p + 1);
+
+  JERRY_CONTEXT (vm_stack_segment_p) = segment_p;
+  JERRY_CONTEXT (vm_stack_top_p) = frame_p + frame_size;
+  JERRY_CONTEXT (vm_stack_end_p) = ((uint8_t *) segment_p) + segment_p->size;
+
+  return (vm_frame_ctx_t *) frame_p;
+} /* vm_stack_push_segment */
+
+/**
+ * Pop the current (empty) segment from the frame stack
+ *
+ * Note:
+ *      the segment is kept for the next segment push, unless the frame stack becomes empty
+ */
+static void JERRY_ATTR_NOINLINE
+vm_stack_pop_segment (void)
+{
+  vm_stack_segment_t *segment_p = JERRY_CONTEXT (vm_stack_segment_p);
+  vm_stack_segment_t *prev_p = segment_p->prev_p;
+  vm_stack_segment_t *free_segment_p = JERRY_CONTEXT (vm_stack_free_segment_p);
+
+  if (free_segment_p != NULL)
+  {
+    jmem_heap_free_block (free_segment_p, free_segment_p->size);
+  }
+
+  JERRY_CONTEXT (vm_stack_segment_p) = prev_p;
+  JERRY_CONTEXT (vm_stack_top_p) = segment_p->prev_top_p;
+
+  if (prev_p == NULL)
+  {
+    /* No frames are left: all memory is returned to the heap. */
+    jmem_heap_free_block (segment_p, segment_p->size);
+    JERRY_CONTEXT (vm_stack_free_segment_p) = NULL;
+    JERRY_CONTEXT (vm_stack_end_p) = NULL;
+    return;
+  }
+
+  JERRY_CONTEXT (vm_stack_free_segment_p) = segment_p;
+  JERRY_CONTEXT (vm_stack_end_p) = ((uint8_t *) prev_p) + prev_p->size;
+} /* vm_stack_pop_segment */
+
+/**
+ * Allocate a frame on the frame stack
+ *
+ * @return pointer to the frame
+ *         NULL - if there is not enough memory
+ */
+inline vm_frame_ctx_t * JERRY_ATTR_ALWAYS_INLINE
+vm_stack_alloc_frame (size_t frame_size) /**< size of the frame context and its registers and stack */
+{
+  frame_size = JERRY_ALIGNUP (frame_size, JMEM_ALIGNMENT);
+
+  uint8_t *top_p = JERRY_CONTEXT (vm_stack_top_p);
+
+  if (JERRY_LIKELY ((size_t) (JERRY_CONTEXT (vm_stack_end_p) - top_p) >= frame_size))
+  {
+    JERRY_CONTEXT (vm_stack_top_p) = top_p + frame_size;
+    return (vm_frame_ctx_t *) top_p;
+  }
+
+  return vm_stack_push_segment (frame_size);
+} /* vm_stack_alloc_frame */
+
+/**
+ * Free the most recently allocated frame of the frame stack
+ */
+inline void JERRY_ATTR_ALWAYS_INLINE
+vm_stack_free_frame (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
+{
+  uint8_t *frame_p = (uint8_t *) frame_ctx_p;
+  vm_stack_segment_t *segment_p = JERRY_CONTEXT (vm_stack_segment_p);
+
+  JERRY_ASSERT (segment_p != NULL
+                && frame_p >= (uint8_t *) (segment_p + 1)
+                && frame_p < JERRY_CONTEXT (vm_stack_top_p));
+
+  if (JERRY_UNLIKELY (frame_p == (uint8_t *) (segment_p + 1)))
+  {
+    vm_stack_pop_segment ();
+    return;
+  }
+
+  JERRY_CONTEXT (vm_stack_top_p) = frame_p;
+} /* vm_stack_free_frame */
+
+#endif /* (JERRY_VM_STACK_SEGMENT_SIZE != 0) */
+
 /**
  * @}
  * @}
@@ -119,6 +119,11 @@ uint32_t vm_get_context_value_offsets (ecma_value_t *context_item_p);
 void vm_ref_lex_env_chain (ecma_object_t *lex_env_p, uint16_t context_depth,
                            ecma_value_t *context_end_p, bool do_ref);
 
+#if (JERRY_VM_STACK_SEGMENT_SIZE != 0)
+vm_frame_ctx_t *vm_stack_alloc_frame (size_t frame_size);
+void vm_stack_free_frame (vm_frame_ctx_t *frame_ctx_p);
+#endif /* (JERRY_VM_STACK_SEGMENT_SIZE != 0) */
+
 /**
  * @}
  * @}
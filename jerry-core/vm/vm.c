@@ -37,6 +37,9 @@
 #include "jcontext.h"
 #include "opcodes.h"
 #include "vm.h"
+#include "vm-inline-cache.h"
+#include "vm-opcode-stats.h"
+#include "vm-scope-cache.h"
 #include "vm-stack.h"
 
 /** \addtogroup vm Virtual machine
@@ -57,9 +60,14 @@
  * @return ecma value
  */
 static ecma_value_t
-vm_op_get_value (ecma_value_t object, /**< base object */
+vm_op_get_value (const uint8_t *site_p, /**< byte code of the property access */
+                 ecma_value_t object, /**< base object */
                  ecma_value_t property) /**< property name */
 {
+#if !ENABLED (JERRY_INLINE_CACHE)
+  JERRY_UNUSED (site_p);
+#endif /* !ENABLED (JERRY_INLINE_CACHE) */
+
   if (ecma_is_value_object (object))
   {
     ecma_object_t *object_p = ecma_get_object_from_value (object);
@@ -105,6 +113,37 @@ vm_op_get_value (ecma_value_t object, /**< base object */
 
     if (property_name_p != NULL)
     {
+#if ENABLED (JERRY_INLINE_CACHE)
+      if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL
+          && !ecma_get_object_is_builtin (object_p))
+      {
+        ecma_property_t *own_property_p;
+
+        if (vm_inline_cache_find (site_p, object_p, property_name_p, &own_property_p))
+        {
+          if (own_property_p == NULL)
+          {
+            /* The own properties are already searched, continue with the prototype. */
+            jmem_cpointer_t proto_cp = ecma_op_ordinary_object_get_prototype_of (object_p);
+
+            if (proto_cp == JMEM_CP_NULL)
+            {
+              return ECMA_VALUE_UNDEFINED;
+            }
+
+            return ecma_op_object_get_with_receiver (ECMA_GET_NON_NULL_POINTER (ecma_object_t, proto_cp),
+                                                     property_name_p,
+                                                     object);
+          }
+
+          if (ECMA_PROPERTY_GET_TYPE (*own_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+          {
+            return ecma_fast_copy_value (ECMA_PROPERTY_VALUE_PTR (own_property_p)->value);
+          }
+        }
+      }
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+
 #if ENABLED (JERRY_LCACHE)
       ecma_property_t *property_p = ecma_lcache_lookup (object_p, property_name_p);
 
@@ -156,14 +195,22 @@ vm_op_get_value (ecma_value_t object, /**< base object */
  *         if the property setting is unsuccessful
  */
 static ecma_value_t
-vm_op_set_value (ecma_value_t base, /**< base object */
+vm_op_set_value (const uint8_t *site_p, /**< byte code of the property access */
+                 ecma_value_t base, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
                  bool is_strict) /**< strict mode */
 {
+#if !ENABLED (JERRY_INLINE_CACHE)
+  JERRY_UNUSED (site_p);
+#endif /* !ENABLED (JERRY_INLINE_CACHE) */
+
   ecma_value_t result = ECMA_VALUE_EMPTY;
   ecma_object_t *object_p;
   ecma_string_t *property_p;
+#if ENABLED (JERRY_INLINE_CACHE)
+  ecma_property_t *own_property_p;
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
 
   if (JERRY_UNLIKELY (!ecma_is_value_object (base)))
   {
@@ -231,7 +278,26 @@ vm_op_set_value (ecma_value_t base, /**< base object */
       property_p = ecma_get_prop_name_from_value (property);
     }
 
-    if (!ecma_is_lexical_environment (object_p))
+    if (ecma_is_lexical_environment (object_p))
+    {
+      result = ecma_op_set_mutable_binding (object_p,
+                                            property_p,
+                                            value,
+                                            is_strict);
+    }
+#if ENABLED (JERRY_INLINE_CACHE)
+    else if (ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL
+             && !ecma_get_object_is_builtin (object_p)
+             && vm_inline_cache_find (site_p, object_p, property_p, &own_property_p)
+             && own_property_p != NULL
+             && ECMA_PROPERTY_GET_TYPE (*own_property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+             && ecma_is_property_writable (*own_property_p))
+    {
+      ecma_named_data_property_assign_value (object_p, ECMA_PROPERTY_VALUE_PTR (own_property_p), value);
+      result = ECMA_VALUE_TRUE;
+    }
+#endif /* ENABLED (JERRY_INLINE_CACHE) */
+    else
     {
       result = ecma_op_object_put_with_receiver (object_p,
                                                  property_p,
@@ -239,13 +305,6 @@ vm_op_set_value (ecma_value_t base, /**< base object */
                                                  base,
                                                  is_strict);
     }
-    else
-    {
-      result = ecma_op_set_mutable_binding (object_p,
-                                            property_p,
-                                            value,
-                                            is_strict);
-    }
   }
 
   ecma_deref_object (object_p);
@@ -253,6 +312,95 @@ vm_op_set_value (ecma_value_t base, /**< base object */
   return result;
 } /* vm_op_set_value */
 
+#if ENABLED (JERRY_SCOPE_CACHE)
+
+/**
+ * Checks whether the scope cache can be used by the identifier access sites of a frame.
+ *
+ * Note:
+ *      when the current lexical environment is not a declarative environment or it is
+ *      the global scope, the cache cannot skip any environments
+ */
+#define VM_SCOPE_CACHE_IS_USABLE(frame_ctx_p) \
+  (((frame_ctx_p)->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE) \
+   && ecma_get_lex_env_type ((frame_ctx_p)->lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE \
+   && (frame_ctx_p)->lex_env_p != ecma_get_global_scope ())
+
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+/**
+ * Get the value of an identifier which is not stored in a register.
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+vm_op_get_ident (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                 const uint8_t *site_p, /**< byte code of the identifier access */
+                 ecma_value_t name) /**< identifier name */
+{
+  ecma_object_t *lex_env_p = frame_ctx_p->lex_env_p;
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+  if (VM_SCOPE_CACHE_IS_USABLE (frame_ctx_p))
+  {
+    ecma_property_t *binding_p = vm_scope_cache_find (site_p, name, &lex_env_p);
+
+    if (binding_p != NULL)
+    {
+      ecma_value_t value = ECMA_PROPERTY_VALUE_PTR (binding_p)->value;
+
+      if (JERRY_LIKELY (value != ECMA_VALUE_UNINITIALIZED))
+      {
+        return ecma_fast_copy_value (value);
+      }
+    }
+  }
+#else /* !ENABLED (JERRY_SCOPE_CACHE) */
+  JERRY_UNUSED (site_p);
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+  return ecma_op_resolve_reference_value (lex_env_p, ecma_get_string_from_value (name));
+} /* vm_op_get_ident */
+
+/**
+ * Assign a value to an identifier which is not stored in a register.
+ *
+ * @return ECMA_VALUE_ERROR - if the assignment throws an error
+ *         ECMA_VALUE_EMPTY - otherwise
+ */
+static ecma_value_t
+vm_op_put_ident (vm_frame_ctx_t *frame_ctx_p, /**< frame context */
+                 const uint8_t *site_p, /**< byte code of the identifier access */
+                 ecma_value_t name, /**< identifier name */
+                 ecma_value_t value, /**< value to assign */
+                 bool is_strict) /**< strict mode */
+{
+  ecma_object_t *lex_env_p = frame_ctx_p->lex_env_p;
+
+#if ENABLED (JERRY_SCOPE_CACHE)
+  if (VM_SCOPE_CACHE_IS_USABLE (frame_ctx_p))
+  {
+    ecma_property_t *binding_p = vm_scope_cache_find (site_p, name, &lex_env_p);
+
+    if (binding_p != NULL && ecma_is_property_writable (*binding_p))
+    {
+      ecma_property_value_t *binding_value_p = ECMA_PROPERTY_VALUE_PTR (binding_p);
+
+      if (JERRY_LIKELY (binding_value_p->value != ECMA_VALUE_UNINITIALIZED))
+      {
+        ecma_named_data_property_assign_value (lex_env_p, binding_value_p, value);
+        return ECMA_VALUE_EMPTY;
+      }
+    }
+  }
+#else /* !ENABLED (JERRY_SCOPE_CACHE) */
+  JERRY_UNUSED (site_p);
+#endif /* ENABLED (JERRY_SCOPE_CACHE) */
+
+  return ecma_op_put_value_lex_env_base (lex_env_p, ecma_get_string_from_value (name), is_strict, value);
+} /* vm_op_put_ident */
+
 /** Compact bytecode define */
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg4,
 
@@ -594,6 +742,9 @@ vm_super_call (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       {
         ECMA_SET_POINTER (ecma_get_object_from_value (completion_value)->u2.prototype_cp,
                           ecma_get_object_from_value (proto_value));
+#if ENABLED (JERRY_GENERATIONAL_GC)
+        ecma_gc_remember_object (ecma_get_object_from_value (completion_value));
+#endif /* ENABLED (JERRY_GENERATIONAL_GC) */
       }
       ecma_free_value (proto_value);
     }
@@ -928,10 +1079,7 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
       } \
       else \
       { \
-        ecma_string_t *name_p = ecma_get_string_from_value (literal_start_p[literal_index]); \
-        \
-        result = ecma_op_resolve_reference_value (frame_ctx_p->lex_env_p, \
-                                                  name_p); \
+        result = vm_op_get_ident (frame_ctx_p, byte_code_p, literal_start_p[literal_index]); \
         \
         if (ECMA_IS_VALUE_ERROR (result)) \
         { \
@@ -988,6 +1136,53 @@ opfunc_construct (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     opcode_data &= (uint32_t) ~VM_OC_PUT_BLOCK; \
   }
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+
+/**
+ * Case label of an opcode handler, which also defines the
+ * label stored in the opcode handler table of vm_loop.
+ */
+#define VM_CASE(group) case group: vm_handler_ ## group
+
+/**
+ * Entry of the opcode handler table.
+ */
+#define VM_HANDLER_ENTRY(group) [group] = &&vm_handler_ ## group
+
+/**
+ * Jump to the handler of the current opcode group.
+ *
+ * Each operand fetch variant ends with its own copy of this
+ * indirect jump, so the branch predictor can track them separately.
+ */
+#define VM_DISPATCH() \
+  do \
+  { \
+    JERRY_ASSERT (vm_handler_table[VM_OC_GROUP_GET_INDEX (opcode_data)] != NULL); \
+    goto *vm_handler_table[VM_OC_GROUP_GET_INDEX (opcode_data)]; \
+  } \
+  while (0)
+
+#else /* !ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
+/**
+ * Case label of an opcode handler.
+ */
+#define VM_CASE(group) case group
+
+/**
+ * Opcode handlers are selected by the switch statement of vm_loop.
+ */
+#define VM_DISPATCH()
+
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+/* Labels as values are not part of ISO C. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
 /**
  * Run generic byte code.
  *
@@ -1012,6 +1207,190 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   ecma_value_t right_value;
   ecma_value_t result = ECMA_VALUE_EMPTY;
   bool is_strict = ((frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+  uint32_t opcode_history;
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+  /* Handler labels must mirror the case labels of the opcode switch below:
+   * a missing entry is an unused label, an extra entry is an undefined label. */
+  static const void *const vm_handler_table[VM_OC_NONE + 1] =
+  {
+    VM_HANDLER_ENTRY (VM_OC_POP),
+    VM_HANDLER_ENTRY (VM_OC_POP_BLOCK),
+    VM_HANDLER_ENTRY (VM_OC_PUSH),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_TWO),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_THREE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_UNDEFINED),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_TRUE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_FALSE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_NULL),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_THIS),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_0),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_POS_BYTE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_NEG_BYTE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_LIT_0),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_LIT_POS_BYTE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_LIT_NEG_BYTE),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_OBJECT),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_NAMED_FUNC_EXPR),
+    VM_HANDLER_ENTRY (VM_OC_CREATE_BINDING),
+    VM_HANDLER_ENTRY (VM_OC_VAR_EVAL),
+#if ENABLED (JERRY_ESNEXT)
+    VM_HANDLER_ENTRY (VM_OC_EXT_VAR_EVAL),
+#endif /* ENABLED (JERRY_ESNEXT) */
+#if ENABLED (JERRY_SNAPSHOT_EXEC)
+    VM_HANDLER_ENTRY (VM_OC_SET_BYTECODE_PTR),
+#endif /* ENABLED (JERRY_SNAPSHOT_EXEC) */
+    VM_HANDLER_ENTRY (VM_OC_INIT_ARG_OR_FUNC),
+#if ENABLED (JERRY_ESNEXT)
+    VM_HANDLER_ENTRY (VM_OC_CHECK_VAR),
+    VM_HANDLER_ENTRY (VM_OC_CHECK_LET),
+    VM_HANDLER_ENTRY (VM_OC_ASSIGN_LET_CONST),
+    VM_HANDLER_ENTRY (VM_OC_INIT_BINDING),
+    VM_HANDLER_ENTRY (VM_OC_THROW_CONST_ERROR),
+    VM_HANDLER_ENTRY (VM_OC_THROW_SYNTAX_ERROR),
+    VM_HANDLER_ENTRY (VM_OC_COPY_TO_GLOBAL),
+    VM_HANDLER_ENTRY (VM_OC_COPY_FROM_ARG),
+    VM_HANDLER_ENTRY (VM_OC_CLONE_CONTEXT),
+    VM_HANDLER_ENTRY (VM_OC_SET__PROTO__),
+    VM_HANDLER_ENTRY (VM_OC_COPY_DATA_PROPERTIES),
+    VM_HANDLER_ENTRY (VM_OC_SET_COMPUTED_PROPERTY),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_HANDLER_ENTRY (VM_OC_SET_PROPERTY),
+    VM_HANDLER_ENTRY (VM_OC_SET_GETTER),
+    VM_HANDLER_ENTRY (VM_OC_SET_SETTER),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_ARRAY),
+#if ENABLED (JERRY_ESNEXT)
+    VM_HANDLER_ENTRY (VM_OC_LOCAL_EVAL),
+    VM_HANDLER_ENTRY (VM_OC_SUPER_CALL),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_CLASS_ENVIRONMENT),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_IMPLICIT_CTOR),
+    VM_HANDLER_ENTRY (VM_OC_INIT_CLASS),
+    VM_HANDLER_ENTRY (VM_OC_FINALIZE_CLASS),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_SUPER_CONSTRUCTOR),
+    VM_HANDLER_ENTRY (VM_OC_RESOLVE_LEXICAL_THIS),
+    VM_HANDLER_ENTRY (VM_OC_OBJECT_LITERAL_HOME_ENV),
+    VM_HANDLER_ENTRY (VM_OC_SET_HOME_OBJECT),
+    VM_HANDLER_ENTRY (VM_OC_SUPER_REFERENCE),
+    VM_HANDLER_ENTRY (VM_OC_SET_FUNCTION_NAME),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_SPREAD_ELEMENT),
+    VM_HANDLER_ENTRY (VM_OC_GET_ITERATOR),
+    VM_HANDLER_ENTRY (VM_OC_ITERATOR_STEP),
+    VM_HANDLER_ENTRY (VM_OC_ITERATOR_CLOSE),
+    VM_HANDLER_ENTRY (VM_OC_DEFAULT_INITIALIZER),
+    VM_HANDLER_ENTRY (VM_OC_REST_INITIALIZER),
+    VM_HANDLER_ENTRY (VM_OC_INITIALIZER_PUSH_PROP),
+    VM_HANDLER_ENTRY (VM_OC_SPREAD_ARGUMENTS),
+    VM_HANDLER_ENTRY (VM_OC_CREATE_GENERATOR),
+    VM_HANDLER_ENTRY (VM_OC_YIELD),
+    VM_HANDLER_ENTRY (VM_OC_ASYNC_YIELD),
+    VM_HANDLER_ENTRY (VM_OC_ASYNC_YIELD_ITERATOR),
+    VM_HANDLER_ENTRY (VM_OC_AWAIT),
+    VM_HANDLER_ENTRY (VM_OC_GENERATOR_AWAIT),
+    VM_HANDLER_ENTRY (VM_OC_EXT_RETURN),
+    VM_HANDLER_ENTRY (VM_OC_ASYNC_EXIT),
+    VM_HANDLER_ENTRY (VM_OC_STRING_CONCAT),
+    VM_HANDLER_ENTRY (VM_OC_GET_TEMPLATE_OBJECT),
+    VM_HANDLER_ENTRY (VM_OC_PUSH_NEW_TARGET),
+    VM_HANDLER_ENTRY (VM_OC_REQUIRE_OBJECT_COERCIBLE),
+    VM_HANDLER_ENTRY (VM_OC_ASSIGN_SUPER),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_HANDLER_ENTRY (VM_OC_PUSH_ELISON),
+    VM_HANDLER_ENTRY (VM_OC_APPEND_ARRAY),
+    VM_HANDLER_ENTRY (VM_OC_IDENT_REFERENCE),
+    VM_HANDLER_ENTRY (VM_OC_PROP_GET),
+    VM_HANDLER_ENTRY (VM_OC_PROP_REFERENCE),
+    VM_HANDLER_ENTRY (VM_OC_PROP_PRE_INCR),
+    VM_HANDLER_ENTRY (VM_OC_PROP_PRE_DECR),
+    VM_HANDLER_ENTRY (VM_OC_PROP_POST_INCR),
+    VM_HANDLER_ENTRY (VM_OC_PROP_POST_DECR),
+    VM_HANDLER_ENTRY (VM_OC_PRE_INCR),
+    VM_HANDLER_ENTRY (VM_OC_PRE_DECR),
+    VM_HANDLER_ENTRY (VM_OC_POST_INCR),
+    VM_HANDLER_ENTRY (VM_OC_POST_DECR),
+    VM_HANDLER_ENTRY (VM_OC_ASSIGN),
+    VM_HANDLER_ENTRY (VM_OC_MOV_IDENT),
+    VM_HANDLER_ENTRY (VM_OC_ASSIGN_PROP),
+    VM_HANDLER_ENTRY (VM_OC_ASSIGN_PROP_THIS),
+    VM_HANDLER_ENTRY (VM_OC_RETURN),
+    VM_HANDLER_ENTRY (VM_OC_THROW),
+    VM_HANDLER_ENTRY (VM_OC_THROW_REFERENCE_ERROR),
+    VM_HANDLER_ENTRY (VM_OC_EVAL),
+    VM_HANDLER_ENTRY (VM_OC_CALL),
+    VM_HANDLER_ENTRY (VM_OC_NEW),
+    VM_HANDLER_ENTRY (VM_OC_ERROR),
+    VM_HANDLER_ENTRY (VM_OC_RESOLVE_BASE_FOR_CALL),
+    VM_HANDLER_ENTRY (VM_OC_PROP_DELETE),
+    VM_HANDLER_ENTRY (VM_OC_DELETE),
+    VM_HANDLER_ENTRY (VM_OC_JUMP),
+    VM_HANDLER_ENTRY (VM_OC_BRANCH_IF_STRICT_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_BRANCH_IF_TRUE),
+    VM_HANDLER_ENTRY (VM_OC_BRANCH_IF_FALSE),
+    VM_HANDLER_ENTRY (VM_OC_BRANCH_IF_LOGICAL_TRUE),
+    VM_HANDLER_ENTRY (VM_OC_BRANCH_IF_LOGICAL_FALSE),
+#if ENABLED (JERRY_ESNEXT)
+    VM_HANDLER_ENTRY (VM_OC_BRANCH_IF_NULLISH),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_HANDLER_ENTRY (VM_OC_PLUS),
+    VM_HANDLER_ENTRY (VM_OC_MINUS),
+    VM_HANDLER_ENTRY (VM_OC_NOT),
+    VM_HANDLER_ENTRY (VM_OC_BIT_NOT),
+    VM_HANDLER_ENTRY (VM_OC_VOID),
+    VM_HANDLER_ENTRY (VM_OC_TYPEOF_IDENT),
+    VM_HANDLER_ENTRY (VM_OC_TYPEOF),
+    VM_HANDLER_ENTRY (VM_OC_ADD),
+    VM_HANDLER_ENTRY (VM_OC_SUB),
+    VM_HANDLER_ENTRY (VM_OC_MUL),
+    VM_HANDLER_ENTRY (VM_OC_DIV),
+    VM_HANDLER_ENTRY (VM_OC_MOD),
+    VM_HANDLER_ENTRY (VM_OC_ARITHMETIC_SET_IDENT),
+#if ENABLED (JERRY_ESNEXT)
+    VM_HANDLER_ENTRY (VM_OC_EXP),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_HANDLER_ENTRY (VM_OC_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_NOT_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_STRICT_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_STRICT_NOT_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_BIT_OR),
+    VM_HANDLER_ENTRY (VM_OC_BIT_XOR),
+    VM_HANDLER_ENTRY (VM_OC_BIT_AND),
+    VM_HANDLER_ENTRY (VM_OC_LEFT_SHIFT),
+    VM_HANDLER_ENTRY (VM_OC_RIGHT_SHIFT),
+    VM_HANDLER_ENTRY (VM_OC_UNS_RIGHT_SHIFT),
+    VM_HANDLER_ENTRY (VM_OC_LESS),
+    VM_HANDLER_ENTRY (VM_OC_GREATER),
+    VM_HANDLER_ENTRY (VM_OC_LESS_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_GREATER_EQUAL),
+    VM_HANDLER_ENTRY (VM_OC_IN),
+    VM_HANDLER_ENTRY (VM_OC_INSTANCEOF),
+    VM_HANDLER_ENTRY (VM_OC_BLOCK_CREATE_CONTEXT),
+    VM_HANDLER_ENTRY (VM_OC_WITH),
+    VM_HANDLER_ENTRY (VM_OC_FOR_IN_INIT),
+    VM_HANDLER_ENTRY (VM_OC_FOR_IN_GET_NEXT),
+    VM_HANDLER_ENTRY (VM_OC_FOR_IN_HAS_NEXT),
+#if ENABLED (JERRY_ESNEXT)
+    VM_HANDLER_ENTRY (VM_OC_FOR_OF_INIT),
+    VM_HANDLER_ENTRY (VM_OC_FOR_OF_GET_NEXT),
+    VM_HANDLER_ENTRY (VM_OC_FOR_OF_HAS_NEXT),
+    VM_HANDLER_ENTRY (VM_OC_FOR_AWAIT_OF_INIT),
+    VM_HANDLER_ENTRY (VM_OC_FOR_AWAIT_OF_HAS_NEXT),
+#endif /* ENABLED (JERRY_ESNEXT) */
+    VM_HANDLER_ENTRY (VM_OC_TRY),
+    VM_HANDLER_ENTRY (VM_OC_CATCH),
+    VM_HANDLER_ENTRY (VM_OC_FINALLY),
+    VM_HANDLER_ENTRY (VM_OC_CONTEXT_END),
+    VM_HANDLER_ENTRY (VM_OC_JUMP_AND_EXIT_CONTEXT),
+#if ENABLED (JERRY_DEBUGGER)
+    VM_HANDLER_ENTRY (VM_OC_BREAKPOINT_ENABLED),
+    VM_HANDLER_ENTRY (VM_OC_BREAKPOINT_DISABLED),
+#endif /* ENABLED (JERRY_DEBUGGER) */
+#if ENABLED (JERRY_LINE_INFO)
+    VM_HANDLER_ENTRY (VM_OC_LINE),
+#endif /* ENABLED (JERRY_LINE_INFO) */
+    VM_HANDLER_ENTRY (VM_OC_NONE),
+  };
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
 
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
@@ -1045,6 +1424,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   /* Outer loop for exception handling. */
   while (true)
   {
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+    opcode_history = 0;
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
     /* Internal loop for byte code execution. */
     while (true)
     {
@@ -1058,8 +1441,20 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         opcode_data = (uint32_t) ((CBC_END + 1) + opcode);
       }
 
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+      opcode_history = vm_opcode_stats_record (opcode_history, opcode_data);
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
       opcode_data = vm_decode_table[opcode_data];
 
+#if ENABLED (JERRY_VM_OPCODE_STATS)
+      /* The instruction executed after a branch is not necessarily the next one in the byte code. */
+      if (VM_OC_GET_ARGS_INDEX (opcode_data) == VM_OC_GET_BRANCH)
+      {
+        opcode_history = 0;
+      }
+#endif /* ENABLED (JERRY_VM_OPCODE_STATS) */
+
       left_value = ECMA_VALUE_UNDEFINED;
       right_value = ECMA_VALUE_UNDEFINED;
 
@@ -1080,6 +1475,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               uint16_t second_literal_index;
               READ_LITERAL_INDEX (second_literal_index);
               READ_LITERAL (second_literal_index, right_value);
+              VM_DISPATCH ();
               break;
             }
             case VM_OC_GET_STACK_LITERAL:
@@ -1087,6 +1483,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
               JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
               right_value = left_value;
               left_value = *(--stack_top_p);
+              VM_DISPATCH ();
               break;
             }
             default:
@@ -1095,10 +1492,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
               right_value = left_value;
               left_value = ecma_copy_value (frame_ctx_p->this_binding);
+              VM_DISPATCH ();
               break;
             }
           }
         }
+
+        VM_DISPATCH ();
       }
       else if (operands >= VM_OC_GET_STACK)
       {
@@ -1114,6 +1514,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = left_value;
           left_value = *(--stack_top_p);
         }
+
+        VM_DISPATCH ();
       }
       else if (operands == VM_OC_GET_BRANCH)
       {
@@ -1169,34 +1571,38 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           branch_offset = -branch_offset;
         }
+
+        VM_DISPATCH ();
       }
 
+      VM_DISPATCH ();
+
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
           ecma_free_value (*(--stack_top_p));
           continue;
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           ecma_fast_free_value (frame_ctx_p->block_result);
           frame_ctx_p->block_result = *(--stack_top_p);
           continue;
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *stack_top_p++ = left_value;
           *stack_top_p++ = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -1210,56 +1616,56 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           *stack_top_p++ = ECMA_VALUE_TRUE;
           continue;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           *stack_top_p++ = ECMA_VALUE_FALSE;
           continue;
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           *stack_top_p++ = ECMA_VALUE_NULL;
           continue;
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           *stack_top_p++ = ecma_copy_value (frame_ctx_p->this_binding);
           continue;
         }
-        case VM_OC_PUSH_0:
+        VM_CASE (VM_OC_PUSH_0):
         {
           *stack_top_p++ = ecma_make_integer_value (0);
           continue;
         }
-        case VM_OC_PUSH_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (number + 1);
           continue;
         }
-        case VM_OC_PUSH_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           *stack_top_p++ = ecma_make_integer_value (-(number + 1));
           continue;
         }
-        case VM_OC_PUSH_LIT_0:
+        VM_CASE (VM_OC_PUSH_LIT_0):
         {
           stack_top_p[0] = left_value;
           stack_top_p[1] = ecma_make_integer_value (0);
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_POS_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_POS_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1267,7 +1673,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_LIT_NEG_BYTE:
+        VM_CASE (VM_OC_PUSH_LIT_NEG_BYTE):
         {
           ecma_integer_value_t number = *byte_code_p++;
           stack_top_p[0] = left_value;
@@ -1275,7 +1681,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p += 2;
           continue;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *obj_p = ecma_create_object (ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE),
                                                      0,
@@ -1284,7 +1690,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (obj_p);
           continue;
         }
-        case VM_OC_PUSH_NAMED_FUNC_EXPR:
+        VM_CASE (VM_OC_PUSH_NAMED_FUNC_EXPR):
         {
           ecma_object_t *func_p = ecma_get_object_from_value (left_value);
 
@@ -1306,7 +1712,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = left_value;
           continue;
         }
-        case VM_OC_CREATE_BINDING:
+        VM_CASE (VM_OC_CREATE_BINDING):
         {
 #if !ENABLED (JERRY_ESNEXT)
           JERRY_ASSERT (opcode == CBC_CREATE_VAR);
@@ -1346,7 +1752,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_VAR_EVAL:
+        VM_CASE (VM_OC_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1411,7 +1817,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_EXT_VAR_EVAL:
+        VM_CASE (VM_OC_EXT_VAR_EVAL):
         {
           uint32_t literal_index;
           ecma_value_t lit_value = ECMA_VALUE_UNDEFINED;
@@ -1487,14 +1893,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
 #if ENABLED (JERRY_SNAPSHOT_EXEC)
-        case VM_OC_SET_BYTECODE_PTR:
+        VM_CASE (VM_OC_SET_BYTECODE_PTR):
         {
           memcpy (&byte_code_p, byte_code_p++, sizeof (uint8_t *));
           frame_ctx_p->byte_code_start_p = byte_code_p;
           continue;
         }
 #endif /* ENABLED (JERRY_SNAPSHOT_EXEC) */
-        case VM_OC_INIT_ARG_OR_FUNC:
+        VM_CASE (VM_OC_INIT_ARG_OR_FUNC):
         {
           uint32_t literal_index, value_index;
           ecma_value_t lit_value;
@@ -1545,7 +1951,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_CHECK_VAR:
+        VM_CASE (VM_OC_CHECK_VAR):
         {
           JERRY_ASSERT (ecma_get_global_scope () == frame_ctx_p->lex_env_p);
 
@@ -1568,7 +1974,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_CHECK_LET:
+        VM_CASE (VM_OC_CHECK_LET):
         {
           JERRY_ASSERT (ecma_get_global_scope () == frame_ctx_p->lex_env_p);
 
@@ -1610,7 +2016,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_ASSIGN_LET_CONST:
+        VM_CASE (VM_OC_ASSIGN_LET_CONST):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1633,7 +2039,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_INIT_BINDING:
+        VM_CASE (VM_OC_INIT_BINDING):
         {
           uint32_t literal_index;
 
@@ -1671,12 +2077,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_if_object (value);
           continue;
         }
-        case VM_OC_THROW_CONST_ERROR:
+        VM_CASE (VM_OC_THROW_CONST_ERROR):
         {
           result = ecma_raise_type_error (ECMA_ERR_MSG ("Constant bindings cannot be reassigned."));
           goto error;
         }
-        case VM_OC_THROW_SYNTAX_ERROR:
+        VM_CASE (VM_OC_THROW_SYNTAX_ERROR):
         {
           ecma_string_t *msg_p = ecma_get_string_from_value (left_value);
           ecma_object_t *error_obj_p = ecma_new_standard_error_with_message (ECMA_ERROR_SYNTAX, msg_p);
@@ -1684,7 +2090,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_COPY_TO_GLOBAL:
+        VM_CASE (VM_OC_COPY_TO_GLOBAL):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1741,7 +2147,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_COPY_FROM_ARG:
+        VM_CASE (VM_OC_COPY_FROM_ARG):
         {
           uint32_t literal_index;
           READ_LITERAL_INDEX (literal_index);
@@ -1770,7 +2176,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           property_value_p->value = ecma_copy_value_if_not_object (arg_prop_value_p->value);
           continue;
         }
-        case VM_OC_CLONE_CONTEXT:
+        VM_CASE (VM_OC_CLONE_CONTEXT):
         {
           JERRY_ASSERT (byte_code_start_p[0] == CBC_EXT_OPCODE);
 
@@ -1778,7 +2184,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = ecma_clone_decl_lexical_environment (frame_ctx_p->lex_env_p, copy_values);
           continue;
         }
-        case VM_OC_SET__PROTO__:
+        VM_CASE (VM_OC_SET__PROTO__):
         {
           result = ecma_builtin_object_object_set_proto (stack_top_p[-1], left_value);
           if (ECMA_IS_VALUE_ERROR (result))
@@ -1787,7 +2193,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           goto free_left_value;
         }
-        case VM_OC_COPY_DATA_PROPERTIES:
+        VM_CASE (VM_OC_COPY_DATA_PROPERTIES):
         {
           result = *(--stack_top_p);
 
@@ -1845,7 +2251,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_object (object_p);
           continue;
         }
-        case VM_OC_SET_COMPUTED_PROPERTY:
+        VM_CASE (VM_OC_SET_COMPUTED_PROPERTY):
         {
           /* Swap values. */
           left_value ^= right_value;
@@ -1854,7 +2260,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           /* FALLTHRU */
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           JERRY_STATIC_ASSERT (VM_OC_NON_STATIC_FLAG == VM_OC_BACKWARD_BRANCH,
                                vm_oc_non_static_flag_must_be_equal_to_vm_oc_backward_branch);
@@ -1889,8 +2295,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           JERRY_ASSERT ((opcode_data >> VM_OC_NON_STATIC_SHIFT) <= 0x1);
 
@@ -1924,21 +2330,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_both_values;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           // Note: this operation cannot throw an exception
           *stack_top_p++ = ecma_make_object_value (ecma_op_new_fast_array_object (0));
           continue;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_LOCAL_EVAL:
+        VM_CASE (VM_OC_LOCAL_EVAL):
         {
           ECMA_CLEAR_LOCAL_PARSE_OPTS ();
           uint8_t parse_opts = *byte_code_p++;
           ECMA_SET_LOCAL_PARSE_OPTS (parse_opts);
           continue;
         }
-        case VM_OC_SUPER_CALL:
+        VM_CASE (VM_OC_SUPER_CALL):
         {
           uint8_t arguments_list_len = *byte_code_p++;
 
@@ -1966,17 +2372,17 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_PUSH_CLASS_ENVIRONMENT:
+        VM_CASE (VM_OC_PUSH_CLASS_ENVIRONMENT):
         {
           opfunc_push_class_environment (frame_ctx_p, &stack_top_p, left_value);
           goto free_left_value;
         }
-        case VM_OC_PUSH_IMPLICIT_CTOR:
+        VM_CASE (VM_OC_PUSH_IMPLICIT_CTOR):
         {
           *stack_top_p++ = opfunc_create_implicit_class_constructor (opcode);
           continue;
         }
-        case VM_OC_INIT_CLASS:
+        VM_CASE (VM_OC_INIT_CLASS):
         {
           result = opfunc_init_class (frame_ctx_p, stack_top_p);
 
@@ -1986,12 +2392,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FINALIZE_CLASS:
+        VM_CASE (VM_OC_FINALIZE_CLASS):
         {
           opfunc_finalize_class (frame_ctx_p, &stack_top_p, left_value);
           goto free_left_value;
         }
-        case VM_OC_PUSH_SUPER_CONSTRUCTOR:
+        VM_CASE (VM_OC_PUSH_SUPER_CONSTRUCTOR):
         {
           result = ecma_op_function_get_super_constructor (JERRY_CONTEXT (current_function_obj_p));
 
@@ -2003,7 +2409,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_RESOLVE_LEXICAL_THIS:
+        VM_CASE (VM_OC_RESOLVE_LEXICAL_THIS):
         {
           result = ecma_op_get_this_binding (frame_ctx_p->lex_env_p);
 
@@ -2015,7 +2421,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_OBJECT_LITERAL_HOME_ENV:
+        VM_CASE (VM_OC_OBJECT_LITERAL_HOME_ENV):
         {
           if (opcode == CBC_EXT_PUSH_OBJECT_SUPER_ENVIRONMENT)
           {
@@ -2036,14 +2442,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_SET_HOME_OBJECT:
+        VM_CASE (VM_OC_SET_HOME_OBJECT):
         {
           int offset = opcode == CBC_EXT_OBJECT_LITERAL_SET_HOME_OBJECT_COMPUTED ? -1 : 0;
           opfunc_set_home_object (ecma_get_object_from_value (stack_top_p[-1]),
                                   ecma_get_object_from_value (stack_top_p[-3 + offset]));
           continue;
         }
-        case VM_OC_SUPER_REFERENCE:
+        VM_CASE (VM_OC_SUPER_REFERENCE):
         {
           result = opfunc_form_super_reference (&stack_top_p, frame_ctx_p, left_value, opcode);
 
@@ -2054,7 +2460,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_SET_FUNCTION_NAME:
+        VM_CASE (VM_OC_SET_FUNCTION_NAME):
         {
           char *prefix_p = NULL;
           lit_utf8_size_t prefix_size = 0;
@@ -2123,12 +2529,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (left_value);
           continue;
         }
-        case VM_OC_PUSH_SPREAD_ELEMENT:
+        VM_CASE (VM_OC_PUSH_SPREAD_ELEMENT):
         {
           *stack_top_p++ = ECMA_VALUE_SPREAD_ELEMENT;
           continue;
         }
-        case VM_OC_GET_ITERATOR:
+        VM_CASE (VM_OC_GET_ITERATOR):
         {
           result = ecma_op_get_iterator (stack_top_p[-1], ECMA_VALUE_SYNC_ITERATOR, NULL);
 
@@ -2140,7 +2546,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_ITERATOR_STEP:
+        VM_CASE (VM_OC_ITERATOR_STEP):
         {
           JERRY_ASSERT (opcode >= CBC_EXT_ITERATOR_STEP && opcode <= CBC_EXT_ITERATOR_STEP_3);
           const uint8_t index = (uint8_t) (1 + (opcode - CBC_EXT_ITERATOR_STEP));
@@ -2168,7 +2574,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = value;
           continue;
         }
-        case VM_OC_ITERATOR_CLOSE:
+        VM_CASE (VM_OC_ITERATOR_CLOSE):
         {
           result = ecma_op_iterator_close (left_value);
 
@@ -2179,7 +2585,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto free_left_value;
         }
-        case VM_OC_DEFAULT_INITIALIZER:
+        VM_CASE (VM_OC_DEFAULT_INITIALIZER):
         {
           JERRY_ASSERT (stack_top_p > VM_GET_REGISTERS (frame_ctx_p) + register_end);
 
@@ -2192,7 +2598,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p--;
           continue;
         }
-        case VM_OC_REST_INITIALIZER:
+        VM_CASE (VM_OC_REST_INITIALIZER):
         {
           JERRY_ASSERT (opcode >= CBC_EXT_REST_INITIALIZER && opcode <= CBC_EXT_REST_INITIALIZER_3);
           const uint8_t iterator_index = (uint8_t) (1 + (opcode - CBC_EXT_REST_INITIALIZER));
@@ -2233,9 +2639,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_object_value (array_p);
           continue;
         }
-        case VM_OC_INITIALIZER_PUSH_PROP:
+        VM_CASE (VM_OC_INITIALIZER_PUSH_PROP):
         {
-          result = vm_op_get_value (stack_top_p[-1], left_value);
+          result = vm_op_get_value (byte_code_start_p, stack_top_p[-1], left_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2245,7 +2651,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_SPREAD_ARGUMENTS:
+        VM_CASE (VM_OC_SPREAD_ARGUMENTS):
         {
           uint8_t arguments_list_len = *byte_code_p++;
           stack_top_p -= arguments_list_len;
@@ -2266,7 +2672,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_CREATE_GENERATOR:
+        VM_CASE (VM_OC_CREATE_GENERATOR):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
@@ -2277,14 +2683,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           return ecma_make_object_value ((ecma_object_t *) executable_object_p);
         }
-        case VM_OC_YIELD:
+        VM_CASE (VM_OC_YIELD):
         {
           frame_ctx_p->call_operation = VM_EXEC_RETURN;
           frame_ctx_p->byte_code_p = byte_code_p;
           frame_ctx_p->stack_top_p = --stack_top_p;
           return *stack_top_p;
         }
-        case VM_OC_ASYNC_YIELD:
+        VM_CASE (VM_OC_ASYNC_YIELD):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2295,7 +2701,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = --stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ASYNC_YIELD_ITERATOR:
+        VM_CASE (VM_OC_ASYNC_YIELD_ITERATOR):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2335,7 +2741,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_AWAIT:
+        VM_CASE (VM_OC_AWAIT):
         {
           if (JERRY_UNLIKELY (frame_ctx_p->block_result == ECMA_VALUE_UNDEFINED))
           {
@@ -2353,7 +2759,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_GENERATOR_AWAIT:
+        VM_CASE (VM_OC_GENERATOR_AWAIT):
         {
           ecma_extended_object_t *async_generator_object_p = VM_GET_EXECUTABLE_OBJECT (frame_ctx_p);
 
@@ -2369,7 +2775,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_EXT_RETURN:
+        VM_CASE (VM_OC_EXT_RETURN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
@@ -2383,7 +2789,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           goto error;
         }
-        case VM_OC_ASYNC_EXIT:
+        VM_CASE (VM_OC_ASYNC_EXIT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2429,7 +2835,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->call_operation = VM_NO_EXEC_OP;
           return result;
         }
-        case VM_OC_STRING_CONCAT:
+        VM_CASE (VM_OC_STRING_CONCAT):
         {
           ecma_string_t *left_str_p = ecma_op_to_string (left_value);
 
@@ -2453,7 +2859,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_make_string_value (result_str_p);
           goto free_both_values;
         }
-        case VM_OC_GET_TEMPLATE_OBJECT:
+        VM_CASE (VM_OC_GET_TEMPLATE_OBJECT):
         {
           uint8_t tagged_idx = *byte_code_p++;
           ecma_collection_t *collection_p = ecma_compiled_code_get_tagged_template_collection (bytecode_header_p);
@@ -2462,7 +2868,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_copy_value (collection_p->buffer_p[tagged_idx]);
           continue;
         }
-        case VM_OC_PUSH_NEW_TARGET:
+        VM_CASE (VM_OC_PUSH_NEW_TARGET):
         {
           ecma_object_t *new_target_object = JERRY_CONTEXT (current_new_target);
           if (new_target_object == NULL)
@@ -2476,7 +2882,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_REQUIRE_OBJECT_COERCIBLE:
+        VM_CASE (VM_OC_REQUIRE_OBJECT_COERCIBLE):
         {
           result = ecma_op_check_object_coercible (stack_top_p[-1]);
 
@@ -2486,7 +2892,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_ASSIGN_SUPER:
+        VM_CASE (VM_OC_ASSIGN_SUPER):
         {
           result = opfunc_assign_super_reference (&stack_top_p, frame_ctx_p, opcode_data);
 
@@ -2497,12 +2903,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           *stack_top_p++ = ECMA_VALUE_ARRAY_HOLE;
           continue;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           uint16_t values_length = *byte_code_p++;
           stack_top_p -= values_length;
@@ -2525,7 +2931,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_ESNEXT) */
           continue;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -2562,9 +2968,9 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_PROP_GET:
+        VM_CASE (VM_OC_PROP_GET):
         {
-          result = vm_op_get_value (left_value, right_value);
+          result = vm_op_get_value (byte_code_start_p, left_value, right_value);
 
           if (ECMA_IS_VALUE_ERROR (result))
           {
@@ -2574,7 +2980,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -2598,12 +3004,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
-          result = vm_op_get_value (left_value,
+          result = vm_op_get_value (byte_code_start_p,
+                                    left_value,
                                     right_value);
 
           if (opcode < CBC_PRE_INCR)
@@ -2627,10 +3034,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           right_value = ECMA_VALUE_UNDEFINED;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
           ecma_number_t result_number;
@@ -2750,13 +3157,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_MOV_IDENT:
+        VM_CASE (VM_OC_MOV_IDENT):
         {
           uint32_t literal_index;
 
@@ -2769,14 +3176,14 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           VM_GET_REGISTER (frame_ctx_p, literal_index) = left_value;
           continue;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -2784,7 +3191,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           break;
         }
-        case VM_OC_RETURN:
+        VM_CASE (VM_OC_RETURN):
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -2800,7 +3207,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           jcontext_raise_exception (left_value);
 
@@ -2808,12 +3215,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           left_value = ECMA_VALUE_UNDEFINED;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           result = ecma_raise_reference_error (ECMA_ERR_MSG ("Undefined reference."));
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           JERRY_CONTEXT (status_flags) |= ECMA_STATUS_DIRECT_EVAL;
           JERRY_ASSERT ((*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK)
@@ -2822,21 +3229,21 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                             && byte_code_p[1] <= CBC_EXT_SPREAD_CALL_PROP_BLOCK));
           continue;
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           frame_ctx_p->call_operation = VM_EXEC_CALL;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           frame_ctx_p->call_operation = VM_EXEC_CONSTRUCT;
           frame_ctx_p->byte_code_p = byte_code_start_p;
           frame_ctx_p->stack_top_p = stack_top_p;
           return ECMA_VALUE_UNDEFINED;
         }
-        case VM_OC_ERROR:
+        VM_CASE (VM_OC_ERROR):
         {
           JERRY_ASSERT (frame_ctx_p->byte_code_p[1] == CBC_EXT_ERROR);
 #if ENABLED (JERRY_DEBUGGER)
@@ -2846,7 +3253,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = ECMA_VALUE_ERROR;
           goto error;
         }
-        case VM_OC_RESOLVE_BASE_FOR_CALL:
+        VM_CASE (VM_OC_RESOLVE_BASE_FOR_CALL):
         {
           ecma_value_t this_value = stack_top_p[-3];
 
@@ -2864,7 +3271,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           result = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -2878,7 +3285,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -2903,12 +3310,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           continue;
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -2922,10 +3329,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_free_value (value);
           continue;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t opcode_flags = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
           ecma_value_t value = *(--stack_top_p);
@@ -2952,7 +3359,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_BRANCH_IF_NULLISH:
+        VM_CASE (VM_OC_BRANCH_IF_NULLISH):
         {
           left_value = stack_top_p[-1];
 
@@ -2965,8 +3372,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_PLUS:
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_PLUS):
+        VM_CASE (VM_OC_MINUS):
         {
           result = opfunc_unary_operation (left_value, VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_PLUS);
 
@@ -2978,13 +3385,13 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           *stack_top_p++ = ecma_make_boolean_value (!ecma_op_to_boolean (left_value));
           JERRY_ASSERT (ecma_is_value_boolean (stack_top_p[-1]));
           goto free_left_value;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3005,12 +3412,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_VOID):
         {
           *stack_top_p++ = ECMA_VALUE_UNDEFINED;
           goto free_left_value;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -3046,7 +3453,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           result = opfunc_typeof (left_value);
 
@@ -3058,7 +3465,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_left_value;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3099,7 +3506,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
           JERRY_STATIC_ASSERT (ECMA_INTEGER_NUMBER_MAX * 2 <= INT32_MAX
                                && ECMA_INTEGER_NUMBER_MIN * 2 >= INT32_MIN,
@@ -3149,7 +3556,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3212,7 +3619,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3229,7 +3636,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           JERRY_ASSERT (!ECMA_IS_VALUE_ERROR (left_value)
                         && !ECMA_IS_VALUE_ERROR (right_value));
@@ -3263,8 +3670,119 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
+        VM_CASE (VM_OC_ARITHMETIC_SET_IDENT):
+        {
+          JERRY_ASSERT (opcode >= CBC_ADD_TWO_LITERALS_SET_IDENT
+                        && opcode <= CBC_MULTIPLY_TWO_LITERALS_SET_IDENT_BLOCK);
+
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+            ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+            if (opcode < CBC_SUBTRACT_TWO_LITERALS_SET_IDENT)
+            {
+              result = ecma_make_int32_value ((int32_t) (left_integer + right_integer));
+            }
+            else if (opcode < CBC_MULTIPLY_TWO_LITERALS_SET_IDENT)
+            {
+              result = ecma_make_int32_value ((int32_t) (left_integer - right_integer));
+            }
+            else if (-ECMA_INTEGER_MULTIPLY_MAX <= left_integer
+                     && left_integer <= ECMA_INTEGER_MULTIPLY_MAX
+                     && -ECMA_INTEGER_MULTIPLY_MAX <= right_integer
+                     && right_integer <= ECMA_INTEGER_MULTIPLY_MAX
+                     && left_value != 0
+                     && right_value != 0)
+            {
+              result = ecma_integer_multiply (left_integer, right_integer);
+            }
+            else
+            {
+              result = ecma_make_number_value ((ecma_number_t) left_integer * (ecma_number_t) right_integer);
+            }
+          }
+          else if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t left_number = ecma_get_number_from_value (left_value);
+            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+            if (opcode < CBC_SUBTRACT_TWO_LITERALS_SET_IDENT)
+            {
+              result = ecma_make_number_value (left_number + right_number);
+            }
+            else if (opcode < CBC_MULTIPLY_TWO_LITERALS_SET_IDENT)
+            {
+              result = ecma_make_number_value (left_number - right_number);
+            }
+            else
+            {
+              result = ecma_make_number_value (left_number * right_number);
+            }
+          }
+          else
+          {
+            if (opcode < CBC_SUBTRACT_TWO_LITERALS_SET_IDENT)
+            {
+              result = opfunc_addition (left_value, right_value);
+            }
+            else
+            {
+              result = do_number_arithmetic ((opcode < CBC_MULTIPLY_TWO_LITERALS_SET_IDENT
+                                              ? NUMBER_ARITHMETIC_SUBTRACTION
+                                              : NUMBER_ARITHMETIC_MULTIPLICATION),
+                                             left_value,
+                                             right_value);
+            }
+
+            if (ECMA_IS_VALUE_ERROR (result))
+            {
+              goto error;
+            }
+          }
+
+          /* The identifier is assigned here rather than by the common VM_OC_PUT_IDENT
+           * code, so the frequent register case needs no further flag checks. */
+          uint32_t literal_index;
+
+          READ_LITERAL_INDEX (literal_index);
+
+          if (literal_index < register_end)
+          {
+            ecma_fast_free_value (VM_GET_REGISTER (frame_ctx_p, literal_index));
+            VM_GET_REGISTER (frame_ctx_p, literal_index) = result;
+
+            if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+            {
+              goto free_both_values;
+            }
+
+            result = ecma_fast_copy_value (result);
+            break;
+          }
+
+          ecma_value_t put_value_result = vm_op_put_ident (frame_ctx_p,
+                                                           byte_code_p,
+                                                           literal_start_p[literal_index],
+                                                           result,
+                                                           is_strict);
+
+          if (ECMA_IS_VALUE_ERROR (put_value_result))
+          {
+            ecma_free_value (result);
+            result = put_value_result;
+            goto error;
+          }
+
+          if (!(opcode_data & (VM_OC_PUT_STACK | VM_OC_PUT_BLOCK)))
+          {
+            ecma_fast_free_value (result);
+            goto free_both_values;
+          }
+          break;
+        }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_EXP:
+        VM_CASE (VM_OC_EXP):
         {
           result = do_number_arithmetic (NUMBER_ARITHMETIC_EXPONENTIATION,
                                          left_value,
@@ -3279,7 +3797,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           goto free_both_values;
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3291,7 +3809,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           result = opfunc_equality (left_value, right_value);
 
@@ -3303,7 +3821,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = ecma_invert_boolean_value (result);
           goto free_both_values;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3312,7 +3830,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           bool is_equal = ecma_op_strict_equality_compare (left_value, right_value);
 
@@ -3321,7 +3839,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3344,7 +3862,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3367,7 +3885,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3390,7 +3908,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3415,7 +3933,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3440,7 +3958,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           JERRY_STATIC_ASSERT (ECMA_DIRECT_TYPE_MASK == ((1 << ECMA_DIRECT_SHIFT) - 1),
                                direct_type_mask_must_fill_all_bits_before_the_value_starts);
@@ -3465,7 +3983,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_LESS):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3528,7 +4046,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3558,7 +4076,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3588,7 +4106,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           if (ecma_are_values_integer_numbers (left_value, right_value))
           {
@@ -3618,7 +4136,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           result = opfunc_in (left_value, right_value);
 
@@ -3630,7 +4148,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           result = opfunc_instanceof (left_value, right_value);
 
@@ -3642,7 +4160,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *stack_top_p++ = result;
           goto free_both_values;
         }
-        case VM_OC_BLOCK_CREATE_CONTEXT:
+        VM_CASE (VM_OC_BLOCK_CREATE_CONTEXT):
         {
 #if ENABLED (JERRY_ESNEXT)
           ecma_value_t *stack_context_top_p;
@@ -3691,7 +4209,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           continue;
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_value_t value = *(--stack_top_p);
           ecma_object_t *object_p;
@@ -3725,7 +4243,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           continue;
         }
-        case VM_OC_FOR_IN_INIT:
+        VM_CASE (VM_OC_FOR_IN_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3760,7 +4278,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 #endif /* ENABLED (JERRY_ESNEXT) */
           continue;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
 
@@ -3776,7 +4294,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           context_top_p[-3]++;
           continue;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -3819,7 +4337,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_ESNEXT)
-        case VM_OC_FOR_OF_INIT:
+        VM_CASE (VM_OC_FOR_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -3880,7 +4398,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_FOR_OF_GET_NEXT:
+        VM_CASE (VM_OC_FOR_OF_GET_NEXT):
         {
           ecma_value_t *context_top_p = VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth;
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (context_top_p[-1]) == VM_CONTEXT_FOR_OF
@@ -3891,7 +4409,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           context_top_p[-2] = ECMA_VALUE_UNDEFINED;
           continue;
         }
-        case VM_OC_FOR_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_OF);
@@ -3930,7 +4448,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FOR_AWAIT_OF_INIT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_INIT):
         {
           ecma_value_t value = *(--stack_top_p);
 
@@ -4001,7 +4519,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           return result;
         }
-        case VM_OC_FOR_AWAIT_OF_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_AWAIT_OF_HAS_NEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (VM_GET_CONTEXT_TYPE (stack_top_p[-1]) == VM_CONTEXT_FOR_AWAIT_OF);
@@ -4033,7 +4551,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           return ECMA_VALUE_UNDEFINED;
         }
 #endif /* ENABLED (JERRY_ESNEXT) */
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -4046,7 +4564,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           continue;
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -4055,7 +4573,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           continue;
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -4079,7 +4597,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           continue;
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!(stack_top_p[-1] & VM_CONTEXT_CLOSE_ITERATOR));
@@ -4168,7 +4686,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           continue;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (VM_GET_REGISTERS (frame_ctx_p) + register_end + frame_ctx_p->context_depth == stack_top_p);
           JERRY_ASSERT (!jcontext_has_pending_exception ());
@@ -4215,7 +4733,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #if ENABLED (JERRY_DEBUGGER)
-        case VM_OC_BREAKPOINT_ENABLED:
+        VM_CASE (VM_OC_BREAKPOINT_ENABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -4236,7 +4754,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           continue;
         }
-        case VM_OC_BREAKPOINT_DISABLED:
+        VM_CASE (VM_OC_BREAKPOINT_DISABLED):
         {
           if (JERRY_CONTEXT (debugger_flags) & JERRY_DEBUGGER_VM_IGNORE)
           {
@@ -4290,7 +4808,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
 #endif /* ENABLED (JERRY_DEBUGGER) */
 #if ENABLED (JERRY_LINE_INFO)
-        case VM_OC_LINE:
+        VM_CASE (VM_OC_LINE):
         {
           uint32_t value = 0;
           uint8_t byte;
@@ -4306,7 +4824,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           continue;
         }
 #endif /* ENABLED (JERRY_LINE_INFO) */
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         default:
         {
           JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_NONE);
@@ -4335,12 +4853,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_string_t *var_name_str_p = ecma_get_string_from_value (literal_start_p[literal_index]);
-
-          ecma_value_t put_value_result = ecma_op_put_value_lex_env_base (frame_ctx_p->lex_env_p,
-                                                                          var_name_str_p,
-                                                                          is_strict,
-                                                                          result);
+          ecma_value_t put_value_result = vm_op_put_ident (frame_ctx_p,
+                                                           byte_code_p,
+                                                           literal_start_p[literal_index],
+                                                           result,
+                                                           is_strict);
 
           if (ECMA_IS_VALUE_ERROR (put_value_result))
           {
@@ -4374,7 +4891,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
         else
         {
-          ecma_value_t set_value_result = vm_op_set_value (base,
+          ecma_value_t set_value_result = vm_op_set_value (byte_code_start_p,
+                                                           base,
                                                            property,
                                                            result,
                                                            is_strict);
@@ -4583,6 +5101,10 @@ finish:
   }
 } /* vm_loop */
 
+#if ENABLED (JERRY_VM_COMPUTED_GOTO)
+#pragma GCC diagnostic pop
+#endif /* ENABLED (JERRY_VM_COMPUTED_GOTO) */
+
 #undef READ_LITERAL
 #undef READ_LITERAL_INDEX
 
@@ -4764,7 +5286,7 @@ vm_execute (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
  *
  * @return ecma value
  */
-ecma_value_t
+inline ecma_value_t JERRY_ATTR_ALWAYS_INLINE
 vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data header */
         ecma_value_t this_binding_value, /**< value of 'ThisBinding' */
         ecma_object_t *lex_env_p, /**< lexical environment to use */
@@ -4786,19 +5308,36 @@ vm_run (const ecma_compiled_code_t *bytecode_header_p, /**< byte-code data heade
   }
 
   frame_size = frame_size * sizeof (ecma_value_t) + sizeof (vm_frame_ctx_t);
+
+#if (JERRY_VM_STACK_SEGMENT_SIZE != 0)
+  frame_ctx_p = vm_stack_alloc_frame (frame_size);
+
+  if (JERRY_UNLIKELY (frame_ctx_p == NULL))
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG ("Maximum call stack size exceeded."));
+  }
+#else /* JERRY_VM_STACK_SEGMENT_SIZE == 0 */
   frame_size = (frame_size + sizeof (uintptr_t) - 1) / sizeof (uintptr_t);
 
   /* Use JERRY_MAX() to avoid array declaration with size 0. */
   JERRY_VLA (uintptr_t, stack, frame_size);
 
   frame_ctx_p = (vm_frame_ctx_t *) stack;
+#endif /* (JERRY_VM_STACK_SEGMENT_SIZE != 0) */
 
   frame_ctx_p->bytecode_header_p = bytecode_header_p;
   frame_ctx_p->lex_env_p = lex_env_p;
   frame_ctx_p->this_binding = this_binding_value;
 
   vm_init_exec (frame_ctx_p, arg_list_p, arg_list_len);
+
+#if (JERRY_VM_STACK_SEGMENT_SIZE != 0)
+  ecma_value_t completion_value = vm_execute (frame_ctx_p);
+  vm_stack_free_frame (frame_ctx_p);
+  return completion_value;
+#else /* JERRY_VM_STACK_SEGMENT_SIZE == 0 */
   return vm_execute (frame_ctx_p);
+#endif /* (JERRY_VM_STACK_SEGMENT_SIZE != 0) */
 } /* vm_run */
 
 /**
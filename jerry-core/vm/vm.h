@@ -185,6 +185,7 @@ typedef enum
   VM_OC_MUL,                     /**< mul */
   VM_OC_DIV,                     /**< div */
   VM_OC_MOD,                     /**< mod */
+  VM_OC_ARITHMETIC_SET_IDENT,    /**< arithmetic operation on two literals assigned to an identifier */
 #if ENABLED (JERRY_ESNEXT)
   VM_OC_EXP,                     /**< exponentiation */
 #endif /* ENABLED (JERRY_ESNEXT) */
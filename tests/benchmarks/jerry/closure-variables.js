@@ -0,0 +1,50 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Captured variables several scopes away from the accessing closure: each access
+ * skips lexical environments which contain many other bindings. */
+function makeModule ()
+{
+  var a0 = 0, a1 = 1, a2 = 2, a3 = 3, a4 = 4, a5 = 5, a6 = 6, a7 = 7;
+  var total = 0;
+
+  function makeCounter (step)
+  {
+    var b0 = 0, b1 = 1, b2 = 2, b3 = 3, b4 = 4, b5 = 5;
+    var count = 0;
+
+    return function () {
+      {
+        let c0 = 0, c1 = 1, c2 = 2;
+        count += step;
+        total += a7 + count;
+        return c2;
+      }
+    };
+  }
+
+  return {
+    counter: makeCounter (2),
+    getTotal: function () { return total; }
+  };
+}
+
+var module = makeModule ();
+
+for (var i = 0; i < 300000; i++)
+{
+  module.counter ();
+}
+
+assert (module.getTotal () === 300000 * 7 + 300000 * 300001);
@@ -0,0 +1,72 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* A long linked list, whose nodes are allocated in reverse order. */
+var list = null;
+
+for (var i = 0; i < 5000; i++)
+{
+  list = { next: list, value: i };
+}
+
+/* A deep tree whose nodes have a few children each. */
+function create_tree (depth)
+{
+  var node = { children: [] };
+
+  if (depth > 0)
+  {
+    node.children.push (create_tree (depth - 1));
+    node.children.push ({ leaf: depth });
+  }
+
+  return node;
+}
+
+var tree = create_tree (1000);
+
+/* Allocate garbage to trigger many collections while the graphs above are alive. */
+for (var i = 0; i < 100; i++)
+{
+  var garbage = [];
+
+  for (var k = 0; k < 500; k++)
+  {
+    garbage.push ({ index: k });
+  }
+}
+
+var sum = 0;
+
+for (var node = list; node !== null; node = node.next)
+{
+  sum += node.value;
+}
+
+if (sum !== 5000 * 4999 / 2)
+{
+  throw new Error ("Wrong sum");
+}
+
+var depth = 0;
+
+for (var node = tree; node.children.length > 0; node = node.children[0])
+{
+  depth++;
+}
+
+if (depth !== 1000)
+{
+  throw new Error ("Wrong depth");
+}
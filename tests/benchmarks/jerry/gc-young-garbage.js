@@ -0,0 +1,40 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* A large long-lived object graph. */
+var table = [];
+
+for (var i = 0; i < 4000; i++)
+{
+  table.push ({ id: i, name: "item" + i, tags: [i, i + 1] });
+}
+
+/* Many short-lived objects: most garbage collections only need to visit these. */
+var sum = 0;
+
+for (var i = 0; i < 200000; i++)
+{
+  var point = { x: i, y: i + 1 };
+  var pair = [point, { x: point.y, y: point.x }];
+  sum += pair[1].x - pair[0].x;
+
+  if ((i % 1000) === 0)
+  {
+    table[i % table.length].last = point;
+  }
+}
+
+assert (sum === 200000);
+assert (table.length === 4000);
+assert (table[0].last.x === 196000);
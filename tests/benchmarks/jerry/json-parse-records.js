@@ -0,0 +1,34 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* An array of records, where every record has the same property names. */
+var records = [];
+for (var i = 0; i < 500; i++)
+{
+  records.push ('{"identifier":' + i + ',"description":"item ' + i + '","enabled":' + (i % 2 === 0)
+                + ',"coordinates":[' + i + ',' + (i * 2) + '],"category":"c' + (i % 10) + '"}');
+}
+
+var text = "[" + records.join (",") + "]";
+var count = 0;
+
+for (var i = 0; i < 20; i++)
+{
+  var parsed = JSON.parse (text);
+  count += parsed[i].coordinates[1];
+}
+
+assert (parsed.length === 500);
+assert (count === 380);
@@ -0,0 +1,36 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var map = new Map ();
+
+for (var i = 0; i < 10000; i++)
+{
+  map.set ("key_" + i, i);
+}
+
+for (var j = 0; j < 5; j++)
+{
+  for (var i = 0; i < 10000; i++)
+  {
+    if (map.get ("key_" + i) !== i)
+    {
+      throw new Error ("Wrong value");
+    }
+  }
+}
+
+for (var i = 0; i < 10000; i += 2)
+{
+  map.delete ("key_" + i);
+}
@@ -0,0 +1,27 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Parse a source with many small functions. Each function has its own distinct
+ * string and number literals, which are all registered in the literal storage. */
+var source = "";
+
+for (var i = 0; i < 2000; i++)
+{
+  source += "(function () { return ['s" + i + "', " + (i + 0.5) + "]; });\n";
+}
+
+for (var i = 0; i < 10; i++)
+{
+  Function (source);
+}
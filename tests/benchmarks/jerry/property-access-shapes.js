@@ -0,0 +1,48 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Many objects with the same property layout: too many for the lookup cache,
+ * but a single cached property position serves all of them. */
+function Record (id)
+{
+  this.id = id;
+  this.count = 0;
+  this.weight = id % 10;
+  this.total = 0;
+}
+
+var records = [];
+
+for (var i = 0; i < 2000; i++)
+{
+  records.push (new Record (i));
+}
+
+var sum = 0;
+
+for (var round = 0; round < 100; round++)
+{
+  for (var i = 0; i < records.length; i++)
+  {
+    var r = records[i];
+    r.count++;
+    r.total += r.weight;
+    sum += r.id & 1;
+  }
+}
+
+assert (sum === 100 * 1000);
+assert (records[1999].count === 100);
+assert (records[1999].total === 900);
@@ -0,0 +1,38 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Patterns with nested quantifiers, which take exponential time with backtracking. */
+var input = "";
+for (var i = 0; i < 20; i++)
+{
+  input += "a";
+}
+input += "!";
+
+var patterns = [/(a+)+b/, /(a|aa)+$/, /^(\w+\s?)*$/, /(?:a|a)*c/];
+var count = 0;
+
+for (var i = 0; i < 4; i++)
+{
+  for (var j = 0; j < patterns.length; j++)
+  {
+    if (patterns[j].exec (input) === null)
+    {
+      count++;
+    }
+  }
+}
+
+assert (count === 16);
@@ -0,0 +1,33 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Dynamic patterns built from a set of keywords, which are used repeatedly. */
+var keywords = ["error", "warning", "info", "debug", "trace", "fatal", "notice", "alert",
+                "critical", "emergency", "verbose", "silent"];
+var line = "2020-01-01 12:00:00 [warning] disk usage is 91% on /dev/sda1";
+var count = 0;
+
+for (var i = 0; i < 3000; i++)
+{
+  var keyword = keywords[i % keywords.length];
+  var re = new RegExp ("\\[(" + keyword + ")\\]\\s+(\\w+)\\s+(?:usage|load)\\s+is\\s+(\\d+)%", "i");
+
+  if (re.test (line))
+  {
+    count++;
+  }
+}
+
+assert (count === 250);
@@ -0,0 +1,43 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Searching a log where matches are rare. */
+var log = "";
+for (var i = 0; i < 2000; i++)
+{
+  log += "info: request " + i + " served in " + (i % 97) + " ms\n";
+
+  if (i % 500 === 499)
+  {
+    log += "ERROR: " + i + " failed\n";
+  }
+}
+
+var count = 0;
+
+for (var i = 0; i < 10; i++)
+{
+  var re = /ERROR: (\d+)/g;
+
+  while (re.exec (log) !== null)
+  {
+    count++;
+  }
+
+  count += log.replace (/[#@]\w+/g, "").length === log.length ? 1 : 0;
+  count += log.split (/ERROR/).length;
+}
+
+assert (count === 100);
@@ -0,0 +1,40 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Long strings built by repeated concatenation: each append copies
+ * the whole string unless the concatenation is deferred. */
+var total = 0;
+
+for (var round = 0; round < 10; round++)
+{
+  var str = "";
+
+  for (var i = 0; i < 10000; i++)
+  {
+    str += "item" + i + ",";
+  }
+
+  var html = "<ul>";
+
+  for (var i = 0; i < 400; i++)
+  {
+    html = html + "<li>" + str.charAt (i) + "</li>";
+  }
+
+  html += "</ul>";
+  total += str.length + html.length;
+}
+
+assert (total === 10 * (88890 + 4009));
@@ -0,0 +1,45 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Creates many property names and strings, which are hashed when they are created. */
+var keys = [];
+for (var i = 0; i < 1000; i++)
+{
+  keys.push ("property_" + i + "_of_generated_object");
+}
+
+var json = JSON.stringify (keys);
+var total = 0;
+
+for (var round = 0; round < 100; round++)
+{
+  var obj = {};
+  for (var i = 0; i < keys.length; i++)
+  {
+    obj[keys[i] + round] = i;
+  }
+
+  var parsed = JSON.parse (json);
+  total += parsed.length;
+
+  var text = "";
+  for (var i = 0; i < 200; i++)
+  {
+    text = "line " + i + ": " + keys[i] + keys[i + 200] + keys[i + 400] + "\n";
+    total += text.length > 0 ? 1 : 0;
+  }
+}
+
+assert (total === 100 * (1000 + 200));
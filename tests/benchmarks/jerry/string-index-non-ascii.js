@@ -0,0 +1,37 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Character loops over non-ASCII text: the position of each character
+ * is found by decoding the text from its start unless it is cached. */
+var text = "";
+for (var i = 0; i < 4000; i++)
+{
+  text += (i % 8 === 0) ? "é" : String.fromCharCode (0x61 + i % 26);
+}
+
+var vowels = 0;
+for (var round = 0; round < 5; round++)
+{
+  for (var i = 0; i < text.length; i++)
+  {
+    var c = text.charCodeAt (i);
+    if (c === 0xe9 || text[i] === "a")
+    {
+      vowels++;
+    }
+  }
+}
+
+assert (vowels === 5 * (500 + 115));
@@ -0,0 +1,32 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Searches in a log text of about 100 KB. */
+var log = "";
+for (var i = 0; i < 2500; i++)
+{
+  log += "2020-01-01 12:00:" + (i % 60) + " INFO request " + i + " served\n";
+}
+
+var found = 0;
+for (var round = 0; round < 20; round++)
+{
+  found += log.split ("\n").length;
+  found += (log.indexOf ("request 2499 served") > 0) ? 1 : 0;
+  found += (log.lastIndexOf ("2020-01-01 12:00:0 INFO request 0 ") === 0) ? 1 : 0;
+  found += log.includes ("ERROR") ? 1 : 0;
+}
+
+assert (found === 20 * (2501 + 2));
@@ -0,0 +1,128 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Global variables. */
+var a = 6, b = 7, r;
+
+r = a + b;
+assert(r === 13);
+r = a - b;
+assert(r === -1);
+r = a * b;
+assert(r === 42);
+
+/* Completion value of the statement. */
+assert(eval("r = a * b") === 42);
+assert(eval("r = a - b; r = a + b") === 13);
+
+/* Result of the assignment is used. */
+var s = (r = a * b) + 1;
+assert(r === 42 && s === 43);
+
+/* Integer overflow and negative zero. */
+a = 0x3fffffff;
+b = 0x3fffffff;
+r = a + b;
+assert(r === 0x7ffffffe);
+r = a * b;
+assert(r === 0x3fffffff * 0x3fffffff);
+a = -4;
+b = 0;
+r = a * b;
+assert(1 / r === -Infinity);
+r = b - b;
+assert(1 / r === Infinity);
+
+/* Floating point and non-number operands. */
+a = 1.5;
+b = 2;
+r = a * b;
+assert(r === 3);
+r = a - b;
+assert(r === -0.5);
+a = "4";
+r = a + b;
+assert(r === "42");
+r = a * b;
+assert(r === 8);
+r = a - b;
+assert(r === 2);
+
+var o = { valueOf: function () { return 5; } };
+r = o * b;
+assert(r === 10);
+r = b - o;
+assert(r === -3);
+
+/* Local variables stored in registers. */
+function f (x, y)
+{
+  var z;
+  z = x * y;
+  var w = x + y;
+  w = w - z;
+  return z + w;
+}
+
+assert(f(3, 4) === 7);
+assert(f(0.5, 2) === 2.5);
+assert(f("3", 4) === 34);
+
+/* Operand evaluation order and errors. */
+function g ()
+{
+  var q = 1;
+  try
+  {
+    q = q * undeclared_variable;
+    assert(false);
+  }
+  catch (e)
+  {
+    assert(e instanceof ReferenceError);
+    assert(q === 1);
+  }
+
+  var log = [];
+  var p = { valueOf: function () { log.push("p"); return 2; } };
+  var t = { valueOf: function () { log.push("t"); return 3; } };
+  q = p - t;
+  assert(q === -1);
+  assert(log.join() === "p,t");
+}
+
+g();
+
+/* Assignment through a with statement. */
+var target = { v: 0 };
+with (target)
+{
+  v = a * b;
+}
+assert(target.v === 8);
+
+/* Assignment in strict mode to an undeclared variable. */
+(function () {
+  "use strict";
+  var x = 2, y = 3;
+  try
+  {
+    undeclared_strict = x * y;
+    assert(false);
+  }
+  catch (e)
+  {
+    assert(e instanceof ReferenceError);
+  }
+})();
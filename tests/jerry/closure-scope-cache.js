@@ -0,0 +1,161 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var x = "global";
+
+/* Captured variables of different activations. */
+function counter (start)
+{
+  var count = start;
+  return function () {
+    count = count + 1;
+    return count;
+  };
+}
+
+var c1 = counter (0);
+var c2 = counter (100);
+
+for (var i = 0; i < 10; i++)
+{
+  assert (c1 () === i + 1);
+  assert (c2 () === i + 101);
+}
+
+/* Direct eval extends the lexical environment of the enclosing function. */
+function evalShadow (doEval)
+{
+  var get = function () { return x; };
+  var set = function (v) { x = v; };
+  var before = get ();
+
+  if (doEval)
+  {
+    eval ("var x = 'local'");
+  }
+
+  set ("set");
+  return [before, get (), get, set];
+}
+
+var withEval = evalShadow (true);
+assert (withEval[0] === "global");
+assert (withEval[1] === "set");
+assert (x === "global");
+
+var withoutEval = evalShadow (false);
+assert (withoutEval[0] === "global");
+assert (withoutEval[1] === "set");
+assert (x === "set");
+x = "global";
+
+for (var i = 0; i < 5; i++)
+{
+  withEval[3] ("eval" + i);
+  assert (withEval[2] () === "eval" + i);
+  assert (withoutEval[2] () === "global");
+  assert (x === "global");
+}
+
+/* Eval in an enclosing function of the closure. */
+function evalOuter ()
+{
+  function middle ()
+  {
+    return function () { return x; };
+  }
+
+  var inner = middle ();
+  var first = inner ();
+  eval ("var x = 'outer'");
+  return [first, inner ()];
+}
+
+for (var i = 0; i < 3; i++)
+{
+  var result = evalOuter ();
+  assert (result[0] === "global");
+  assert (result[1] === "outer");
+}
+
+/* Delete a variable created by eval. */
+function evalDelete ()
+{
+  eval ("var x = 'deletable'");
+  var get = function () { return x; };
+  assert (get () === "deletable");
+  assert (delete x);
+  assert (get () === "global");
+}
+
+evalDelete ();
+
+/* Object bound environments can gain properties at any time. */
+var scope = {};
+var withGet;
+
+with (scope)
+{
+  withGet = function () { return x; };
+}
+
+assert (withGet () === "global");
+scope.x = "with";
+assert (withGet () === "with");
+delete scope.x;
+assert (withGet () === "global");
+
+/* Function name bindings are immutable. */
+var named = function fn () {
+  fn = 1;
+  return fn;
+};
+
+assert (named () === named);
+assert (named () === named);
+
+var namedStrict = function fn () {
+  "use strict";
+  fn = 1;
+};
+
+for (var i = 0; i < 3; i++)
+{
+  try
+  {
+    namedStrict ();
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof TypeError);
+  }
+}
+
+/* Environments with many bindings. */
+var source = "var sum = function () { return ";
+var declarations = "";
+
+for (var i = 0; i < 64; i++)
+{
+  declarations += "var v" + i + " = " + i + ";";
+  source += (i > 0 ? " + " : "") + "v" + i;
+}
+
+var many = Function (declarations + source + "; }; v63 = 100; return sum;") ();
+
+for (var i = 0; i < 3; i++)
+{
+  assert (many () === 63 * 64 / 2 - 63 + 100);
+}
@@ -0,0 +1,128 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Deeply nested closures with block scopes. */
+function nest (a)
+{
+  var b = a * 2;
+  {
+    let c = b + 1;
+    return function (d) {
+      {
+        let e = d;
+        return function () {
+          b++;
+          return a + b + c + e;
+        };
+      }
+    };
+  }
+}
+
+var n = nest (1) (10);
+
+for (var i = 0; i < 5; i++)
+{
+  assert (n () === 1 + (3 + i) + 3 + 10);
+}
+
+/* Temporal dead zone and constants. */
+function tdz ()
+{
+  var get = function () { return value; };
+  var set = function (v) { value = v; };
+
+  for (var i = 0; i < 3; i++)
+  {
+    try
+    {
+      get ();
+      assert (false);
+    }
+    catch (e)
+    {
+      assert (e instanceof ReferenceError);
+    }
+
+    try
+    {
+      set (1);
+      assert (false);
+    }
+    catch (e)
+    {
+      assert (e instanceof ReferenceError);
+    }
+  }
+
+  let value = 5;
+  assert (get () === 5);
+  set (6);
+  assert (get () === 6);
+
+  const constant = 7;
+  var setConstant = function () { constant = 8; };
+
+  for (var i = 0; i < 3; i++)
+  {
+    try
+    {
+      setConstant ();
+      assert (false);
+    }
+    catch (e)
+    {
+      assert (e instanceof TypeError);
+    }
+  }
+
+  assert (constant === 7);
+}
+
+tdz ();
+
+/* Each iteration of a for-let loop has its own binding. */
+var closures = [];
+
+for (let j = 0; j < 5; j++)
+{
+  closures.push (function () { return j; });
+}
+
+for (var i = 0; i < 5; i++)
+{
+  assert (closures[i] () === i);
+}
+
+/* Methods of classes. */
+class Accumulator
+{
+  constructor ()
+  {
+    let total = 0;
+    this.add = (v) => { total += v; return total; };
+  }
+
+  static make ()
+  {
+    return new Accumulator ();
+  }
+}
+
+var acc = Accumulator.make ();
+
+for (var i = 1; i <= 5; i++)
+{
+  assert (acc.add (i) === i * (i + 1) / 2);
+}
@@ -0,0 +1,123 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* Containers with many entries are searched through a hash index. */
+var m = new Map ();
+
+for (var i = 0; i < 1000; i++)
+{
+  m.set (i, i * 2);
+}
+
+for (var i = 0; i < 1000; i++)
+{
+  assert (m.get (i) === i * 2);
+}
+
+for (var i = 0; i < 1000; i += 2)
+{
+  assert (m.delete (i));
+}
+
+assert (m.size === 500);
+
+for (var i = 0; i < 1000; i++)
+{
+  assert (m.has (i) === (i % 2 === 1));
+}
+
+/* Keys which are equal according to SameValueZero. */
+m.set (-0, "zero");
+assert (m.get (0) === "zero");
+assert (m.get (-0) === "zero");
+m.set (NaN, "nan");
+assert (m.get (0 / 0) === "nan");
+m.set (1.5, "float");
+assert (m.get (3 / 2) === "float");
+m.set (2147483648, "large");
+assert (m.get (2147483647 + 1) === "large");
+m.set ("str" + 1, "string");
+assert (m.get ("str1") === "string");
+
+var obj = {};
+m.set (obj, "object");
+assert (m.get (obj) === "object");
+assert (m.get ({}) === undefined);
+
+var sym = Symbol ();
+m.set (sym, "symbol");
+assert (m.get (sym) === "symbol");
+
+/* Iteration order is kept when entries are deleted during iteration. */
+var iterator = m.keys ();
+assert (iterator.next ().value === 1);
+m.delete (3);
+assert (iterator.next ().value === 5);
+
+m.clear ();
+assert (m.size === 0);
+assert (m.get (5) === undefined);
+
+for (var i = 0; i < 100; i++)
+{
+  m.set ("key" + i, i);
+}
+
+assert (iterator.next ().value === "key0");
+
+/* Deleted buckets are reused. */
+var set = new Set ();
+
+for (var j = 0; j < 20; j++)
+{
+  for (var i = 0; i < 50; i++)
+  {
+    set.add (i);
+  }
+
+  assert (set.size === 50);
+
+  for (var i = 0; i < 50; i++)
+  {
+    assert (set.delete (i));
+  }
+}
+
+assert (set.size === 0);
+
+/* Weak containers. */
+var weak_map = new WeakMap ();
+var weak_set = new WeakSet ();
+var keys = [];
+
+for (var i = 0; i < 200; i++)
+{
+  var key = {};
+  keys.push (key);
+  weak_map.set (key, i);
+  weak_set.add (key);
+}
+
+keys.length = 100;
+gc ();
+
+for (var i = 0; i < 100; i++)
+{
+  assert (weak_map.get (keys[i]) === i);
+  assert (weak_set.has (keys[i]));
+}
+
+keys = null;
+gc ();
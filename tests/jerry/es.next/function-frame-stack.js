@@ -0,0 +1,55 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function sum (n)
+{
+  var a = n, b = n * 2, c = n * 3;
+  return n === 0 ? 0 : (a + b + c) / 6 + sum (n - 1);
+}
+
+/* Generators are resumed from their own frames. */
+function* counter (n)
+{
+  for (var i = 0; i < n; i++)
+  {
+    yield sum (i);
+  }
+}
+
+function drain (depth)
+{
+  if (depth > 0)
+  {
+    return drain (depth - 1);
+  }
+
+  var values = [];
+  var gen = counter (10);
+
+  for (var value of gen)
+  {
+    values.push (value);
+  }
+
+  return values;
+}
+
+var gen = counter (50);
+var values = drain (200);
+
+for (var i = 0; i < 10; i++)
+{
+  assert (values[i] === i * (i + 1) / 2);
+  assert (gen.next ().value === i * (i + 1) / 2);
+}
@@ -0,0 +1,101 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Long-lived objects which receive references to newly allocated objects. */
+var holder = { value: null };
+var array = [];
+var map = new Map ();
+var proto_holder = {};
+var accessor_holder = {};
+var counter = 0;
+
+function churn ()
+{
+  /* Allocate enough short-lived objects to trigger garbage collections. */
+  for (var i = 0; i < 2000; i++)
+  {
+    var garbage = { a: { b: [i, { c: i }] } };
+    garbage.a.b.push (garbage);
+  }
+}
+
+function next_generator ()
+{
+  var gen = (function* () {
+    var saved = yield;
+    while (true)
+    {
+      saved = yield saved;
+    }
+  }) ();
+  gen.next ();
+  return gen;
+}
+
+var generator = next_generator ();
+var closure_value = null;
+
+function set_closure_value (value)
+{
+  closure_value = value;
+}
+
+for (var round = 0; round < 20; round++)
+{
+  churn ();
+
+  holder.value = { round: round, data: [round] };
+  holder["dynamic" + round] = { round: round };
+  array[round] = { round: round };
+  array.push ([round]);
+  map.set (round, { round: round });
+  Object.setPrototypeOf (proto_holder, { round: round });
+  Object.defineProperty (accessor_holder, "prop" + round, { get: function () { return round; } });
+  set_closure_value ({ round: round });
+
+  var yielded = generator.next ({ round: round }).value;
+  assert (yielded.round === round);
+
+  churn ();
+
+  assert (holder.value.round === round);
+  assert (holder.value.data[0] === round);
+  assert (holder["dynamic" + round].round === round);
+  assert (array[round].round === round);
+  assert (map.get (round).round === round);
+  assert (Object.getPrototypeOf (proto_holder).round === round);
+  assert (accessor_holder["prop" + round] === round);
+  assert (closure_value.round === round);
+  counter++;
+}
+
+assert (counter === 20);
+
+for (var round = 0; round < 20; round++)
+{
+  assert (holder["dynamic" + round].round === round);
+  assert (map.get (round).round === round);
+}
+
+var promise = new Promise (function (resolve) {
+  churn ();
+  resolve ({ value: 42 });
+});
+
+promise.then (function (result) {
+  churn ();
+  assert (result.value === 42);
+});
+
+churn ();
@@ -0,0 +1,41 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Unicode patterns. */
+var emoji = "ab😀cd😁";
+assert (/😁/u.exec (emoji).index === 6);
+assert (/\ude00/u.exec (emoji) === null);
+assert (/\ude00/.exec (emoji).index === 3);
+assert (/c/u.exec (emoji).index === 4);
+assert ("a😀b😀c".split (/😀/u).join ("|") === "a|b|c");
+
+/* Sticky patterns are not prefiltered. */
+assert (/\d+/y.exec ("a12") === null);
+
+var re = /b+/y;
+re.lastIndex = 1;
+assert (re.exec ("abbc")[0] === "bb");
+assert (re.lastIndex === 3);
+
+/* Split only prefilters the splitter when it uses the built-in exec method. */
+var calls = 0;
+class CountingRegExp extends RegExp {
+  exec (str) {
+    calls++;
+    return super.exec (str);
+  }
+}
+assert ("aaxaa".split (new CountingRegExp ("x")).join ("|") === "aa|aa");
+assert (calls === 5);
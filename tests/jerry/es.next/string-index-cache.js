@@ -0,0 +1,33 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Code points and the string iterator of strings with surrogate pairs. */
+var pairs = "";
+for (var i = 0; i < 100; i++)
+{
+  pairs += "😀a";
+}
+
+assert (pairs.codePointAt (150) === 0x1f600);
+assert (pairs.codePointAt (151) === 0xde00);
+assert (pairs.codePointAt (152) === 0x61);
+
+var count = 0;
+for (var ch of pairs)
+{
+  assert (ch === (count % 2 ? "a" : "😀"));
+  count++;
+}
+
+assert (count === 200);
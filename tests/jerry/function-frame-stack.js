@@ -0,0 +1,88 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Recursion which crosses several frame stack segments. */
+function sum (n)
+{
+  var a = n, b = n * 2, c = n * 3;
+  return n === 0 ? 0 : (a + b + c) / 6 + sum (n - 1);
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (sum (400) === 400 * 401 / 2);
+}
+
+/* A frame which is larger than a segment. */
+var source = "var s = 0;";
+
+for (var i = 0; i < 3000; i++)
+{
+  source += "var v" + i + " = " + i + ";";
+}
+
+for (var i = 0; i < 3000; i++)
+{
+  source += "s += v" + i + ";";
+}
+
+var large = Function (source + "return s;");
+
+function callLarge (n)
+{
+  return n === 0 ? large () : callLarge (n - 1);
+}
+
+for (var i = 0; i < 20; i++)
+{
+  assert (callLarge (i) === 2999 * 3000 / 2);
+}
+
+/* Frames of functions called by built-in routines. */
+function nested (depth)
+{
+  if (depth === 0)
+  {
+    return [1, 2, 3];
+  }
+
+  return nested (depth - 1).map (function (x) { return x + 1; });
+}
+
+var result = nested (100);
+assert (result[0] === 101 && result[1] === 102 && result[2] === 103);
+
+/* Errors thrown through many frames. */
+function thrower (n)
+{
+  if (n === 0)
+  {
+    throw new Error ("bottom");
+  }
+
+  return thrower (n - 1);
+}
+
+for (var i = 0; i < 3; i++)
+{
+  try
+  {
+    thrower (300);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e.message === "bottom");
+  }
+}
@@ -0,0 +1,153 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function getX (o)
+{
+  return o.x;
+}
+
+function setX (o, value)
+{
+  o.x = value;
+}
+
+/* Objects with different property layouts at the same access site. */
+var layouts = [
+  { x: 1 },
+  { a: 0, x: 2 },
+  { a: 0, b: 0, c: 0, x: 3 },
+  { a: 0, b: 0, c: 0, d: 0, e: 0, x: 4 },
+];
+
+for (var round = 0; round < 3; round++)
+{
+  for (var i = 0; i < layouts.length; i++)
+  {
+    assert (getX (layouts[i]) === i + 1);
+    setX (layouts[i], getX (layouts[i]) * 10);
+    assert (getX (layouts[i]) === (i + 1) * 10);
+    setX (layouts[i], i + 1);
+  }
+}
+
+/* Missing own properties are looked up in the prototype chain. */
+var proto = { x: "proto" };
+var child = Object.create (proto);
+assert (getX (child) === "proto");
+assert (getX ({}) === undefined);
+assert (getX (Object.create (null)) === undefined);
+
+/* Shadowing a prototype property after the site was used. */
+child.x = "own";
+assert (getX (child) === "own");
+assert (proto.x === "proto");
+delete child.x;
+assert (getX (child) === "proto");
+
+/* Deleting and re-adding properties changes the layout. */
+var o = { x: 1, y: 2, z: 3 };
+assert (getX (o) === 1);
+delete o.x;
+assert (getX (o) === undefined);
+o.x = 5;
+assert (getX (o) === 5);
+setX (o, 6);
+assert (o.x === 6 && o.y === 2 && o.z === 3);
+
+/* Accessors are not handled by the cache. */
+var log = [];
+var acc = { get x () { log.push ("get"); return 7; }, set x (v) { log.push ("set " + v); } };
+assert (getX (acc) === 7);
+setX (acc, 8);
+assert (getX (acc) === 7);
+assert (log.join () === "get,set 8,get");
+
+var inherited = Object.create (acc);
+setX (inherited, 9);
+assert (log[log.length - 1] === "set 9");
+assert (!inherited.hasOwnProperty ("x"));
+
+/* Non-writable and frozen properties. */
+var ro = { x: 1 };
+Object.defineProperty (ro, "x", { writable: false });
+setX (ro, 2);
+assert (getX (ro) === 1);
+
+var frozen = Object.freeze ({ x: 3 });
+setX (frozen, 4);
+assert (getX (frozen) === 3);
+
+(function () {
+  "use strict";
+  var frozenStrict = Object.freeze ({ x: 5 });
+  try {
+    frozenStrict.x = 6;
+    assert (false);
+  } catch (e) {
+    assert (e instanceof TypeError);
+  }
+  assert (frozenStrict.x === 5);
+}) ();
+
+/* Property names which are not the same string instance. */
+var name = "lo" + "ng_property_name_" + 1;
+var dyn = {};
+dyn["long_property_name_1"] = 10;
+for (var i = 0; i < 3; i++)
+{
+  assert (dyn[name] === 10 + i);
+  dyn[name] = 11 + i;
+  assert (dyn.long_property_name_1 === 11 + i);
+}
+
+/* Integer keys. */
+var keyed = { 0: "zero", 1: "one" };
+for (var i = 0; i < 4; i++)
+{
+  assert (keyed[i % 2] === (i % 2 ? "one" : "zero"));
+}
+
+/* Objects with many properties (property hashmap). */
+var big = {};
+for (var i = 0; i < 64; i++)
+{
+  big["p" + i] = i;
+}
+big.x = "big";
+assert (getX (big) === "big");
+setX (big, "bigger");
+assert (big.x === "bigger");
+
+/* Built-in and non-general objects. */
+assert (getX (Math) === undefined);
+var arr = [1, 2];
+arr.x = "array";
+assert (getX (arr) === "array");
+setX (arr, "array2");
+assert (arr.x === "array2");
+
+var fn = function () {};
+setX (fn, "function");
+assert (getX (fn) === "function");
+
+/* Updates are visible through all references. */
+var shared = { x: 0 };
+var alias = shared;
+for (var i = 0; i < 5; i++)
+{
+  shared.x++;
+  alias.x += 2;
+}
+assert (shared.x === 15);
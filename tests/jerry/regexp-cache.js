@@ -0,0 +1,76 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* More dynamic patterns than the size of the cache are used repeatedly. */
+var patterns = [];
+for (var i = 0; i < 100; i++)
+{
+  patterns.push ("x" + i + "(\\d+)");
+}
+
+for (var round = 0; round < 3; round++)
+{
+  for (var i = 0; i < patterns.length; i++)
+  {
+    var re = new RegExp (patterns[i], round === 1 ? "g" : "");
+    var match = re.exec ("x1 x" + i + "42");
+    assert (match[0] === "x" + i + "42");
+    assert (match[1] === "42");
+    assert (re.global === (round === 1));
+    assert (re.source === patterns[i]);
+  }
+}
+
+/* Patterns which only differ in their flags are cached separately. */
+var lower = new RegExp ("abc");
+var ignoreCase = new RegExp ("abc", "i");
+var multiline = new RegExp ("^abc", "m");
+assert (lower.exec ("ABC") === null);
+assert (ignoreCase.exec ("ABC")[0] === "ABC");
+assert (new RegExp ("^abc").exec ("x\nabc") === null);
+assert (multiline.exec ("x\nabc")[0] === "abc");
+assert (new RegExp ("abc", "i").exec ("aBc")[0] === "aBc");
+
+/* Objects created from the same cached pattern have separate states. */
+var first = new RegExp ("a", "g");
+var second = new RegExp ("a", "g");
+assert (first.exec ("aaa").index === 0);
+assert (first.exec ("aaa").index === 1);
+assert (second.exec ("aaa").index === 0);
+assert (first.lastIndex === 2);
+assert (second.lastIndex === 1);
+
+/* Cached patterns survive the release of the objects which use them. */
+for (var i = 0; i < 50; i++)
+{
+  var objects = [];
+  for (var j = 0; j < 200; j++)
+  {
+    objects.push ({ value: j });
+  }
+
+  assert (new RegExp ("y" + (i % 5) + "+").test ("ay" + (i % 5) + "b"));
+  assert (new RegExp ("y" + (i % 5) + "+").exec ("b") === null);
+}
+
+/* Equal patterns in different string representations. */
+var built = "";
+for (var i = 0; i < 10; i++)
+{
+  built += "é";
+}
+
+assert (new RegExp (built).test ("éééééééééé"));
+assert (new RegExp ("éééééééééé").test (built));
+assert (!new RegExp (built + "x").test (built));
@@ -0,0 +1,78 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* These patterns take exponential time with backtracking. */
+var a30 = "";
+for (var i = 0; i < 30; i++)
+{
+  a30 += "a";
+}
+
+assert (/(a+)+b/.exec (a30 + "c") === null);
+assert (/(a|aa)+$/.exec (a30 + "!") === null);
+assert (/^(\w+\s?)*$/.exec (a30 + " " + a30 + "!") === null);
+
+var match = /(a+)+b/.exec (a30 + "b");
+assert (match[0] === a30 + "b");
+assert (match[1] === a30);
+assert (match.index === 0);
+
+match = /(x+x+)+y/.exec ("z" + a30.replace (/a/g, "x") + "zxxy");
+assert (match[0] === "xxy");
+assert (match[1] === "xx");
+assert (match.index === 32);
+
+match = /((a)|(b))+c/.exec ("ab" + a30 + "bc");
+assert (match[0] === "ab" + a30 + "bc");
+assert (match[1] === "b");
+assert (match[2] === undefined);
+assert (match[3] === "b");
+
+match = /(a*?)(a+)+?$/.exec (a30);
+assert (match[1] === "");
+assert (match[2] === a30);
+
+/* Matching continues after the steps of the backtracking matcher are exhausted. */
+var re = /(a+)+b|(c)/g;
+var input = a30 + "c" + a30 + "ab" + a30 + "c";
+var results = [];
+
+while ((match = re.exec (input)) !== null)
+{
+  results.push (match.index + ":" + match[0].length + ":" + match[1] + ":" + match[2]);
+}
+
+assert (results.join () === "30:1:undefined:c,31:32:" + a30 + "a:undefined,93:1:undefined:c");
+assert (re.lastIndex === 0);
+
+assert ((a30 + "c" + a30 + "b").replace (/(a+)+b/, "[$1]") === a30 + "c[" + a30 + "]");
+assert ((a30 + "x" + a30).split (/(a+)+x/).length === 3);
+assert ((a30 + "c").search (/(a+)+b/) === -1);
+
+/* Unicode and case insensitive patterns. */
+var smiles = "";
+for (var i = 0; i < 30; i++)
+{
+  smiles += "😀";
+}
+
+assert (/(\u{1F600}+)+x/u.exec (smiles + "y") === null);
+match = /(.+)+y/u.exec ("a" + smiles + "y");
+assert (match[1] === "a" + smiles);
+assert (/(A+)+\b/i.exec (a30 + "!")[1] === a30);
+assert (/^(?:a+)+$/m.exec ("b\n" + a30 + "\nc")[0] === a30);
+
+/* Patterns with backreferences or lookaheads are still matched by backtracking. */
+assert (/(a+)\1b/.exec ("aaaab")[1] === "aa");
+assert (/(?=(a+))a*b\1/.exec ("baaabac")[0] === "aba");
@@ -0,0 +1,88 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Literal prefixes. */
+var log = "info: started\nwarning: slow\nERROR: 42 failed\ninfo: retry\nERROR: 7 failed\n";
+var match = /ERROR: (\d+)/.exec (log);
+assert (match[1] === "42");
+assert (match.index === 28);
+assert (/ERROR: (\d+) passed/.exec (log) === null);
+assert (/^ERROR/m.exec (log).index === 28);
+assert (/\bslow\b/.exec (log).index === 23);
+assert (/ERROR|warning/.exec (log)[0] === "warning");
+
+var re = /ERROR: (\d+)/g;
+var results = [];
+while ((match = re.exec (log)) !== null)
+{
+  results.push (match.index + ":" + match[1] + ":" + re.lastIndex);
+}
+assert (results.join () === "28:42:37,57:7:65");
+assert (re.lastIndex === 0);
+
+re = /ERROR/g;
+re.lastIndex = 29;
+assert (re.exec (log).index === 57);
+re.lastIndex = 58;
+assert (re.exec (log) === null);
+assert (re.lastIndex === 0);
+
+/* First character sets. */
+assert (/[xyz]\d/.exec ("abcdefz1").index === 6);
+assert (/(?:foo|bar)baz/.exec ("foobarbarbaz").index === 6);
+assert (/a?b+c/.exec ("xxbbbc")[0] === "bbbc");
+assert (/(a|)b/.exec ("xxb")[0] === "b");
+assert (/\d{2,}/.exec ("a1b22c333")[0] === "22");
+assert (/[^a]b/.exec ("aaabcb")[0] === "cb");
+assert (/.b/.exec ("\nab")[0] === "ab");
+assert (/(?=a)\w/.exec ("xya").index === 2);
+
+/* Case insensitive patterns. */
+assert (/error/i.exec (log).index === 28);
+assert (/[K]elvin/i.exec ("x\u212aelvin") === null);
+assert (/kelvin/i.exec ("x\u212aelvin Kelvin").index === 8);
+assert (/été/i.exec ("ÉTÉ").index === 0);
+
+/* Non-ASCII input keeps the correct character indices. */
+var text = "árvíztűrő tükörfúrógép €12 €345";
+match = /€(\d+)/.exec (text);
+assert (match.index === 23);
+assert (match[1] === "12");
+
+re = /€(\d+)/g;
+results = [];
+while ((match = re.exec (text)) !== null)
+{
+  results.push (match.index + ":" + re.lastIndex);
+}
+assert (results.join () === "23:26,27:31");
+assert (/p €/.exec (text).index === 21);
+assert (/[€ő]\d/.exec (text).index === 23);
+
+/* Replace and split. */
+assert (log.replace (/ERROR: (\d+)/g, "E$1").split ("\n")[2] === "E42 failed");
+assert (log.replace (/ERROR/, "E").indexOf ("E: 42") === 28);
+assert (text.replace (/€(\d+)/g, "$1EUR") === text.replace ("€12", "12EUR").replace ("€345", "345EUR"));
+assert ("a1b22c".replace (/\d+/g, "#") === "a#b#c");
+assert ("no match".replace (/xyz/g, "!") === "no match");
+
+var parts = "one, two,three ,  four".split (/\s*,\s*/);
+assert (parts.join ("|") === "one|two|three|four");
+parts = text.split (/€/);
+assert (parts.length === 3);
+assert (parts[1] === "12 ");
+assert ("abc".split (/x/).length === 1);
+assert ("a-b-c".split (/(-)/).join ("|") === "a|-|b|-|c");
+assert ("a-b-c".split (/-/, 2).join ("|") === "a|b");
+assert ("é€1é€2".split (/€(\d)/).join ("|") === "é|1|é|2|");
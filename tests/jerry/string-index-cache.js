@@ -0,0 +1,83 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Sequential access of a non-ASCII string. */
+var str = "";
+var codes = [];
+for (var i = 0; i < 1000; i++)
+{
+  var code = (i % 3 === 0) ? 0x61 + i % 26 : ((i % 3 === 1) ? 0x3b1 + i % 20 : 0x4e00 + i);
+  codes.push (code);
+  str += String.fromCharCode (code);
+}
+
+assert (str.length === 1000);
+
+for (var i = 0; i < str.length; i++)
+{
+  assert (str.charCodeAt (i) === codes[i]);
+  assert (str[i] === String.fromCharCode (codes[i]));
+}
+
+/* Backward and random access. */
+for (var i = str.length - 1; i >= 0; i--)
+{
+  assert (str.charCodeAt (i) === codes[i]);
+}
+
+for (var i = 0; i < 1000; i++)
+{
+  var index = (i * 7919) % 1000;
+  assert (str.charAt (index) === String.fromCharCode (codes[index]));
+}
+
+/* Surrogate pairs are two code units. */
+var pairs = "";
+for (var i = 0; i < 100; i++)
+{
+  pairs += "😀a";
+}
+
+assert (pairs.length === 300);
+assert (pairs.charCodeAt (297) === 0xd83d);
+assert (pairs.charCodeAt (298) === 0xde00);
+assert (pairs.charCodeAt (299) === 0x61);
+
+/* Several strings are indexed alternately and freed. */
+var strings = [];
+for (var i = 0; i < 10; i++)
+{
+  var s = "";
+  for (var j = 0; j < 200; j++)
+  {
+    s += String.fromCharCode (0x100 + i * 200 + j);
+  }
+  strings.push (s);
+}
+
+for (var j = 0; j < 200; j++)
+{
+  for (var i = 0; i < 10; i++)
+  {
+    assert (strings[i].charCodeAt (j) === 0x100 + i * 200 + j);
+  }
+}
+
+strings = null;
+
+/* Out of range indices. */
+assert (str.charAt (1000) === "");
+assert (isNaN (str.charCodeAt (1000)));
+assert (str[1000] === undefined);
@@ -0,0 +1,122 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Repeated appends of short strings. */
+var str = "";
+for (var i = 0; i < 2000; i++)
+{
+  str += "ab";
+}
+
+assert (str.length === 4000);
+assert (str.charAt (0) === "a");
+assert (str.charAt (3999) === "b");
+assert (str.indexOf ("ba") === 1);
+assert (str.lastIndexOf ("ab") === 3998);
+
+/* Repeated appends of long strings. */
+var part = "";
+for (var i = 0; i < 300; i++)
+{
+  part += String.fromCharCode (48 + i % 10);
+}
+
+var long_str = "";
+for (var i = 0; i < 50; i++)
+{
+  long_str += part;
+}
+
+assert (long_str.length === 15000);
+assert (long_str.substring (299, 302) === "901");
+assert (long_str.slice (-3) === "789");
+
+/* Equality and hashing of strings with different representations. */
+var a = "";
+var b = "";
+for (var i = 0; i < 500; i++)
+{
+  a += "x";
+  b = "x" + b;
+}
+
+assert (a === b);
+assert (a.length === 500);
+
+var obj = {};
+obj[a] = 1;
+assert (obj[b] === 1);
+assert (b in obj);
+
+var c = part + part;
+var d = part;
+d += part;
+assert (c === d);
+assert (c !== d + "a");
+
+/* Prepends and appends. */
+var e = part;
+e = "<" + e + ">";
+assert (e.length === 302);
+assert (e[0] === "<" && e[301] === ">");
+
+/* Non-ASCII characters. */
+var u = "";
+for (var i = 0; i < 300; i++)
+{
+  u += "é中";
+}
+
+assert (u.length === 600);
+assert (u.charCodeAt (0) === 0xe9);
+assert (u.charCodeAt (599) === 0x4e2d);
+assert (u.split ("中").length === 301);
+
+var s = "\ud83d";
+for (var i = 0; i < 300; i++)
+{
+  s += "x";
+}
+s += "\ude00";
+assert (s.length === 302);
+assert (s.charCodeAt (301) === 0xde00);
+
+/* Shared parts. */
+var base = "";
+for (var i = 0; i < 400; i++)
+{
+  base += "q";
+}
+
+var left = base + "left";
+var right = base + "right";
+base = null;
+assert (left.length === 404 && right.length === 405);
+assert (left.slice (-4) === "left" && right.slice (-5) === "right");
+
+/* Numbers are converted to strings. */
+var n = part + 12345;
+assert (n.length === 305);
+assert (n.slice (-5) === "12345");
+assert (Number (n.slice (300)) === 12345);
+
+/* Long strings are released iteratively. */
+var chain = "";
+for (var i = 0; i < 10000; i++)
+{
+  chain += "abcdefghij";
+}
+
+assert (chain.length === 100000);
+chain = null;
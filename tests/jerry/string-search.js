@@ -0,0 +1,78 @@
+// Copyright JS Foundation and other contributors, http://js.foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Long haystacks and needles are searched with skip tables. */
+var text = "";
+for (var i = 0; i < 1000; i++)
+{
+  text += "line " + i + ": status=ok\n";
+}
+
+assert (text.indexOf ("line 500: status=ok") === text.indexOf ("line 500:"));
+assert (text.indexOf ("line 999: status=ok\n") === text.length - 20);
+assert (text.indexOf ("line 1000") === -1);
+assert (text.indexOf ("status=fail") === -1);
+assert (text.lastIndexOf ("line 0: status") === 0);
+assert (text.lastIndexOf ("status=ok") === text.length - 10);
+assert (text.lastIndexOf ("line 5", 100) === 90);
+assert (text.lastIndexOf ("status", 5) === -1);
+assert (text.indexOf ("status", text.length - 5) === -1);
+assert (text.split ("\n").length === 1001);
+assert (text.split ("status=ok\n").length === 1001);
+assert (text.split (": status=ok\nline ", 3).length === 3);
+assert (text.replace ("line 10: status=ok", "X").indexOf ("\nX\n") !== -1);
+
+var needle = "";
+for (var i = 0; i < 300; i++)
+{
+  needle += String.fromCharCode (0x61 + i % 7);
+}
+
+var hay = "x" + needle.substring (1) + "yy" + needle + "zz" + needle;
+assert (hay.indexOf (needle) === 302);
+assert (hay.lastIndexOf (needle) === 604);
+assert (hay.lastIndexOf (needle, 603) === 302);
+assert (hay.indexOf (needle, 303) === 604);
+
+/* Non-ASCII haystacks: the results are code unit indices. */
+var str = "";
+for (var i = 0; i < 400; i++)
+{
+  str += "αβγ-" + i + ";";
+}
+
+var pos = str.indexOf ("αβγ-250;");
+assert (pos > 0);
+assert (str.substring (pos, pos + 8) === "αβγ-250;");
+assert (str.indexOf ("-250;", pos) === pos + 3);
+assert (str.indexOf ("-250;", pos + 4) === -1);
+assert (str.lastIndexOf ("αβγ") === str.length - 8);
+assert (str.lastIndexOf ("αβγ-10;", pos) < pos);
+assert (str.split ("γ-").length === 401);
+assert (str.replace ("β", function (match, index) { return "[" + index + "]"; }).substring (0, 6) === "α[1]γ-");
+
+/* Surrogates are matched by code units. */
+var emoji = "a😀b😀c";
+assert (emoji.indexOf ("\ude00") === 2);
+assert (emoji.lastIndexOf ("\ud83d") === 4);
+assert (emoji.indexOf ("😀c") === 4);
+assert (emoji.split ("😀").length === 3);
+
+/* Empty strings. */
+assert (text.indexOf ("") === 0);
+assert (text.indexOf ("", 10) === 10);
+assert (text.lastIndexOf ("") === text.length);
+assert ("abc".split ("").length === 3);
+assert ("abc".replace ("", "x") === "xabc");
@@ -0,0 +1,153 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jerryscript.h"
+#include "test-common.h"
+
+static int native_free_count = 0;
+
+static void
+native_free_callback (void *native_p)
+{
+  (void) native_p;
+  native_free_count++;
+} /* native_free_callback */
+
+static const jerry_object_native_info_t native_info =
+{
+  .free_cb = native_free_callback,
+};
+
+static jerry_value_t
+create_native_object (void)
+{
+  jerry_value_t object = jerry_create_object ();
+  jerry_set_object_native_pointer (object, NULL, &native_info);
+  return object;
+} /* create_native_object */
+
+static jerry_value_t
+eval_source (const char *source_p)
+{
+  jerry_value_t result = jerry_eval ((const jerry_char_t *) source_p, strlen (source_p), JERRY_PARSE_NO_OPTS);
+  TEST_ASSERT (!jerry_value_is_error (result));
+  return result;
+} /* eval_source */
+
+static void
+set_global_property (const char *name_p, jerry_value_t value)
+{
+  jerry_value_t global = jerry_get_global_object ();
+  jerry_value_t name = jerry_create_string ((const jerry_char_t *) name_p);
+  jerry_value_t result = jerry_set_property (global, name, value);
+  TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+
+  jerry_release_value (result);
+  jerry_release_value (name);
+  jerry_release_value (global);
+} /* set_global_property */
+
+static void
+finish_gc_cycle (void)
+{
+  int steps = 0;
+
+  while (!jerry_gc_step (0))
+  {
+    steps++;
+    TEST_ASSERT (steps < 100000);
+  }
+} /* finish_gc_cycle */
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  jerry_init (JERRY_INIT_EMPTY);
+
+  /* Unreferenced objects are freed by a completed cycle. */
+  jerry_value_t object = create_native_object ();
+  jerry_release_value (object);
+
+  finish_gc_cycle ();
+  TEST_ASSERT (native_free_count == 1);
+
+  /* Objects which are only reachable through stores made during a cycle must survive it. */
+  jerry_value_t result = eval_source ("var list = null;\n"
+                                      "for (var i = 0; i < 2000; i++) { list = { next: list, value: i }; }\n"
+                                      "var holder = { items: [], last: { child: { value: 0 } } };\n"
+                                      "function mutate () {\n"
+                                      "  var node = list;\n"
+                                      "  for (var i = 0; i < 10 && node.next !== null; i++) { node = node.next; }\n"
+                                      "  var detached = node.next;\n"
+                                      "  node.next = null;\n"
+                                      "  if (detached !== null) { holder.items.push (detached); }\n"
+                                      "  holder.last = { child: { value: holder.items.length } };\n"
+                                      "}\n"
+                                      "function count () {\n"
+                                      "  var sum = 0;\n"
+                                      "  function walk (node) {\n"
+                                      "    for (; node !== null; node = node.next) { sum += node.value; }\n"
+                                      "  }\n"
+                                      "  walk (list);\n"
+                                      "  holder.items.forEach (walk);\n"
+                                      "  return sum + holder.last.child.value - holder.items.length;\n"
+                                      "}\n"
+                                      "count ()");
+  TEST_ASSERT (jerry_value_is_number (result));
+  double expected_sum = jerry_get_number_value (result);
+  jerry_release_value (result);
+
+  object = create_native_object ();
+  set_global_property ("native", object);
+  jerry_release_value (object);
+
+  int steps = 0;
+  bool completed = jerry_gc_step (0);
+
+  while (!completed)
+  {
+    result = eval_source ("mutate (); native = { moved: native }; native = native.moved");
+    jerry_release_value (result);
+
+    completed = jerry_gc_step (0);
+    steps++;
+    TEST_ASSERT (steps < 100000);
+  }
+
+  finish_gc_cycle ();
+
+  result = eval_source ("count ()");
+  TEST_ASSERT (jerry_value_is_number (result));
+  TEST_ASSERT (jerry_get_number_value (result) == expected_sum);
+  jerry_release_value (result);
+
+  TEST_ASSERT (native_free_count == 1);
+
+  /* A full collection supersedes the pending cycle. */
+  jerry_gc_step (0);
+  jerry_gc (JERRY_GC_PRESSURE_HIGH);
+  TEST_ASSERT (native_free_count == 1);
+
+  result = eval_source ("native = null");
+  jerry_release_value (result);
+
+  finish_gc_cycle ();
+  TEST_ASSERT (native_free_count == 2);
+
+  jerry_cleanup ();
+  return 0;
+} /* main */
@@ -20,6 +20,13 @@
 
 #define BASIC_SIZE (64)
 
+#define FRAGMENT_COUNT (256)
+
+/**
+ * Size of the n-th block of the fragmentation test
+ */
+#define FRAGMENT_SIZE(n) ((size_t) (((n) * 7) % 61 + 1) * 4)
+
 int
 main (void)
 {
@@ -103,6 +110,48 @@ main (void)
     jmem_heap_free_block (block4_p, BASIC_SIZE * 2);
   }
 
+  {
+    uint8_t *blocks_p[FRAGMENT_COUNT];
+
+    for (size_t i = 0; i < FRAGMENT_COUNT; i++)
+    {
+      blocks_p[i] = (uint8_t *) jmem_heap_alloc_block (FRAGMENT_SIZE (i));
+      memset (blocks_p[i], (int) (i & 0xff), FRAGMENT_SIZE (i));
+    }
+
+    /* Punch holes of various sizes into the heap. */
+    for (size_t i = 1; i < FRAGMENT_COUNT; i += 2)
+    {
+      jmem_heap_free_block (blocks_p[i], FRAGMENT_SIZE (i));
+    }
+
+    /* Refill the holes with blocks of different sizes. */
+    for (size_t i = 1; i < FRAGMENT_COUNT; i += 2)
+    {
+      blocks_p[i] = (uint8_t *) jmem_heap_alloc_block (FRAGMENT_SIZE (i + 1));
+      memset (blocks_p[i], (int) (i & 0xff), FRAGMENT_SIZE (i + 1));
+    }
+
+    for (size_t i = 0; i < FRAGMENT_COUNT; i++)
+    {
+      size_t size = FRAGMENT_SIZE ((i & 0x1) ? i + 1 : i);
+
+      for (size_t j = 0; j < size; j++)
+      {
+        TEST_ASSERT (blocks_p[i][j] == (uint8_t) i);
+      }
+    }
+
+    /* Release the blocks from both ends, so the free regions are merged in both directions. */
+    for (size_t i = 0; i < FRAGMENT_COUNT / 2; i++)
+    {
+      size_t last = FRAGMENT_COUNT - 1 - i;
+
+      jmem_heap_free_block (blocks_p[i], FRAGMENT_SIZE ((i & 0x1) ? i + 1 : i));
+      jmem_heap_free_block (blocks_p[last], FRAGMENT_SIZE ((last & 0x1) ? last + 1 : last));
+    }
+  }
+
   ecma_finalize ();
   jmem_finalize ();
 
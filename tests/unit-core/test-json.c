@@ -32,6 +32,58 @@ custom_to_json (const jerry_value_t func_obj_val, /**< function object */
   return jerry_create_error (JERRY_ERROR_URI, (const jerry_char_t *) "Error");
 } /* custom_to_json */
 
+static jerry_value_t
+parse_in_chunks (const char *json_p, /**< json string */
+                 jerry_size_t chunk_size) /**< size of the chunks passed to the parser */
+{
+  jerry_json_parser_t *parser_p = jerry_json_parser_create ();
+  TEST_ASSERT (parser_p != NULL);
+
+  jerry_size_t json_size = (jerry_size_t) strlen (json_p);
+
+  for (jerry_size_t offset = 0; offset < json_size; offset += chunk_size)
+  {
+    jerry_size_t size = json_size - offset;
+
+    if (size > chunk_size)
+    {
+      size = chunk_size;
+    }
+
+    jerry_value_t result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) json_p + offset, size);
+
+    if (jerry_value_is_error (result))
+    {
+      jerry_release_value (result);
+      break;
+    }
+
+    TEST_ASSERT (jerry_value_is_boolean (result) && jerry_get_boolean_value (result));
+
+    /* Empty chunks are allowed anywhere. */
+    result = jerry_json_parser_feed (parser_p, NULL, 0);
+    TEST_ASSERT (!jerry_value_is_error (result));
+    jerry_release_value (result);
+  }
+
+  return jerry_json_parser_finish (parser_p);
+} /* parse_in_chunks */
+
+static bool
+compare_json_strings (jerry_value_t value1, /**< first value */
+                      jerry_value_t value2) /**< second value */
+{
+  jerry_value_t json1 = jerry_json_stringify (value1);
+  jerry_value_t json2 = jerry_json_stringify (value2);
+  jerry_value_t result = jerry_binary_operation (JERRY_BIN_OP_STRICT_EQUAL, json1, json2);
+  bool is_equal = jerry_value_is_boolean (result) && jerry_get_boolean_value (result);
+
+  jerry_release_value (result);
+  jerry_release_value (json2);
+  jerry_release_value (json1);
+  return is_equal;
+} /* compare_json_strings */
+
 int
 main (void)
 {
@@ -97,6 +149,63 @@ main (void)
     jerry_release_value (parsed_json);
   }
 
+  /* Incremental JSON parser checks */
+  {
+    const char *json_p = ("{\"name\": \"J\\u00f3hn \\\"\\\\\","
+                          " \"items\": [1, -2.5e-3, true, false, null, \"\xc3\xa9\"],"
+                          " \"nested\": [{\"name\": 0}, {\"name\": 1, \"\": {}}], \"12\": [[]]}");
+    jerry_value_t expected = jerry_json_parse ((const jerry_char_t *) json_p, (jerry_size_t) strlen (json_p));
+    TEST_ASSERT (jerry_value_is_object (expected));
+
+    for (jerry_size_t chunk_size = 1; chunk_size <= strlen (json_p); chunk_size++)
+    {
+      jerry_value_t parsed_json = parse_in_chunks (json_p, chunk_size);
+      TEST_ASSERT (jerry_value_is_object (parsed_json));
+      TEST_ASSERT (compare_json_strings (parsed_json, expected));
+      jerry_release_value (parsed_json);
+    }
+
+    jerry_release_value (expected);
+
+    const char *invalid_json_p[] =
+    {
+      "", " ", "{", "[1, 2", "\"abc", "\"ab\\", "tru", "truex", "[1 2]", "{\"a\" 1}", "[1, ]", "-", "1.", "0x1"
+    };
+
+    for (size_t i = 0; i < sizeof (invalid_json_p) / sizeof (invalid_json_p[0]); i++)
+    {
+      for (jerry_size_t chunk_size = 1; chunk_size <= 3; chunk_size++)
+      {
+        jerry_value_t parsed_json = parse_in_chunks (invalid_json_p[i], chunk_size);
+        TEST_ASSERT (jerry_value_is_error (parsed_json));
+        TEST_ASSERT (jerry_get_error_type (parsed_json) == JERRY_ERROR_SYNTAX);
+        jerry_release_value (parsed_json);
+      }
+    }
+
+    /* The parser keeps the parsed objects alive during garbage collection. */
+    jerry_json_parser_t *parser_p = jerry_json_parser_create ();
+    jerry_value_t result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "[{\"a\": [1], \"b", 14);
+    TEST_ASSERT (!jerry_value_is_error (result));
+    jerry_release_value (result);
+
+    jerry_gc (JERRY_GC_PRESSURE_HIGH);
+
+    result = jerry_json_parser_feed (parser_p, (const jerry_char_t *) "\": 2}]", 6);
+    TEST_ASSERT (!jerry_value_is_error (result));
+    jerry_release_value (result);
+
+    result = jerry_json_parser_finish (parser_p);
+    expected = jerry_json_parse ((const jerry_char_t *) "[{\"a\": [1], \"b\": 2}]", 20);
+    TEST_ASSERT (compare_json_strings (result, expected));
+    jerry_release_value (expected);
+    jerry_release_value (result);
+
+    result = jerry_json_parser_finish (NULL);
+    TEST_ASSERT (jerry_value_is_error (result));
+    jerry_release_value (result);
+  }
+
   /* JSON.stringify check */
   {
     jerry_value_t obj = jerry_create_object ();
@@ -26,6 +26,9 @@ int main (void)
     "var a = 'hello';"
     "var b = 'world';"
     "var c = a + ' ' + b;"
+    "var o = { x: 1, y: 2 };"
+    "for (var i = 0; i < 10; i++) { o.x += o.y; }"
+    "for (var i = 0; i < 10; i++) { new RegExp ('a' + (i % 2), 'g'); }"
   );
 
   jerry_init (JERRY_INIT_EMPTY);
@@ -48,6 +51,32 @@ int main (void)
 
   TEST_ASSERT (!jerry_get_memory_stats (NULL));
 
+  jerry_lcache_stats_t lcache_stats;
+  memset (&lcache_stats, 0, sizeof (lcache_stats));
+
+  if (jerry_get_lcache_stats (&lcache_stats))
+  {
+    TEST_ASSERT (lcache_stats.version == 1);
+    TEST_ASSERT (lcache_stats.rows > 0 && lcache_stats.row_length > 0);
+    TEST_ASSERT (lcache_stats.hit_count > 0);
+    TEST_ASSERT (lcache_stats.miss_count > 0);
+  }
+
+  TEST_ASSERT (!jerry_get_lcache_stats (NULL));
+
+  jerry_regexp_cache_stats_t regexp_cache_stats;
+  memset (&regexp_cache_stats, 0, sizeof (regexp_cache_stats));
+
+  if (jerry_get_regexp_cache_stats (&regexp_cache_stats))
+  {
+    TEST_ASSERT (regexp_cache_stats.version == 1);
+    TEST_ASSERT (regexp_cache_stats.size >= 4);
+    TEST_ASSERT (regexp_cache_stats.hit_count + regexp_cache_stats.miss_count == 10);
+    TEST_ASSERT (regexp_cache_stats.miss_count >= 2);
+  }
+
+  TEST_ASSERT (!jerry_get_regexp_cache_stats (NULL));
+
   jerry_release_value (res);
   jerry_release_value (parsed_code_val);
 
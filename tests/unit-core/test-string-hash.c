@@ -0,0 +1,151 @@
+/* Copyright JS Foundation and other contributors, http://js.foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-helpers.h"
+#include "lit-strings.h"
+#include "ecma-init-finalize.h"
+
+#include "test-common.h"
+
+/* Number of generated keys. */
+#define test_key_count (4096)
+
+/* Number of hash buckets (must be a power of 2). */
+#define test_bucket_count (1024)
+
+/* Max bytes in a generated key. */
+#define test_max_key_size (64)
+
+static const char * const test_words[] =
+{
+  "id", "name", "value", "type", "index", "length", "data", "item", "node", "parent",
+  "child", "next", "prev", "count", "size", "offset", "user", "email", "created", "updated",
+  "status", "result", "error", "message", "callback", "handler", "options", "config", "key", "list",
+  "map", "set",
+};
+
+#define test_word_count ((int) (sizeof (test_words) / sizeof (test_words[0])))
+
+static lit_utf8_size_t
+generate_key (int index, /**< key index */
+              lit_utf8_byte_t *buf_p) /**< [out] key buffer */
+{
+  const char *first_p = test_words[(index / 4) % test_word_count];
+  const char *second_p = test_words[(index / (4 * test_word_count)) % test_word_count];
+  int size;
+
+  switch (index % 4)
+  {
+    case 0:
+    {
+      /* Identifier: camelCase pair of words. */
+      size = snprintf ((char *) buf_p, test_max_key_size, "%s%c%s", first_p, second_p[0] - 32, second_p + 1);
+      break;
+    }
+    case 1:
+    {
+      /* JSON key: snake_case word with a numeric suffix. */
+      size = snprintf ((char *) buf_p, test_max_key_size, "%s_%d", first_p, index);
+      break;
+    }
+    case 2:
+    {
+      /* Generated identifier: short prefix with a counter. */
+      size = snprintf ((char *) buf_p, test_max_key_size, "_%c%d", first_p[0], index);
+      break;
+    }
+    default:
+    {
+      /* Property path. */
+      size = snprintf ((char *) buf_p, test_max_key_size, "%s.%s[%d]", first_p, second_p, index / 4);
+      break;
+    }
+  }
+
+  TEST_ASSERT (size > 0 && size < test_max_key_size);
+  return (lit_utf8_size_t) size;
+} /* generate_key */
+
+static lit_string_hash_t hashes[test_key_count];
+static uint32_t buckets[test_bucket_count];
+
+int
+main (void)
+{
+  TEST_INIT ();
+
+  lit_utf8_byte_t buf[test_max_key_size];
+
+  /* Keys must be unique. */
+  for (int i = 0; i < test_key_count; i++)
+  {
+    lit_utf8_size_t size = generate_key (i, buf);
+    hashes[i] = lit_utf8_string_calc_hash (buf, size);
+
+    /* Continuing the hash of a prefix gives the hash of the whole key. */
+    for (lit_utf8_size_t split = 0; split <= size; split++)
+    {
+      lit_string_hash_t prefix_hash = lit_utf8_string_calc_hash (buf, split);
+      TEST_ASSERT (lit_utf8_string_hash_combine (prefix_hash, buf + split, size - split) == hashes[i]);
+    }
+
+    buckets[hashes[i] & (test_bucket_count - 1)]++;
+  }
+
+  /* Full hash collisions. */
+  uint32_t collisions = 0;
+
+  for (int i = 0; i < test_key_count; i++)
+  {
+    for (int j = i + 1; j < test_key_count; j++)
+    {
+      if (hashes[i] == hashes[j])
+      {
+        lit_utf8_size_t size1 = generate_key (i, buf);
+        lit_utf8_byte_t buf2[test_max_key_size];
+        lit_utf8_size_t size2 = generate_key (j, buf2);
+
+        TEST_ASSERT (size1 != size2 || memcmp (buf, buf2, size1) != 0);
+        collisions++;
+      }
+    }
+  }
+
+  /* The expected number of collisions of a uniform 32 bit hash is less than 0.002. */
+  TEST_ASSERT (collisions <= 1);
+
+  /* Bucket distribution of the low bits: four keys per bucket on average. */
+  uint32_t empty_buckets = 0;
+  uint32_t max_bucket_size = 0;
+
+  for (int i = 0; i < test_bucket_count; i++)
+  {
+    if (buckets[i] == 0)
+    {
+      empty_buckets++;
+    }
+
+    if (buckets[i] > max_bucket_size)
+    {
+      max_bucket_size = buckets[i];
+    }
+  }
+
+  /* A uniform hash leaves about 19 buckets empty and its largest bucket has about 12 keys. */
+  TEST_ASSERT (empty_buckets < 64);
+  TEST_ASSERT (max_bucket_size <= 16);
+
+  return 0;
+} /* main */
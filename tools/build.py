@@ -118,6 +118,10 @@ def get_arguments():
                          help='enable the jerry debugger (%(choices)s)')
     coregrp.add_argument('--js-parser', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable js-parser (%(choices)s)')
+    coregrp.add_argument('--incremental-gc', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable incremental garbage collection (%(choices)s)')
+    coregrp.add_argument('--generational-gc', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable generational garbage collection (%(choices)s)')
     coregrp.add_argument('--line-info', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='provide line info (%(choices)s)')
     coregrp.add_argument('--logging', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -130,6 +134,14 @@ def get_arguments():
                          help='maximum stack usage (in kilobytes)')
     coregrp.add_argument('--gc-mark-limit', metavar='SIZE', type=int,
                          help='maximum depth of recursion during GC mark phase')
+    coregrp.add_argument('--lcache-rows', metavar='COUNT', type=int,
+                         help='number of rows in the property lookup cache (power of 2)')
+    coregrp.add_argument('--lcache-row-length', metavar='COUNT', type=int,
+                         help='number of entries in a row of the property lookup cache (1-8)')
+    coregrp.add_argument('--regexp-cache-size', metavar='COUNT', type=int,
+                         help='number of compiled patterns in the RegExp cache (power of 2, at least 4)')
+    coregrp.add_argument('--regexp-cache-gc-limit', metavar='SIZE', type=int,
+                         help='size of the RegExp cache kept by garbage collections (in bytes)')
     coregrp.add_argument('--mem-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable memory statistics (%(choices)s)'))
     coregrp.add_argument('--mem-stress-test', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -146,12 +158,16 @@ def get_arguments():
                          help='enable executing snapshot files (%(choices)s)')
     coregrp.add_argument('--snapshot-save', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable saving snapshot files (%(choices)s)')
+    coregrp.add_argument('--segregated-allocator', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help='enable segregated free lists in the allocator (%(choices)s)')
     coregrp.add_argument('--system-allocator', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable system allocator (%(choices)s)')
     coregrp.add_argument('--valgrind', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help=devhelp('enable Valgrind support (%(choices)s)'))
     coregrp.add_argument('--vm-exec-stop', metavar='X', choices=['ON', 'OFF'], type=str.upper,
                          help='enable VM execution stopping (%(choices)s)')
+    coregrp.add_argument('--vm-opcode-stats', metavar='X', choices=['ON', 'OFF'], type=str.upper,
+                         help=devhelp('enable VM opcode sequence statistics (%(choices)s)'))
 
     maingrp = parser.add_argument_group('jerry-main options')
     maingrp.add_argument('--link-map', metavar='X', choices=['ON', 'OFF'], type=str.upper,
@@ -200,6 +216,8 @@ def generate_build_options(arguments):
     build_options_append('JERRY_EXTERNAL_CONTEXT', arguments.external_context)
     build_options_append('JERRY_DEBUGGER', arguments.jerry_debugger)
     build_options_append('JERRY_PARSER', arguments.js_parser)
+    build_options_append('JERRY_INCREMENTAL_GC', arguments.incremental_gc)
+    build_options_append('JERRY_GENERATIONAL_GC', arguments.generational_gc)
     build_options_append('JERRY_LINE_INFO', arguments.line_info)
     build_options_append('JERRY_LOGGING', arguments.logging)
     build_options_append('JERRY_GLOBAL_HEAP_SIZE', arguments.mem_heap)
@@ -213,13 +231,27 @@ def generate_build_options(arguments):
     build_options_append('JERRY_REGEXP_DUMP_BYTE_CODE', arguments.show_regexp_opcodes)
     build_options_append('JERRY_SNAPSHOT_EXEC', arguments.snapshot_exec)
     build_options_append('JERRY_SNAPSHOT_SAVE', arguments.snapshot_save)
+    build_options_append('JERRY_SEGREGATED_ALLOCATOR', arguments.segregated_allocator)
     build_options_append('JERRY_SYSTEM_ALLOCATOR', arguments.system_allocator)
     build_options_append('JERRY_VALGRIND', arguments.valgrind)
     build_options_append('JERRY_VM_EXEC_STOP', arguments.vm_exec_stop)
+    build_options_append('JERRY_VM_OPCODE_STATS', arguments.vm_opcode_stats)
 
     if arguments.gc_mark_limit is not None:
         build_options.append('-D%s=%s' % ('JERRY_GC_MARK_LIMIT', arguments.gc_mark_limit))
 
+    if arguments.lcache_rows is not None:
+        build_options.append('-D%s=%s' % ('JERRY_LCACHE_ROWS_COUNT', arguments.lcache_rows))
+
+    if arguments.lcache_row_length is not None:
+        build_options.append('-D%s=%s' % ('JERRY_LCACHE_ROW_LENGTH', arguments.lcache_row_length))
+
+    if arguments.regexp_cache_size is not None:
+        build_options.append('-D%s=%s' % ('JERRY_REGEXP_CACHE_SIZE', arguments.regexp_cache_size))
+
+    if arguments.regexp_cache_gc_limit is not None:
+        build_options.append('-D%s=%s' % ('JERRY_REGEXP_CACHE_GC_LIMIT', arguments.regexp_cache_gc_limit))
+
     # jerry-main options
     build_options_append('ENABLE_LINK_MAP', arguments.link_map)
 
@@ -131,6 +131,8 @@ JERRY_BUILDOPTIONS = [
             ['--valgrind=on']),
     Options('buildoption_test-mem_stats',
             ['--mem-stats=on']),
+    Options('buildoption_test-vm_opcode_stats',
+            ['--vm-opcode-stats=on']),
     Options('buildoption_test-show_opcodes',
             ['--show-opcodes=on']),
     Options('buildoption_test-show_regexp_opcodes',
@@ -141,11 +143,35 @@ JERRY_BUILDOPTIONS = [
                 platform.system() != 'Linux' or (platform.machine() != 'i386' and platform.machine() != 'x86_64'),
                 '-m32 is only supported on x86[-64]-linux')
            ),
+    Options('buildoption_test-segregated_allocator',
+            ['--segregated-allocator=on']),
+    Options('buildoption_test-incremental_gc',
+            ['--incremental-gc=on']),
+    Options('buildoption_test-generational_gc',
+            ['--generational-gc=on']),
     Options('buildoption_test-no_jerry_libm',
             ['--jerry-libm=off', '--link-lib=m'],
             skip=skip_if((sys.platform == 'win32'), 'There is no separated libm on Windows')),
     Options('buildoption_test-no_lcache_prophashmap',
             ['--compile-flag=-DJERRY_LCACHE=0', '--compile-flag=-DJERRY_PROPRETY_HASHMAP=0']),
+    Options('buildoption_test-no_inline_cache',
+            ['--compile-flag=-DJERRY_INLINE_CACHE=0']),
+    Options('buildoption_test-no_scope_cache',
+            ['--compile-flag=-DJERRY_SCOPE_CACHE=0']),
+    Options('buildoption_test-no_rope_string',
+            ['--compile-flag=-DJERRY_ROPE_STRING=0']),
+    Options('buildoption_test-no_string_index_cache',
+            ['--compile-flag=-DJERRY_STRING_INDEX_CACHE=0']),
+    Options('buildoption_test-fnv_string_hash',
+            ['--compile-flag=-DJERRY_FAST_STRING_HASH=0']),
+    Options('buildoption_test-no_regexp_nfa',
+            ['--compile-flag=-DJERRY_REGEXP_NFA=0']),
+    Options('buildoption_test-regexp_cache_min',
+            ['--regexp-cache-size=4', '--regexp-cache-gc-limit=0']),
+    Options('buildoption_test-native_stack_frames',
+            ['--compile-flag=-DJERRY_VM_STACK_SEGMENT_SIZE=0']),
+    Options('buildoption_test-switch_dispatch',
+            ['--compile-flag=-DJERRY_VM_COMPUTED_GOTO=0']),
     Options('buildoption_test-external_context',
             ['--external-context=on']),
     Options('buildoption_test-shared_libs',
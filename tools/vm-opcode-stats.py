@@ -0,0 +1,148 @@
+#!/usr/bin/env python
+
+# Copyright JS Foundation and other contributors, http://js.foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+from settings import PROJECT_DIR
+
+DEFAULT_CORPUS = [
+    os.path.join(PROJECT_DIR, 'tests', 'benchmarks', 'jerry')
+]
+
+SECTION_HEADERS = {
+    'Most frequent opcodes:': 1,
+    'Most frequent opcode pairs:': 2,
+    'Most frequent opcode triples:': 3
+}
+
+EXECUTED_RE = re.compile(r'^\s*Executed opcodes = (\d+)$')
+SEQUENCE_RE = re.compile(r'^\s*(\d+)\s+((?:CBC_\w+\s*)+)$')
+
+
+def get_args():
+    desc = ('Collect the opcode sequence statistics of a JerryScript engine built with '
+            '--vm-opcode-stats=on over a corpus of JavaScript files, and list the most '
+            'frequent opcode pairs and triples as candidates for combined opcodes.')
+    parser = argparse.ArgumentParser(description=desc)
+    parser.add_argument('--engine', metavar='FILE', required=True,
+                        help='JerryScript binary built with opcode statistics')
+    parser.add_argument('--top', metavar='N', type=int, default=20,
+                        help='number of sequences listed for each length (default: %(default)d)')
+    parser.add_argument('--timeout', metavar='SECONDS', type=int, default=60,
+                        help='time limit of a single test file (default: %(default)d)')
+    parser.add_argument('corpus', metavar='PATH', nargs='*', default=DEFAULT_CORPUS,
+                        help='JavaScript files or directories (default: the jerry benchmarks)')
+
+    return parser.parse_args()
+
+
+def collect_files(paths):
+    files = []
+
+    for path in paths:
+        if os.path.isdir(path):
+            for root, _, names in os.walk(path):
+                files.extend(os.path.join(root, name) for name in names if name.endswith('.js'))
+        else:
+            files.append(path)
+
+    return sorted(files)
+
+
+def run_engine(engine, test_file, timeout):
+    command = [engine, '--log-level', '3', test_file]
+
+    try:
+        if sys.version_info >= (3, 3):
+            process = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                     cwd=os.path.dirname(test_file), timeout=timeout)
+            return process.stdout.decode('utf-8', 'replace')
+        return subprocess.check_output(command, stderr=subprocess.STDOUT, cwd=os.path.dirname(test_file))
+    except subprocess.CalledProcessError as err:
+        return err.output
+    except subprocess.TimeoutExpired:
+        print('%s: timeout' % test_file, file=sys.stderr)
+        return ''
+
+
+def parse_stats(output, stats):
+    length = 0
+    executed = 0
+
+    for line in output.splitlines():
+        line = line.rstrip()
+
+        match = EXECUTED_RE.match(line)
+        if match:
+            executed = int(match.group(1))
+            continue
+
+        if line in SECTION_HEADERS:
+            length = SECTION_HEADERS[line]
+            continue
+
+        match = SEQUENCE_RE.match(line)
+        if match and length:
+            sequence = tuple(match.group(2).split())
+            if len(sequence) == length:
+                stats[sequence] = stats.get(sequence, 0) + int(match.group(1))
+            continue
+
+        length = 0
+
+    return executed
+
+
+def print_sequences(stats, length, top, executed):
+    sequences = [(count, sequence) for sequence, count in stats.items() if len(sequence) == length]
+    sequences.sort(key=lambda item: (-item[0], item[1]))
+
+    print('\nMost frequent opcode %s:' % {1: 'singles', 2: 'pairs', 3: 'triples'}[length])
+
+    for count, sequence in sequences[:top]:
+        share = 100.0 * count / executed if executed else 0.0
+        print('  %12d %6.2f%%  %s' % (count, share, ' + '.join(sequence)))
+
+
+def main(args):
+    if not os.path.isfile(args.engine):
+        sys.exit('Engine not found: %s' % args.engine)
+
+    stats = {}
+    executed = 0
+    files = collect_files(args.corpus)
+
+    for test_file in files:
+        output = run_engine(args.engine, os.path.abspath(test_file), args.timeout)
+        executed += parse_stats(output, stats)
+
+    if not stats:
+        sys.exit('No opcode statistics were printed, is the engine built with --vm-opcode-stats=on?')
+
+    print('Files: %d, executed opcodes: %d' % (len(files), executed))
+
+    for length in (1, 2, 3):
+        print_sequences(stats, length, args.top, executed)
+
+
+if __name__ == "__main__":
+    main(get_args())